@@ -0,0 +1,116 @@
+// Compares the explicit Runge–Kutta engine with the hand-written fixed-size
+// RK4 kernel it replaced, on a damped oscillator with a cheap right-hand
+// side so that any overhead in the engine dominates. Exits with a failure
+// if the engine is more than kMaxRatio times slower.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+#include "ode/explicit_runge_kutta.hpp"
+#include "ode/functor_solvers.hpp"
+
+namespace {
+
+using State = std::array<double, 2>;
+
+constexpr int kSteps = 10000000;
+constexpr double kH = 1e-6;
+constexpr int kRepeats = 5;
+constexpr double kMaxRatio = 1.25;
+
+// Damped oscillator x'' = -x - 0.1 x'
+struct Oscillator {
+  void operator()(double t [[maybe_unused]], const State& y,
+                  State& dydt) const {
+    dydt[0] = y[1];
+    dydt[1] = -y[0] - 0.1 * y[1];
+  }
+};
+
+// Final state only, so that the runs measure stepping rather than storage
+vanta::ode::OutputOptions FinalStateOnly() {
+  vanta::ode::OutputOptions out;
+  out.stride = 0;
+  return out;
+}
+
+// Template RK4 solver as hand-written before the engine replaced it
+vanta::ode::Solution HandWrittenRungeKutta4(
+    double t0, double t1, const State& y0, double h,
+    const vanta::ode::OutputOptions& out) {
+  Oscillator f;
+  const auto steps = static_cast<int>(std::ceil((t1 - t0) / h));
+  const std::size_t n = y0.size();
+  vanta::ode::OutputRecorder recorder(out, n, steps, {});
+  recorder.Start(t0, y0);
+
+  double t = t0;
+  State y = y0;
+  State k1 = y0, k2 = y0, k3 = y0, k4 = y0, y_stage = y0;
+  for (int i = 0; i < steps; ++i) {
+    f(t, y, k1);
+    for (std::size_t j = 0; j < n; ++j) y_stage[j] = y[j] + 0.5 * h * k1[j];
+    f(t + 0.5 * h, y_stage, k2);
+    for (std::size_t j = 0; j < n; ++j) y_stage[j] = y[j] + 0.5 * h * k2[j];
+    f(t + 0.5 * h, y_stage, k3);
+    for (std::size_t j = 0; j < n; ++j) y_stage[j] = y[j] + h * k3[j];
+    f(t + h, y_stage, k4);
+    for (std::size_t j = 0; j < n; ++j) {
+      y[j] += (h / 6.0) * (k1[j] + 2.0 * k2[j] + 2.0 * k3[j] + k4[j]);
+    }
+
+    t += h;
+    if (recorder.Step(t, y)) break;
+  }
+  return recorder.Finish();
+}
+
+// Best wall time in seconds over kRepeats calls of solve
+template <typename Solve>
+double BestTime(Solve solve) {
+  double best = 0.0;
+  for (int r = 0; r < kRepeats; ++r) {
+    const auto start = std::chrono::steady_clock::now();
+    const vanta::ode::Solution sol = solve();
+    const double elapsed = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    if (sol.NumSteps() != 1) return -1.0;
+    best = r == 0 ? elapsed : std::min(best, elapsed);
+  }
+  return best;
+}
+
+}  // namespace
+
+int main() {
+  const State y0 = {1.0, 0.0};
+  const double t1 = kSteps * kH;
+  const vanta::ode::OutputOptions out = FinalStateOnly();
+
+  const double kernel = BestTime(
+      [&] { return HandWrittenRungeKutta4(0.0, t1, y0, kH, out); });
+  const double engine = BestTime([&] {
+    return vanta::ode::RungeKutta4(Oscillator{}, 0.0, t1, y0, kH, out);
+  });
+  const double ratio = engine / kernel;
+
+  std::cout << "Fixed-size RK4, " << kSteps << " steps\n"
+            << "  hand-written kernel: " << kernel << " s\n"
+            << "  tableau engine:      " << engine << " s\n"
+            << "  ratio:               " << ratio << '\n';
+  if (kernel <= 0.0 || engine <= 0.0) {
+    std::cerr << "Unexpected solution size\n";
+    return 1;
+  }
+  if (ratio > kMaxRatio) {
+    std::cerr << "Engine is more than " << kMaxRatio
+              << " times slower than the hand-written kernel\n";
+    return 1;
+  }
+  return 0;
+}
@@ -1,8 +1,12 @@
+#include <array>
 #include <iostream>
+#include <span>
 
 #include "ode/euler_backward.hpp"
 #include "ode/euler_forward.hpp"
+#include "ode/functor_solvers.hpp"
 #include "ode/runge_kutta_4.hpp"
+#include "ode/symplectic.hpp"
 #include "utils/output.hpp"
 
 int main() {
@@ -17,6 +21,25 @@ int main() {
         return dydt;
       };
 
+  // Fixed-size mass spring damper functor, inlined by the template solvers
+  auto f_fixed = [](double t [[maybe_unused]], const std::array<double, 2>& y,
+                    std::array<double, 2>& dydt) {
+    const double k = 0.2;
+    const double c = 0.2;
+
+    dydt[0] = y[1];
+    dydt[1] = -c * y[1] - k * y[0];
+  };
+
+  // Undamped spring acceleration for the symplectic solvers, which need a
+  // force that depends on position only
+  auto spring = [](double t [[maybe_unused]], std::span<const double> q,
+                   std::span<double> acc) {
+    const double k = 0.2;
+
+    acc[0] = -k * q[0];
+  };
+
   // Variables
   const double t0 = 0.0;
   const double t1 = 100.0;
@@ -30,14 +53,32 @@ int main() {
       vanta::ode::RungeKutta4(f, t0, t1, y0, h);
   vanta::ode::Solution euler_backward_sol =
       vanta::ode::EulerBackward(f, t0, t1, y0, h);
+  vanta::ode::Solution runge_kutta_4_fixed_sol = vanta::ode::RungeKutta4(
+      f_fixed, t0, t1, std::array<double, 2>{1.0, 0.0}, h);
+
+  // Long-horizon undamped runs with a large step, over which the symplectic
+  // solvers keep the energy bounded
+  const double t1_long = 10000.0;
+  const double h_long = 1.0;
+  vanta::ode::Solution verlet_sol = vanta::ode::VelocityVerlet(
+      spring, t0, t1_long, {1.0}, {0.0}, h_long);
+  vanta::ode::Solution yoshida_sol =
+      vanta::ode::Yoshida4(spring, t0, t1_long, {1.0}, {0.0}, h_long);
 
   // Write simulation data to csv file
   vanta::utils::ToCSV("euler_forward.csv", euler_forward_sol.t,
-                      euler_forward_sol.y);
+                      euler_forward_sol.y, euler_forward_sol.NumStates());
   vanta::utils::ToCSV("runge_kutta_4.csv", runge_kutta_4_sol.t,
-                      runge_kutta_4_sol.y);
+                      runge_kutta_4_sol.y, runge_kutta_4_sol.NumStates());
   vanta::utils::ToCSV("euler_backward.csv", euler_backward_sol.t,
-                      euler_backward_sol.y);
+                      euler_backward_sol.y, euler_backward_sol.NumStates());
+  vanta::utils::ToCSV("runge_kutta_4_fixed.csv", runge_kutta_4_fixed_sol.t,
+                      runge_kutta_4_fixed_sol.y,
+                      runge_kutta_4_fixed_sol.NumStates());
+  vanta::utils::ToCSV("velocity_verlet.csv", verlet_sol.t, verlet_sol.y,
+                      verlet_sol.NumStates());
+  vanta::utils::ToCSV("yoshida_4.csv", yoshida_sol.t, yoshida_sol.y,
+                      yoshida_sol.NumStates());
 
   return 0;
 }
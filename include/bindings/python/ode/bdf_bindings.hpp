@@ -0,0 +1,14 @@
+#ifndef BINDINGS_PYTHON_ODE_BDF_BINDINGS_HPP_
+#define BINDINGS_PYTHON_ODE_BDF_BINDINGS_HPP_
+
+#include <pybind11/pybind11.h>
+
+namespace vanta::bindings::python::ode {
+
+void BindBDFOptions(pybind11::module_& m);
+
+void BindBDF(pybind11::module_& m);
+
+}  // namespace vanta::bindings::python::ode
+
+#endif  // BINDINGS_PYTHON_ODE_BDF_BINDINGS_HPP_
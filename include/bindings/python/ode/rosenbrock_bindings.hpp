@@ -0,0 +1,14 @@
+#ifndef BINDINGS_PYTHON_ODE_ROSENBROCK_BINDINGS_HPP_
+#define BINDINGS_PYTHON_ODE_ROSENBROCK_BINDINGS_HPP_
+
+#include <pybind11/pybind11.h>
+
+namespace vanta::bindings::python::ode {
+
+void BindRosenbrockOptions(pybind11::module_& m);
+
+void BindRosenbrock(pybind11::module_& m);
+
+}  // namespace vanta::bindings::python::ode
+
+#endif  // BINDINGS_PYTHON_ODE_ROSENBROCK_BINDINGS_HPP_
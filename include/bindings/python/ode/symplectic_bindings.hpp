@@ -0,0 +1,12 @@
+#ifndef BINDINGS_PYTHON_ODE_SYMPLECTIC_BINDINGS_HPP_
+#define BINDINGS_PYTHON_ODE_SYMPLECTIC_BINDINGS_HPP_
+
+#include <pybind11/pybind11.h>
+
+namespace vanta::bindings::python::ode {
+
+void BindSymplectic(pybind11::module_& m);
+
+}  // namespace vanta::bindings::python::ode
+
+#endif  // BINDINGS_PYTHON_ODE_SYMPLECTIC_BINDINGS_HPP_
@@ -6,9 +6,13 @@
  * @brief Compute numerical Jacobian using the forward differencing method.
  */
 
+#include <cstddef>
 #include <functional>
+#include <span>
 #include <vector>
 
+#include "linear_solvers/sparsity_pattern.hpp"
+
 namespace vanta::finite_difference {
 
 /**
@@ -37,6 +41,125 @@ std::vector<std::vector<double>> ForwardDifference(
     const std::function<std::vector<double>(const std::vector<double>&)>& f,
     const std::vector<double>& x, double h = 1e-8);
 
+/**
+ * @brief Compute a forward-difference Jacobian into a caller-owned buffer.
+ *
+ * This overload evaluates the function in place and reuses the value
+ * @p fx = f(x), which callers such as implicit ODE solvers usually already
+ * have, so only one extra evaluation per column is needed. Each column uses
+ * the scaled step \f$ h_j = \sqrt{\epsilon} \max(|x_j|, 1) \f$, which keeps
+ * the truncation and round-off errors balanced for large and small
+ * components alike.
+ *
+ * @param f        Function writing f(x) into its second argument.
+ * @param x        Point at which the Jacobian is evaluated (size n).
+ * @param fx       Value of f at @p x (size m).
+ * @param jacobian Row-major m x n output; element (i, j) is ∂f_i/∂x_j.
+ * @param work     Scratch space of n + m values (optional). If empty, it is
+ *                 allocated for the call.
+ */
+void ForwardDifference(
+    const std::function<void(std::span<const double>, std::span<double>)>& f,
+    std::span<const double> x, std::span<const double> fx,
+    std::span<double> jacobian, std::span<double> work = {});
+
+/**
+ * @brief Group the columns of a sparse Jacobian for compressed differencing.
+ *
+ * Two columns can be perturbed together if no row has a nonzero in both.
+ * Columns are assigned greedily, in order, to the first group that keeps
+ * this property, which for a banded pattern of bandwidth @c w gives
+ * @c w groups independent of the matrix size.
+ *
+ * @param pattern Sparsity pattern of the Jacobian.
+ *
+ * @return The group (colour) of each column, numbered from zero.
+ */
+std::vector<std::size_t> ColourColumns(
+    const vanta::linear_solvers::SparsityPattern& pattern);
+
+/**
+ * @brief Compute a sparse forward-difference Jacobian with column
+ * compression.
+ *
+ * All columns of the same colour are perturbed at once, so the Jacobian
+ * costs one function evaluation per colour instead of one per column. Steps
+ * are scaled per column as in the dense in-place overload.
+ *
+ * @param f       Function writing f(x) into its second argument.
+ * @param x       Point at which the Jacobian is evaluated (size n).
+ * @param fx      Value of f at @p x (size n).
+ * @param pattern Sparsity pattern of the Jacobian.
+ * @param colours Column colours from @c ColourColumns.
+ * @param values  Output nonzero values, aligned with @c pattern.col_idx.
+ * @param work    Scratch space of 3 n values (optional). If empty, it is
+ *                allocated for the call.
+ */
+void ForwardDifference(
+    const std::function<void(std::span<const double>, std::span<double>)>& f,
+    std::span<const double> x, std::span<const double> fx,
+    const vanta::linear_solvers::SparsityPattern& pattern,
+    std::span<const std::size_t> colours, std::span<double> values,
+    std::span<double> work = {});
+
+/**
+ * @brief Function evaluated at a batch of points in one call.
+ *
+ * The @p n_points points are laid out in structure-of-arrays form: element
+ * @c x[j * n_points + p] is component @c j of point @c p. The callable must
+ * write the function values into @p fx using the same layout.
+ */
+using BatchFunction =
+    std::function<void(std::span<const double> x, std::span<double> fx,
+                       std::size_t n_points)>;
+
+/**
+ * @brief Compute a dense forward-difference Jacobian with one batched call.
+ *
+ * Evaluates the n perturbed points of the in-place overload together, so
+ * the Jacobian costs a single call of @p f regardless of its size, and
+ * gives the same result as the in-place overload for a batch function that
+ * evaluates every point as the unbatched one would.
+ *
+ * @param f        Batched function writing f at each point of its first
+ *                 argument into its second.
+ * @param x        Point at which the Jacobian is evaluated (size n).
+ * @param fx       Value of f at @p x (size m).
+ * @param jacobian Row-major m x n output; element (i, j) is ∂f_i/∂x_j.
+ * @param work     Scratch space of n (n + m) values (optional). If empty,
+ *                 it is allocated for the call.
+ */
+void BatchForwardDifference(const BatchFunction& f,
+                            std::span<const double> x,
+                            std::span<const double> fx,
+                            std::span<double> jacobian,
+                            std::span<double> work = {});
+
+/**
+ * @brief Compute a sparse forward-difference Jacobian with column
+ * compression and one batched call.
+ *
+ * Evaluates the perturbed point of every colour together, so the Jacobian
+ * costs a single call of @p f over as many points as there are colours, and
+ * gives the same values as the compressed in-place overload.
+ *
+ * @param f       Batched function writing f at each point of its first
+ *                argument into its second.
+ * @param x       Point at which the Jacobian is evaluated (size n).
+ * @param fx      Value of f at @p x (size n).
+ * @param pattern Sparsity pattern of the Jacobian.
+ * @param colours Column colours from @c ColourColumns.
+ * @param values  Output nonzero values, aligned with @c pattern.col_idx.
+ * @param work    Scratch space of (2 c + 1) n values for c colours
+ *                (optional). If empty, it is allocated for the call.
+ */
+void BatchForwardDifference(
+    const BatchFunction& f, std::span<const double> x,
+    std::span<const double> fx,
+    const vanta::linear_solvers::SparsityPattern& pattern,
+    std::span<const std::size_t> colours, std::span<double> values,
+    std::span<double> work = {});
+
 }  // namespace vanta::finite_difference
 
 #endif  // CORE_FINITE_DIFFERENCE_FORWARD_DIFFERENCE_HPP_
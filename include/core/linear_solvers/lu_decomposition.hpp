@@ -0,0 +1,67 @@
+#ifndef CORE_LINEAR_SOLVERS_LU_DECOMPOSITION_HPP_
+#define CORE_LINEAR_SOLVERS_LU_DECOMPOSITION_HPP_
+
+/**
+ * @file lu_decomposition.hpp
+ * @brief LU factorisation with partial pivoting and reusable solves.
+ *
+ * Unlike @c GaussianElimination, which eliminates the matrix again for every
+ * right-hand side, the factors computed here can be stored and reused to
+ * solve any number of systems with the same matrix at O(n^2) cost each.
+ */
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace vanta::linear_solvers {
+
+/**
+ * @brief LU factors of a square matrix with row pivoting.
+ *
+ * The factorisation satisfies \f$ P A = L U \f$, where @c L is unit lower
+ * triangular and @c U is upper triangular. Both are packed into @c lu.
+ */
+struct LUFactors {
+  /// Dimension of the factorised matrix.
+  std::size_t n = 0;
+
+  /**
+   * @brief Packed row-major factors.
+   *
+   * The strict lower triangle holds @c L (its unit diagonal is implied) and
+   * the upper triangle including the diagonal holds @c U.
+   */
+  std::vector<double> lu;
+
+  /// Row swapped with row @c i at elimination step @c i.
+  std::vector<std::size_t> pivots;
+};
+
+/**
+ * @brief Compute the LU factorisation of a square matrix.
+ *
+ * The storage held by @p factors is reused when its dimension already
+ * matches, so refactorising a matrix of the same size does not allocate.
+ *
+ * @param A       Row-major matrix of @p n x @p n coefficients.
+ * @param n       Matrix dimension.
+ * @param factors Output factors.
+ *
+ * @throws std::invalid_argument If @p A does not hold @p n x @p n values.
+ * @throws std::runtime_error    If the matrix is singular.
+ */
+void LUFactorise(std::span<const double> A, std::size_t n,
+                 LUFactors& factors);
+
+/**
+ * @brief Solve \f$ A x = b \f$ in place using precomputed LU factors.
+ *
+ * @param factors Factors of @c A computed by @c LUFactorise.
+ * @param b       Right-hand side on entry, solution @c x on exit.
+ */
+void LUSolve(const LUFactors& factors, std::span<double> b);
+
+}  // namespace vanta::linear_solvers
+
+#endif  // CORE_LINEAR_SOLVERS_LU_DECOMPOSITION_HPP_
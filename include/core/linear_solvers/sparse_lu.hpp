@@ -0,0 +1,97 @@
+#ifndef CORE_LINEAR_SOLVERS_SPARSE_LU_HPP_
+#define CORE_LINEAR_SOLVERS_SPARSE_LU_HPP_
+
+/**
+ * @file sparse_lu.hpp
+ * @brief Sparse LU factorisation split into symbolic and numeric phases.
+ *
+ * The symbolic phase computes the nonzero structure of the factors, including
+ * fill-in, once per sparsity pattern. The numeric phase can then be repeated
+ * for new values with the same pattern at a cost proportional to the number
+ * of nonzeros in the factors rather than n^3. Rows and columns are reordered
+ * by minimum degree to keep that number small.
+ */
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "sparsity_pattern.hpp"
+
+namespace vanta::linear_solvers {
+
+/**
+ * @brief Sparse LU factors of a symmetrically permuted square matrix,
+ * \f$ P A P^T = L U \f$.
+ *
+ * @c L is unit lower triangular and @c U upper triangular. Both are packed
+ * in one CSR structure whose rows hold the strict lower part of @c L followed
+ * by the diagonal and upper part of @c U.
+ */
+struct SparseLUFactors {
+  /// Matrix dimension.
+  std::size_t n = 0;
+
+  /// Row and column of @c A that each row and column of the factors holds.
+  std::vector<std::size_t> perm;
+
+  /// Start of each row of the factors in @c col_idx.
+  std::vector<std::size_t> row_ptr;
+
+  /// Column index of each nonzero of the factors, sorted within rows.
+  std::vector<std::size_t> col_idx;
+
+  /// Position of the diagonal entry of each row in @c col_idx.
+  std::vector<std::size_t> diag;
+
+  /// Position in @c values of each nonzero of the analysed matrix pattern.
+  std::vector<std::size_t> a_map;
+
+  /// Numeric values of the factors.
+  std::vector<double> values;
+
+  /// Dense row used during factorisation and solves, kept so it is
+  /// allocated once. Left zeroed by both.
+  mutable std::vector<double> work;
+};
+
+/**
+ * @brief Symbolic phase: compute the structure of the LU factors.
+ *
+ * The factorisation does not pivot, so it is intended for matrices such as
+ * \f$ I - \gamma J \f$ that are diagonally dominant for small enough
+ * \f$ \gamma \f$. To limit fill-in, rows and columns are reordered by the
+ * same minimum degree ordering of the pattern of \f$ A + A^T \f$. A
+ * symmetric permutation keeps the diagonal on the diagonal, so diagonal
+ * dominance is preserved, and banded matrices keep their natural order.
+ *
+ * @param pattern Pattern of the matrix. Missing diagonal entries are added.
+ * @param factors Output structure of the factors.
+ *
+ * @throws std::invalid_argument If @p pattern is malformed.
+ */
+void SparseLUAnalyse(const SparsityPattern& pattern, SparseLUFactors& factors);
+
+/**
+ * @brief Numeric phase: factorise a matrix with an analysed pattern.
+ *
+ * @param values  Matrix values aligned with the @c col_idx of the pattern
+ *                passed to @c SparseLUAnalyse.
+ * @param factors Factors analysed for that pattern, updated in place.
+ *
+ * @throws std::runtime_error If a zero pivot is encountered.
+ */
+void SparseLUFactorise(std::span<const double> values,
+                       SparseLUFactors& factors);
+
+/**
+ * @brief Solve \f$ A x = b \f$ in place using sparse LU factors.
+ *
+ * @param factors Factors of @c A computed by @c SparseLUFactorise.
+ * @param b       Right-hand side on entry, solution @c x on exit.
+ */
+void SparseLUSolve(const SparseLUFactors& factors, std::span<double> b);
+
+}  // namespace vanta::linear_solvers
+
+#endif  // CORE_LINEAR_SOLVERS_SPARSE_LU_HPP_
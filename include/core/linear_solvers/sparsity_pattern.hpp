@@ -0,0 +1,64 @@
+#ifndef CORE_LINEAR_SOLVERS_SPARSITY_PATTERN_HPP_
+#define CORE_LINEAR_SOLVERS_SPARSITY_PATTERN_HPP_
+
+/**
+ * @file sparsity_pattern.hpp
+ * @brief Compressed sparse row (CSR) structure of a square sparse matrix.
+ */
+
+#include <cstddef>
+#include <vector>
+
+namespace vanta::linear_solvers {
+
+/**
+ * @brief Positions of the structural nonzeros of a square matrix in CSR form.
+ *
+ * The column indices of row @c i are
+ * @c col_idx[row_ptr[i]] ... @c col_idx[row_ptr[i + 1] - 1], in increasing
+ * order. Values belonging to the pattern are stored in a separate array
+ * aligned with @c col_idx.
+ */
+struct SparsityPattern {
+  /// Matrix dimension.
+  std::size_t n = 0;
+
+  /// Start of each row in @c col_idx, with @c n + 1 entries.
+  std::vector<std::size_t> row_ptr;
+
+  /// Column index of each structural nonzero.
+  std::vector<std::size_t> col_idx;
+
+  /// Number of structural nonzeros.
+  std::size_t NonZeros() const { return col_idx.size(); }
+
+  /// True if no pattern has been set.
+  bool Empty() const { return n == 0; }
+};
+
+/**
+ * @brief Check that a pattern is well formed.
+ *
+ * @param pattern Pattern to check.
+ *
+ * @throws std::invalid_argument If @c row_ptr has the wrong size or is not
+ *         monotone, or a row has unsorted, repeated or out-of-range column
+ *         indices.
+ */
+void ValidatePattern(const SparsityPattern& pattern);
+
+/**
+ * @brief Build the pattern of a banded matrix.
+ *
+ * @param n     Matrix dimension.
+ * @param lower Number of subdiagonals.
+ * @param upper Number of superdiagonals.
+ *
+ * @return Pattern with nonzeros at (i, j) for -lower <= j - i <= upper.
+ */
+SparsityPattern BandedPattern(std::size_t n, std::size_t lower,
+                              std::size_t upper);
+
+}  // namespace vanta::linear_solvers
+
+#endif  // CORE_LINEAR_SOLVERS_SPARSITY_PATTERN_HPP_
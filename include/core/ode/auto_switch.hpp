@@ -0,0 +1,167 @@
+#ifndef CORE_ODE_AUTO_SWITCH_HPP_
+#define CORE_ODE_AUTO_SWITCH_HPP_
+
+/**
+ * @file auto_switch.hpp
+ * @brief Automatic switching between explicit and implicit integration.
+ *
+ * Many problems are stiff only over part of the interval, for example
+ * between the fast transitions of a relaxation oscillator or after the
+ * initial transient of a chemical reaction. An explicit method is cheapest
+ * where the problem is not stiff, but its step size collapses to the
+ * stability limit where it is, while an implicit method pays for Jacobians
+ * and linear solves everywhere. In the spirit of LSODA, @c AutoSwitch starts
+ * with the explicit Dormand–Prince pair, watches the stiffness estimate of
+ * every accepted step and hands over to BDF once the explicit step size has
+ * been limited by stability for a while, and back again once the implicit
+ * step size is well inside the explicit stability region.
+ */
+
+#include <limits>
+#include <vector>
+
+#include "linear_solvers/sparsity_pattern.hpp"
+#include "output.hpp"
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Configuration options for the switching solver.
+ */
+struct SwitchingOptions {
+  /// Relative error tolerance.
+  double rtol = 1e-6;
+
+  /// Absolute error tolerance.
+  double atol = 1e-9;
+
+  /// Largest step size either method may take.
+  double h_max = std::numeric_limits<double>::infinity();
+
+  /// Maximum number of attempted steps over all segments before giving up.
+  int max_steps = 100000;
+
+  /// Highest order BDF may use (between 1 and 5).
+  int max_order = 5;
+
+  /// Analytic Jacobian for BDF. If empty, forward differences are used.
+  Jacobian jacobian;
+
+  /// Sparsity pattern of the Jacobian for BDF (optional).
+  vanta::linear_solvers::SparsityPattern sparsity;
+
+  /// Batched right-hand side for the BDF Jacobian (optional).
+  BatchRhs batch_rhs;
+
+  /**
+   * @brief Explicit steps with \f$ h |\lambda| \f$ above this count as
+   * stability-limited.
+   *
+   * The Dormand–Prince stability region reaches about 3.3 along the
+   * negative real axis.
+   */
+  double stiff_threshold = 3.25;
+
+  /**
+   * @brief Implicit steps with \f$ h |\lambda| \f$ below this count as
+   * non-stiff.
+   *
+   * The default asks for an explicit stable step size at least five times
+   * the current implicit one before switching back.
+   */
+  double nonstiff_threshold = 0.65;
+
+  /// Consecutive accepted steps beyond a threshold that trigger a switch.
+  int switch_steps = 15;
+
+  /// Accepted BDF steps between Jacobian refreshes for the estimate.
+  int monitor_interval = 20;
+};
+
+/**
+ * @brief Point at which the switching solver changed method.
+ */
+struct MethodSwitch {
+  /// Time of the switch, the end of the last step of the previous method.
+  double t = 0.0;
+
+  /// True if BDF was switched to, false if Dormand–Prince was.
+  bool stiff = false;
+};
+
+/**
+ * @brief Result of a switching integration.
+ */
+struct SwitchingSolution {
+  /// Recorded states and the combined work counters of both methods.
+  Solution solution;
+
+  /// Method changes in the order they happened.
+  std::vector<MethodSwitch> switches;
+};
+
+/**
+ * @brief Solve an initial value problem, switching between Dormand–Prince
+ * and BDF as the problem becomes stiff or non-stiff.
+ *
+ * This function integrates a system of ordinary differential equations of the
+ * form
+ * \f[
+ *   \frac{dy}{dt} = f(t, y)
+ * \f]
+ * over \f$[t_0, t_1]\f$ as a sequence of segments, starting with the
+ * adaptive Dormand–Prince RK5(4) method. Both methods report an estimate of
+ * \f$ h |\lambda| \f$ for the dominant Jacobian eigenvalue \f$ \lambda \f$
+ * after every accepted step: Dormand–Prince from its last two stages at no
+ * extra cost, BDF from the spectral radius of its Jacobian. Once
+ * @c opts.switch_steps consecutive explicit steps exceed
+ * @c opts.stiff_threshold the segment ends and BDF continues from the last
+ * state; once as many consecutive BDF steps fall below
+ * @c opts.nonstiff_threshold, Dormand–Prince takes over again. Each new
+ * segment starts from the last step size of the previous one.
+ *
+ * The steps of all segments are recorded as one trajectory, so @p out
+ * applies across switches exactly as for a single solver.
+ *
+ * @param f    Right-hand side function defining the ODE system.
+ * @param t0   Initial time.
+ * @param t1   Final time.
+ * @param y0   Initial state vector at time \f$t_0\f$.
+ * @param opts Tolerances, switching thresholds and Jacobian settings
+ *             (optional).
+ * @param out  Output selection and streaming options (optional). By default
+ *             every accepted step is stored.
+ *
+ * @return A @c SwitchingSolution with the recorded steps, ending exactly at
+ *         @p t1 unless a terminal event fired, and the switch points.
+ *         @c Solution::stats sums the work of both methods.
+ *
+ * @throws std::invalid_argument If @p t1 <= @p t0, a tolerance or threshold
+ *         is not positive, @p opts.nonstiff_threshold is not below
+ *         @p opts.stiff_threshold, @p opts.switch_steps or
+ *         @p opts.monitor_interval is not positive, or @p opts.max_order is
+ *         outside [1, 5].
+ * @throws std::runtime_error If @p opts.max_steps is exceeded or the step
+ *         size underflows.
+ */
+SwitchingSolution AutoSwitch(const Rhs& f, const double& t0, const double& t1,
+                             const std::vector<double>& y0,
+                             const SwitchingOptions& opts = {},
+                             const OutputOptions& out = {});
+
+/**
+ * @brief Solve an initial value problem, switching between Dormand–Prince
+ * and BDF, with an in-place right-hand side.
+ *
+ * @copydetails AutoSwitch(const Rhs&, const double&, const double&, const std::vector<double>&, const SwitchingOptions&, const OutputOptions&)
+ */
+SwitchingSolution AutoSwitch(const InPlaceRhs& f, const double& t0,
+                             const double& t1, const std::vector<double>& y0,
+                             const SwitchingOptions& opts = {},
+                             const OutputOptions& out = {});
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_AUTO_SWITCH_HPP_
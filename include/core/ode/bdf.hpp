@@ -0,0 +1,142 @@
+#ifndef CORE_ODE_BDF_HPP_
+#define CORE_ODE_BDF_HPP_
+
+/**
+ * @file bdf.hpp
+ * @brief Variable-step, variable-order BDF method for stiff ODEs.
+ *
+ * This header declares an implicit multistep solver based on the backward
+ * differentiation formulas of orders one to five. The step size and order
+ * are adapted to meet user supplied error tolerances, which lets stiff
+ * problems be integrated accurately with steps far larger than the fastest
+ * time scale.
+ */
+
+#include <limits>
+#include <vector>
+
+#include "linear_solvers/sparsity_pattern.hpp"
+#include "output.hpp"
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Configuration options for the BDF solver.
+ */
+struct BDFOptions {
+  /// Relative error tolerance.
+  double rtol = 1e-6;
+
+  /// Absolute error tolerance.
+  double atol = 1e-9;
+
+  /// Initial step size. Zero selects one automatically.
+  double h0 = 0.0;
+
+  /// Largest step size the controller may take.
+  double h_max = std::numeric_limits<double>::infinity();
+
+  /// Maximum number of attempted steps before giving up.
+  int max_steps = 100000;
+
+  /// Highest order the method may use (between 1 and 5).
+  int max_order = 5;
+
+  /// Analytic Jacobian. If empty, forward differences are used.
+  Jacobian jacobian;
+
+  /**
+   * @brief Sparsity pattern of the Jacobian (optional).
+   *
+   * If set, the Jacobian is differenced with column compression, stored in
+   * CSR form and factorised with a sparse LU, and @c jacobian must write the
+   * nonzero values in the pattern's order.
+   */
+  vanta::linear_solvers::SparsityPattern sparsity;
+
+  /**
+   * @brief Batched form of the right-hand side (optional).
+   *
+   * If set and @c jacobian is empty, the perturbed states of each
+   * finite-difference Jacobian are evaluated in one call of it instead of
+   * one call of f per column or column colour. It must agree with f.
+   */
+  BatchRhs batch_rhs;
+
+  /**
+   * @brief Stiffness monitor called after every accepted step (optional).
+   *
+   * The estimate of \f$ h |\lambda| \f$ uses the spectral radius of the
+   * current Jacobian. While a monitor is set the Jacobian is also refreshed
+   * every @c monitor_interval accepted steps so that the estimate follows
+   * the solution, which costs one Jacobian evaluation each time.
+   */
+  StiffnessMonitor monitor;
+
+  /// Accepted steps between Jacobian refreshes while @c monitor is set.
+  int monitor_interval = 20;
+};
+
+/**
+ * @brief Solve an initial value problem using the variable-order BDF method.
+ *
+ * This function integrates a system of ordinary differential equations of the
+ * form
+ * \f[
+ *   \frac{dy}{dt} = f(t, y)
+ * \f]
+ * over \f$[t_0, t_1]\f$ with backward differentiation formulas of order
+ * one to five. The solution history is kept as a table of backward
+ * differences that is rescaled whenever the step size changes
+ * (quasi-constant step size form), so each step predicts from the history,
+ * then corrects by solving
+ * \f[
+ *   (I - \frac{h}{\alpha_k} J)\, \Delta = \frac{h}{\alpha_k} f(t, y) - \psi
+ *   - d
+ * \f]
+ * with a simplified Newton iteration. The Jacobian and the LU factors of the
+ * iteration matrix are reused across iterations and steps; the factors are
+ * recomputed when the step size or order changes and the Jacobian only when
+ * the Newton iteration fails to converge. After a run of equal steps the
+ * local errors of the neighbouring orders are estimated and the order with
+ * the largest admissible next step is selected.
+ *
+ * @param f    Right-hand side function defining the ODE system.
+ * @param t0   Initial time.
+ * @param t1   Final time.
+ * @param y0   Initial state vector at time \f$t_0\f$.
+ * @param opts Tolerances, step size controller and Jacobian settings
+ *             (optional).
+ * @param out  Output selection and streaming options (optional). By default
+ *             every accepted step is stored.
+ *
+ * @return A @c Solution containing the accepted steps selected by @p out,
+ *         ending exactly at @p t1. @c Solution::stats reports the number of
+ *         right-hand side and Jacobian evaluations, factorisations and
+ *         accepted and rejected steps.
+ *
+ * @throws std::invalid_argument If @p t1 <= @p t0, a tolerance is not
+ *         positive, @p opts.max_order is outside [1, 5] or a monitor is set
+ *         with a non-positive @p opts.monitor_interval.
+ * @throws std::runtime_error If @p opts.max_steps is exceeded or the step
+ *         size underflows.
+ */
+Solution BDF(const Rhs& f, const double& t0, const double& t1,
+             const std::vector<double>& y0, const BDFOptions& opts = {},
+             const OutputOptions& out = {});
+
+/**
+ * @brief Solve an initial value problem using the variable-order BDF method
+ * with an in-place right-hand side.
+ *
+ * @copydetails BDF(const Rhs&, const double&, const double&, const std::vector<double>&, const BDFOptions&, const OutputOptions&)
+ */
+Solution BDF(const InPlaceRhs& f, const double& t0, const double& t1,
+             const std::vector<double>& y0, const BDFOptions& opts = {},
+             const OutputOptions& out = {});
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_BDF_HPP_
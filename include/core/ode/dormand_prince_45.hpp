@@ -0,0 +1,122 @@
+#ifndef CORE_ODE_DORMAND_PRINCE_45_HPP_
+#define CORE_ODE_DORMAND_PRINCE_45_HPP_
+
+/**
+ * @file dormand_prince_45.hpp
+ * @brief Adaptive Dormand–Prince RK5(4) method for ODEs.
+ *
+ * This header declares an embedded explicit Runge–Kutta solver that adapts
+ * its step size to meet user supplied error tolerances, so smooth regions
+ * are crossed in a few large steps and fast transients are resolved with
+ * small ones.
+ */
+
+#include <limits>
+#include <vector>
+
+#include "output.hpp"
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Configuration options for the Dormand–Prince solver.
+ */
+struct DP45Options {
+  /// Relative error tolerance.
+  double rtol = 1e-6;
+
+  /// Absolute error tolerance.
+  double atol = 1e-9;
+
+  /// Initial step size. Zero selects one automatically.
+  double h0 = 0.0;
+
+  /// Largest step size the controller may take.
+  double h_max = std::numeric_limits<double>::infinity();
+
+  /// Maximum number of attempted steps before giving up.
+  int max_steps = 100000;
+
+  /// Safety factor applied to the optimal step size.
+  double safety = 0.9;
+
+  /// Smallest factor by which a step may shrink.
+  double min_factor = 0.2;
+
+  /// Largest factor by which a step may grow.
+  double max_factor = 10.0;
+
+  /// Proportional-integral controller gain on the previous error.
+  double beta = 0.04;
+
+  /**
+   * @brief Stiffness monitor called after every accepted step (optional).
+   *
+   * The estimate of \f$ h |\lambda| \f$ is formed from the last two stages,
+   * which are evaluated at the same time, as
+   * \f$ h \|k_7 - k_6\| / \|y_{n+1} - Y_6\| \f$ (Hairer and Wanner), so it
+   * costs no extra right-hand side evaluations. Values near the stability
+   * boundary of about 3.3 over many steps indicate that the step size is
+   * limited by stability rather than accuracy.
+   */
+  StiffnessMonitor monitor;
+};
+
+/**
+ * @brief Solve an initial value problem using the adaptive Dormand–Prince
+ * RK5(4) method.
+ *
+ * This function integrates a system of ordinary differential equations of the
+ * form
+ * \f[
+ *   \frac{dy}{dt} = f(t, y)
+ * \f]
+ * over \f$[t_0, t_1]\f$ with a seven-stage embedded Runge–Kutta pair. The
+ * fifth-order solution is propagated and the difference to the embedded
+ * fourth-order solution estimates the local error, which is measured as
+ * \f[
+ *   \mathrm{err} = \sqrt{\frac{1}{n}\sum_i
+ *   \left(\frac{e_i}{a_{tol} + r_{tol}\max(|y_i|, |\hat{y}_i|)}\right)^2}.
+ * \f]
+ * Steps with \f$\mathrm{err} \le 1\f$ are accepted. The next step size is
+ * chosen by a proportional-integral controller and the last stage of each
+ * accepted step is reused as the first stage of the next (FSAL), so an
+ * accepted step costs six right-hand side evaluations.
+ *
+ * @param f    Right-hand side function defining the ODE system.
+ * @param t0   Initial time.
+ * @param t1   Final time.
+ * @param y0   Initial state vector at time \f$t_0\f$.
+ * @param opts Tolerances and step size controller settings (optional).
+ * @param out  Output selection and streaming options (optional). By default
+ *             every accepted step is stored.
+ *
+ * @return A @c Solution containing the accepted steps selected by @p out,
+ *         ending exactly at @p t1. @c Solution::stats reports the
+ *         number of right-hand side evaluations and of accepted and
+ *         rejected steps.
+ *
+ * @throws std::invalid_argument If @p t1 <= @p t0 or a tolerance is not
+ *         positive.
+ * @throws std::runtime_error If @p opts.max_steps is exceeded or the step
+ *         size underflows.
+ */
+Solution DormandPrince45(const Rhs& f, const double& t0, const double& t1,
+                         const std::vector<double>& y0, DP45Options opts = {},
+                         const OutputOptions& out = {});
+
+/**
+ * @brief Solve an initial value problem using the adaptive Dormand–Prince
+ * RK5(4) method with an in-place right-hand side.
+ *
+ * @copydetails DormandPrince45(const Rhs&, const double&, const double&, const std::vector<double>&, DP45Options, const OutputOptions&)
+ */
+Solution DormandPrince45(const InPlaceRhs& f, const double& t0,
+                         const double& t1, const std::vector<double>& y0,
+                         DP45Options opts = {}, const OutputOptions& out = {});
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_DORMAND_PRINCE_45_HPP_
@@ -0,0 +1,264 @@
+#ifndef CORE_ODE_ENSEMBLE_HPP_
+#define CORE_ODE_ENSEMBLE_HPP_
+
+/**
+ * @file ensemble.hpp
+ * @brief Batched integration of many trajectories of the same ODE system.
+ *
+ * This header declares ensemble solvers that integrate one model for many
+ * initial conditions or parameter sets at once. Members are stored in
+ * structure-of-arrays layout so that every stage is one batched right-hand
+ * side call (see @ref BasicBatchRhs) and a contiguous loop across members
+ * that the compiler can vectorise, and blocks of members are integrated
+ * concurrently on a thread pool. The solvers run in @c float or @c double;
+ * single precision doubles the number of members per vector register, while
+ * time stays in @c double.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "explicit_runge_kutta.hpp"
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Configuration options for ensemble integration.
+ */
+struct EnsembleOptions {
+  /// Number of worker threads. Zero selects the hardware concurrency.
+  std::size_t n_threads = 0;
+
+  /// Number of members integrated together in one block.
+  std::size_t block_size = 64;
+
+  /**
+   * @brief Record every @c stride -th step as well as the final step.
+   *
+   * A stride of zero records only the final state.
+   */
+  std::size_t stride = 0;
+
+  /// Keep the trajectory of every member in addition to the statistics.
+  bool store_members = true;
+};
+
+/**
+ * @brief Result of an ensemble integration.
+ *
+ * All trajectories share the recorded time points @c t. The moments are
+ * accumulated in @c double and stored in the state's scalar type.
+ *
+ * @tparam T Scalar type of the state, @c float or @c double.
+ */
+template <typename T>
+struct BasicEnsembleSolution {
+  /// Recorded time points.
+  std::vector<double> t;
+
+  /// Trajectory of each member (empty unless requested).
+  std::vector<BasicSolution<T>> members;
+
+  /// Ensemble mean of each state component at every recorded time.
+  BasicSolution<T> mean;
+
+  /// Population variance of each state component at every recorded time.
+  BasicSolution<T> variance;
+
+  /**
+   * @brief Work counters and wall time of the whole integration.
+   *
+   * @c n_rhs_evals counts batched right-hand side calls, one per stage per
+   * step per block. Per-phase times are not collected, as the blocks run
+   * concurrently.
+   */
+  Stats stats;
+};
+
+/// Ensemble result over @c double states.
+using EnsembleSolution = BasicEnsembleSolution<double>;
+
+/**
+ * @brief Integrate an ensemble of initial value problems with the classical
+ * fourth-order Runge–Kutta method.
+ *
+ * Every member obeys the same system \f$ dy/dt = f(t, y) \f$ over
+ * \f$[t_0, t_1]\f$ with the fixed step size @p h, but starts from its own
+ * initial state. Members are split into blocks of @p opts.block_size, each
+ * block is integrated independently on a worker thread, and within a block
+ * the RK4 stages are evaluated with a single batched right-hand side call
+ * and updated by contiguous loops across members.
+ *
+ * @tparam T Scalar type of the state, @c float or @c double, deduced from
+ *           @p y0. The stage updates run in @c T.
+ *
+ * @param f        Batched right-hand side function.
+ * @param t0       Initial time.
+ * @param t1       Final time.
+ * @param y0       Initial states, row-major with one row of @p n_states
+ *                 values per member.
+ * @param n_states Number of state components per member.
+ * @param h        Time step size (must be positive).
+ * @param opts     Threading, blocking and output options (optional).
+ *
+ * @return A @c BasicEnsembleSolution holding the recorded times, the member
+ *         trajectories (if requested) and the ensemble mean and variance.
+ *
+ * @throws std::invalid_argument If @p h <= 0, @p t1 <= @p t0, @p n_states
+ *         is zero, @p opts.block_size is zero, or the size of @p y0 is not a
+ *         multiple of @p n_states.
+ */
+template <typename T>
+BasicEnsembleSolution<T> EnsembleRungeKutta4(
+    const std::type_identity_t<BasicBatchRhs<T>>& f, const double& t0,
+    const double& t1, const std::vector<T>& y0, std::size_t n_states,
+    const double& h, EnsembleOptions opts = {});
+
+extern template BasicEnsembleSolution<float> EnsembleRungeKutta4<float>(
+    const BasicBatchRhs<float>&, const double&, const double&,
+    const std::vector<float>&, std::size_t, const double&, EnsembleOptions);
+extern template BasicEnsembleSolution<double> EnsembleRungeKutta4<double>(
+    const BasicBatchRhs<double>&, const double&, const double&,
+    const std::vector<double>&, std::size_t, const double&, EnsembleOptions);
+
+/**
+ * @brief Integrate an ensemble of @c double initial value problems with the
+ * classical fourth-order Runge–Kutta method.
+ *
+ * Non-template overload forwarding to @c EnsembleRungeKutta4<double>, so
+ * that @p y0 may be given as a braced list, which the template cannot
+ * deduce its scalar type from.
+ */
+EnsembleSolution EnsembleRungeKutta4(const BatchRhs& f, const double& t0,
+                                     const double& t1,
+                                     const std::vector<double>& y0,
+                                     std::size_t n_states, const double& h,
+                                     EnsembleOptions opts = {});
+
+/**
+ * @brief Advance the block state @p y by one step from time @p t in place.
+ *
+ * @tparam T Scalar type of the state, @c float or @c double.
+ */
+template <typename T>
+using EnsembleBlockStep = std::function<void(double t, std::vector<T>& y)>;
+
+/**
+ * @brief Create the step function of the block of @p count members starting
+ * at member @p first.
+ *
+ * @tparam T Scalar type of the state, @c float or @c double.
+ */
+template <typename T>
+using EnsembleStepFactory =
+    std::function<EnsembleBlockStep<T>(std::size_t first, std::size_t count)>;
+
+/**
+ * @brief Integrate an ensemble with a caller-supplied one-step method.
+ *
+ * This is the driver shared by the ensemble solvers. It validates the
+ * arguments, splits the members into blocks, transposes each block into
+ * structure-of-arrays layout, and records member trajectories and moments
+ * exactly as described for @c EnsembleRungeKutta4, while the method only
+ * supplies the step. @p make_step is called once per block on the worker
+ * thread that integrates it, so the step function it returns can own the
+ * block's stage storage.
+ *
+ * @param make_step          Factory of per-block step functions. It must be
+ *                           safe to call concurrently.
+ * @param t0                 Initial time.
+ * @param t1                 Final time.
+ * @param y0                 Initial states, row-major with one row of
+ *                           @p n_states values per member.
+ * @param n_states           Number of state components per member.
+ * @param h                  Time step size (must be positive).
+ * @param rhs_calls_per_step Batched right-hand side calls made by a step,
+ *                           used to fill @c stats.n_rhs_evals.
+ * @param opts               Threading, blocking and output options.
+ *
+ * @throws std::invalid_argument As @c EnsembleRungeKutta4.
+ */
+template <typename T>
+BasicEnsembleSolution<T> IntegrateEnsemble(
+    const std::type_identity_t<EnsembleStepFactory<T>>& make_step,
+    const double& t0, const double& t1, const std::vector<T>& y0,
+    std::size_t n_states, const double& h, std::size_t rhs_calls_per_step,
+    EnsembleOptions opts = {});
+
+extern template BasicEnsembleSolution<float> IntegrateEnsemble<float>(
+    const EnsembleStepFactory<float>&, const double&, const double&,
+    const std::vector<float>&, std::size_t, const double&, std::size_t,
+    EnsembleOptions);
+extern template BasicEnsembleSolution<double> IntegrateEnsemble<double>(
+    const EnsembleStepFactory<double>&, const double&, const double&,
+    const std::vector<double>&, std::size_t, const double&, std::size_t,
+    EnsembleOptions);
+
+/**
+ * @brief Integrate an ensemble of initial value problems with the explicit
+ * Runge–Kutta method given by @p Tableau.
+ *
+ * Works like @c EnsembleRungeKutta4 for any explicit tableau. Each block
+ * takes its steps with @c ExplicitRungeKuttaStep on the whole
+ * structure-of-arrays block, whose stage updates are elementwise, so every
+ * used stage is one batched call of @p f and one contiguous loop over the
+ * block. Stages whose slope the method never reads are skipped.
+ *
+ * @tparam Tableau A @c constexpr @c ButcherTableau with static storage
+ *                 duration, for example @ref kRungeKutta38Tableau.
+ * @tparam T       Scalar type of the state, @c float or @c double, deduced
+ *                 from @p y0.
+ *
+ * @param f        Batched right-hand side function.
+ * @param t0       Initial time.
+ * @param t1       Final time.
+ * @param y0       Initial states, row-major with one row of @p n_states
+ *                 values per member.
+ * @param n_states Number of state components per member.
+ * @param h        Time step size (must be positive).
+ * @param opts     Threading, blocking and output options (optional).
+ *
+ * @return A @c BasicEnsembleSolution holding the recorded times, the member
+ *         trajectories (if requested) and the ensemble mean and variance.
+ *
+ * @throws std::invalid_argument As @c EnsembleRungeKutta4.
+ */
+template <const auto& Tableau, typename T>
+BasicEnsembleSolution<T> EnsembleExplicitRungeKutta(
+    const std::type_identity_t<BasicBatchRhs<T>>& f, const double& t0,
+    const double& t1, const std::vector<T>& y0, std::size_t n_states,
+    const double& h, EnsembleOptions opts = {}) {
+  using Traits = TableauTraits<Tableau>;
+  using State = std::vector<T>;
+  constexpr std::size_t kCalls = [] {
+    std::size_t calls = 0;
+    for (std::size_t i = 0; i < Traits::kStages; ++i) {
+      if (Traits::StageUsed(i)) ++calls;
+    }
+    return calls;
+  }();
+
+  // The block's stage storage lives in the step function of its worker
+  auto make_step = [&f, n_states, h](std::size_t first, std::size_t count) {
+    auto rhs = [&f, first, count](double t, const State& y, State& dydt) {
+      f(t, y, dydt, first, count);
+    };
+    return EnsembleBlockStep<T>(
+        [rhs, h,
+         ws = ExplicitRKWorkspace<State, Traits::kStages>(
+             State(n_states * count))](double t, State& y) mutable {
+          ExplicitRungeKuttaStep<Tableau>(rhs, t, y, h, y, ws);
+        });
+  };
+  return IntegrateEnsemble<T>(make_step, t0, t1, y0, n_states, h, kCalls,
+                              opts);
+}
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_ENSEMBLE_HPP_
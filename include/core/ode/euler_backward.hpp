@@ -16,10 +16,64 @@
 
 #include <functional>
 
+#include "linear_solvers/sparsity_pattern.hpp"
+#include "output.hpp"
+#include "rhs.hpp"
 #include "solution.hpp"
 
 namespace vanta::ode {
 
+/**
+ * @brief Configuration options for the backward Euler solver.
+ *
+ * Each step is solved by modified Newton iteration: the iteration matrix
+ * \f$ I - hJ \f$ and its LU factors are kept across iterations and steps, and
+ * the Jacobian is only re-evaluated when the iteration contracts too slowly
+ * or fails to converge.
+ */
+struct EBOptions {
+  /// Analytic Jacobian. If empty, forward differences are used.
+  Jacobian jacobian;
+
+  /**
+   * @brief Sparsity pattern of the Jacobian (optional).
+   *
+   * If set, the Jacobian is differenced with column compression, stored in
+   * CSR form and factorised with a sparse LU, and @c jacobian must write the
+   * nonzero values in the pattern's order.
+   */
+  vanta::linear_solvers::SparsityPattern sparsity;
+
+  /**
+   * @brief Batched form of the right-hand side (optional).
+   *
+   * If set and @c jacobian is empty, the perturbed states of each
+   * finite-difference Jacobian are evaluated in one call of it instead of
+   * one call of f per column or column colour. It must agree with f.
+   */
+  BatchRhs batch_rhs;
+
+  /**
+   * @brief Newton convergence tolerance.
+   *
+   * Iteration stops when the residual norm falls below @c tol or the update
+   * norm falls below @c tol times (1 + the state norm).
+   */
+  double tol = 1e-10;
+
+  /// Maximum number of Newton iterations per attempt.
+  int max_iters = 10;
+
+  /**
+   * @brief Contraction rate above which the Jacobian is refreshed.
+   *
+   * The ratio of successive residual norms is monitored, and a converged
+   * step that contracted more slowly than this schedules a new Jacobian for
+   * the next step.
+   */
+  double jacobian_rate = 0.5;
+};
+
 /**
  * @brief Solve an initial value problem using the backward (implicit) Euler
  * method.
@@ -33,23 +87,54 @@ namespace vanta::ode {
  * explicit Euler method, the backward Euler method is implicit and generally
  * more stable, especially for stiff problems.
  *
- * @param f   Right-hand side function defining the ODE system. It takes the
+ * @param f    Right-hand side function defining the ODE system. It takes the
  * current time and state vector and returns the time derivative.
- * @param t0  Initial time.
- * @param t1  Final time.
- * @param y0  Initial state vector at time \f$t_0\f$.
- * @param h   Time step size.
+ * @param t0   Initial time.
+ * @param t1   Final time.
+ * @param y0   Initial state vector at time \f$t_0\f$.
+ * @param h    Time step size.
+ * @param opts Newton iteration and Jacobian options (optional).
+ * @param out  Output selection and streaming options (optional). By default
+ *             every step is stored.
  *
  * @return A @c Solution object containing the time grid and corresponding
- * numerical solution values.
+ * numerical solution values. Its @c stats report the number of right-hand
+ * side evaluations, Jacobian evaluations and factorisations.
+ *
+ * @throws std::invalid_argument If @p h <= 0 or @p t1 <= @p t0.
+ * @throws std::runtime_error    If the Newton iteration fails to converge
+ *         even with a freshly evaluated Jacobian.
  *
  * @note This method is first-order accurate but unconditionally stable for
  * linear problems, making it suitable for stiff ODEs.
  */
-Solution EulerBackward(const std::function<std::vector<double>(
-                           const double&, const std::vector<double>&)>& f,
-                       const double& t0, const double& t1,
-                       const std::vector<double>& y0, const double& h);
+Solution EulerBackward(const Rhs& f, const double& t0, const double& t1,
+                       const std::vector<double>& y0, const double& h,
+                       const EBOptions& opts = {},
+                       const OutputOptions& out = {});
+
+/**
+ * @brief Solve an initial value problem using the backward Euler method with
+ * an in-place right-hand side.
+ *
+ * Same as the overload above, but the state buffers, Jacobian and LU factors
+ * are allocated once up front.
+ *
+ * @param f    In-place right-hand side function.
+ * @param t0   Initial time.
+ * @param t1   Final time.
+ * @param y0   Initial state vector at time \f$t_0\f$.
+ * @param h    Time step size.
+ * @param opts Newton iteration and Jacobian options (optional).
+ * @param out  Output selection and streaming options (optional).
+ *
+ * @return A @c Solution object containing the time grid and corresponding
+ * numerical solution values.
+ */
+Solution EulerBackward(const InPlaceRhs& f, const double& t0, const double& t1,
+                       const std::vector<double>& y0, const double& h,
+                       const EBOptions& opts = {},
+                       const OutputOptions& out = {});
 
 }  // namespace vanta::ode
 
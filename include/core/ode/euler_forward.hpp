@@ -17,6 +17,7 @@
 
 #include <functional>
 
+#include "output.hpp"
 #include "solution.hpp"
 
 namespace vanta::ode {
@@ -38,6 +39,8 @@ namespace vanta::ode {
  * @param t1  Final time.
  * @param y0  Initial state vector at time \f$t_0\f$.
  * @param h   Time step size.
+ * @param out Output selection and streaming options (optional). By default
+ *            every step is stored.
  *
  * @return A @c Solution object containing the time grid and corresponding
  * numerical solution values.
@@ -48,7 +51,8 @@ namespace vanta::ode {
 Solution EulerForward(const std::function<std::vector<double>(
                           const double&, const std::vector<double>&)>& f,
                       const double& t0, const double& t1,
-                      const std::vector<double>& y0, const double& h);
+                      const std::vector<double>& y0, const double& h,
+                      const OutputOptions& out = {});
 
 }  // namespace vanta::ode
 
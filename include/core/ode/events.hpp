@@ -0,0 +1,130 @@
+#ifndef CORE_ODE_EVENTS_HPP_
+#define CORE_ODE_EVENTS_HPP_
+
+/**
+ * @file events.hpp
+ * @brief Zero-crossing event detection for ODE solvers.
+ *
+ * An event is a scalar function \f$ g(t, y) \f$ of the solution. After every
+ * accepted step the solver checks each event for a sign change between the
+ * ends of the step and, if one is found, locates the crossing time by root
+ * finding on the cubic Hermite interpolant of the step. Terminal events stop
+ * the integration at the crossing, so no work is spent and no output is
+ * stored past it.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Event function whose zero crossings are detected.
+ */
+using EventFunction =
+    std::function<double(double t, std::span<const double> y)>;
+
+/**
+ * @brief A zero-crossing event of the solution.
+ */
+struct Event {
+  /// Event function \f$ g(t, y) \f$.
+  EventFunction g;
+
+  /// Stop the integration at the first crossing.
+  bool terminal = false;
+
+  /**
+   * @brief Crossing direction to detect.
+   *
+   * Positive detects only crossings where @c g increases through zero,
+   * negative only crossings where it decreases, and zero both.
+   */
+  int direction = 0;
+};
+
+/**
+ * @brief Detects and locates event crossings step by step.
+ *
+ * The solver, normally through @c OutputRecorder, calls @c Start() with the
+ * initial point and @c Step() with the end point of every accepted step.
+ * A crossing requires @c g to be strictly nonzero at the start of the step,
+ * so an event that lands exactly on a step end is reported once.
+ */
+class EventLocator {
+ public:
+  /**
+   * @brief Create a locator for a system with @p n_states components.
+   *
+   * @param events   Events to detect. Must outlive the locator.
+   * @param n_states Number of state components.
+   *
+   * @throws std::invalid_argument If an event has no function.
+   */
+  EventLocator(const std::vector<Event>& events, std::size_t n_states);
+
+  /// True if there are events to detect.
+  bool Active() const { return !events_.empty(); }
+
+  /**
+   * @brief Set the initial point.
+   *
+   * @param t0 Initial time.
+   * @param y0 Initial state.
+   * @param f0 Derivative at the initial point.
+   */
+  void Start(double t0, std::span<const double> y0,
+             std::span<const double> f0);
+
+  /**
+   * @brief Check the step from the previous point to @p t for crossings.
+   *
+   * Every crossing found is recorded in time order. If one of them belongs
+   * to a terminal event, later crossings are discarded and the terminal
+   * point is available from @c Time() and @c State().
+   *
+   * @param t End time of the step.
+   * @param y State at @p t.
+   * @param f Derivative at @p t.
+   *
+   * @return True if a terminal event occurred in the step.
+   */
+  bool Step(double t, std::span<const double> y, std::span<const double> f);
+
+  /// Time of the terminal event after @c Step() returned true.
+  double Time() const { return t_event_; }
+
+  /// State at the terminal event after @c Step() returned true.
+  std::span<const double> State() const { return y_event_; }
+
+  /// Move the recorded crossings out of the locator.
+  std::vector<EventRecord> TakeRecords() { return std::move(records_); }
+
+ private:
+  // Locate the crossing of event k inside the current step
+  double Locate(std::size_t k);
+
+  const std::vector<Event>& events_;
+
+  // Previous and current step end points
+  double t_prev_ = 0.0;
+  std::vector<double> y_prev_, f_prev_, g_prev_;
+  double t_ = 0.0;
+  std::span<const double> y_, f_;
+  std::vector<double> g_;
+
+  // Interpolated state and terminal event point
+  std::vector<double> y_interp_;
+  double t_event_ = 0.0;
+  std::vector<double> y_event_;
+
+  std::vector<EventRecord> records_;
+};
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_EVENTS_HPP_
@@ -0,0 +1,397 @@
+#ifndef CORE_ODE_EXPLICIT_RUNGE_KUTTA_HPP_
+#define CORE_ODE_EXPLICIT_RUNGE_KUTTA_HPP_
+
+/**
+ * @file explicit_runge_kutta.hpp
+ * @brief Explicit Runge–Kutta engine driven by compile-time Butcher
+ * tableaux.
+ *
+ * An explicit Runge–Kutta method is fully described by its Butcher tableau
+ * \f$ (A, b, c) \f$:
+ * \f[
+ *    k_i = f\Big(t_n + c_i h,\; y_n + h \sum_{j<i} a_{ij} k_j\Big), \qquad
+ *    y_{n+1} = y_n + h \sum_i b_i k_i.
+ * \f]
+ * The solvers in this header take the tableau as a @c constexpr template
+ * argument. The stage sums are expanded at compile time over the nonzero
+ * coefficients only, stages whose slope is never used are not evaluated,
+ * small fixed-size states are updated element by element without a loop,
+ * and the stage buffers are allocated once per solve, so each method runs
+ * as fast as a hand-written kernel (checked by the benchmark in
+ * benchmarks/core/ode). A new method needs only a new tableau.
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "output.hpp"
+#include "phase_timer.hpp"
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Butcher tableau of an explicit Runge–Kutta method with @p S
+ * stages.
+ *
+ * @tparam S Number of stages.
+ */
+template <std::size_t S>
+struct ButcherTableau {
+  /// Number of stages.
+  static constexpr std::size_t kStages = S;
+
+  /// Stage coefficients; only the strictly lower triangle may be nonzero.
+  std::array<std::array<double, S>, S> a{};
+
+  /// Weights of the stage slopes in the step update.
+  std::array<double, S> b{};
+
+  /// Stage times as fractions of the step.
+  std::array<double, S> c{};
+};
+
+/// Forward Euler, first order.
+inline constexpr ButcherTableau<1> kEulerTableau = {{{{0.0}}}, {1.0}, {0.0}};
+
+/// Heun's method (explicit trapezoidal rule), second order.
+inline constexpr ButcherTableau<2> kHeunTableau = {
+    {{{0.0, 0.0}, {1.0, 0.0}}}, {0.5, 0.5}, {0.0, 1.0}};
+
+/// Three-stage strong-stability-preserving method of Shu and Osher, third
+/// order.
+inline constexpr ButcherTableau<3> kSSPRK3Tableau = {
+    {{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.25, 0.25, 0.0}}},
+    {1.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0},
+    {0.0, 1.0, 0.5}};
+
+/// Classical Runge–Kutta method, fourth order.
+inline constexpr ButcherTableau<4> kRungeKutta4Tableau = {
+    {{{0.0, 0.0, 0.0, 0.0},
+      {0.5, 0.0, 0.0, 0.0},
+      {0.0, 0.5, 0.0, 0.0},
+      {0.0, 0.0, 1.0, 0.0}}},
+    {1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0},
+    {0.0, 0.5, 0.5, 1.0}};
+
+/// Kutta's 3/8 rule, fourth order.
+inline constexpr ButcherTableau<4> kRungeKutta38Tableau = {
+    {{{0.0, 0.0, 0.0, 0.0},
+      {1.0 / 3.0, 0.0, 0.0, 0.0},
+      {-1.0 / 3.0, 1.0, 0.0, 0.0},
+      {1.0, -1.0, 1.0, 0.0}}},
+    {1.0 / 8.0, 3.0 / 8.0, 3.0 / 8.0, 1.0 / 8.0},
+    {0.0, 1.0 / 3.0, 2.0 / 3.0, 1.0}};
+
+/**
+ * @brief Fifth-order solution of the Dormand–Prince 5(4) pair.
+ *
+ * The seventh stage only serves the embedded error estimate, so its weight
+ * is zero and the fixed-step engine skips it.
+ */
+inline constexpr ButcherTableau<7> kDormandPrince5Tableau = {
+    {{{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0, 0.0},
+      {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0,
+       -212.0 / 729.0, 0.0, 0.0, 0.0},
+      {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0,
+       -5103.0 / 18656.0, 0.0, 0.0},
+      {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0,
+       11.0 / 84.0, 0.0}}},
+    {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0,
+     11.0 / 84.0, 0.0},
+    {0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0}};
+
+/**
+ * @brief Compile-time properties of a Butcher tableau.
+ *
+ * @tparam Tableau A @c constexpr @c ButcherTableau with static storage
+ *                 duration.
+ */
+template <const auto& Tableau>
+struct TableauTraits {
+  /// Number of stages.
+  static constexpr std::size_t kStages =
+      std::remove_cvref_t<decltype(Tableau)>::kStages;
+
+  /// True if the slope of stage @p i feeds a later stage or the update.
+  static constexpr bool StageUsed(std::size_t i) {
+    if (Tableau.b[i] != 0.0) return true;
+    for (std::size_t r = i + 1; r < kStages; ++r) {
+      if (Tableau.a[r][i] != 0.0) return true;
+    }
+    return false;
+  }
+
+  /// Number of stages evaluated per step.
+  static constexpr std::size_t NumUsedStages() {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < kStages; ++i) {
+      if (StageUsed(i)) ++count;
+    }
+    return count;
+  }
+
+  /// Number of nonzero coefficients in row @p i of @c a.
+  static constexpr std::size_t NumNonZeroA(std::size_t i) {
+    std::size_t count = 0;
+    for (std::size_t j = 0; j < i; ++j) {
+      if (Tableau.a[i][j] != 0.0) ++count;
+    }
+    return count;
+  }
+
+  /// Columns of the nonzero coefficients in row @p I of @c a.
+  template <std::size_t I>
+  static constexpr auto NonZeroA() {
+    std::array<std::size_t, NumNonZeroA(I)> cols{};
+    std::size_t count = 0;
+    for (std::size_t j = 0; j < I; ++j) {
+      if (Tableau.a[I][j] != 0.0) cols[count++] = j;
+    }
+    return cols;
+  }
+
+  /// Number of nonzero weights.
+  static constexpr std::size_t NumNonZeroB() {
+    std::size_t count = 0;
+    for (double b : Tableau.b) {
+      if (b != 0.0) ++count;
+    }
+    return count;
+  }
+
+  /// Stages with nonzero weights.
+  static constexpr auto NonZeroB() {
+    std::array<std::size_t, NumNonZeroB()> stages{};
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < kStages; ++i) {
+      if (Tableau.b[i] != 0.0) stages[count++] = i;
+    }
+    return stages;
+  }
+
+  /// True if @c a is strictly lower triangular.
+  static constexpr bool IsExplicit() {
+    for (std::size_t i = 0; i < kStages; ++i) {
+      for (std::size_t j = i; j < kStages; ++j) {
+        if (Tableau.a[i][j] != 0.0) return false;
+      }
+    }
+    return true;
+  }
+
+  /// True if the weights sum to one and each @c c is its row sum of @c a.
+  static constexpr bool IsConsistent() {
+    constexpr double kTol = 1e-12;
+    double b_sum = -1.0;
+    for (std::size_t i = 0; i < kStages; ++i) {
+      double row_sum = -Tableau.c[i];
+      for (std::size_t j = 0; j < i; ++j) row_sum += Tableau.a[i][j];
+      if (row_sum > kTol || row_sum < -kTol) return false;
+      b_sum += Tableau.b[i];
+    }
+    return b_sum <= kTol && b_sum >= -kTol;
+  }
+};
+
+/**
+ * @brief Stage storage for an explicit Runge–Kutta method.
+ *
+ * @tparam State State type, @c std::vector<double> or
+ *               @c std::array<double, N>.
+ * @tparam S     Number of stages.
+ */
+template <typename State, std::size_t S>
+struct ExplicitRKWorkspace {
+  /**
+   * @brief Allocate stage storage shaped like @p y.
+   *
+   * @param y State whose size the buffers take.
+   */
+  explicit ExplicitRKWorkspace(const State& y) : y_stage(y) { k.fill(y); }
+
+  /// Stage slopes.
+  std::array<State, S> k;
+
+  /// State at which the current stage slope is evaluated.
+  State y_stage;
+};
+
+/**
+ * @brief Call @p op with every index of @p y.
+ *
+ * Small fixed-size states are expanded at compile time rather than looped
+ * over, so their elements stay in registers between right-hand side calls
+ * instead of being stored for a vectorised loop and reloaded.
+ *
+ * @param y  State whose indices are visited.
+ * @param op Callable taking a @c std::size_t index.
+ */
+template <typename State, typename Op>
+void ForEachIndex(const State& y, Op op) {
+  if constexpr (requires { requires std::tuple_size<State>::value <= 16; }) {
+    [&]<std::size_t... J>(std::index_sequence<J...>) {
+      (op(J), ...);
+    }(std::make_index_sequence<std::tuple_size_v<State>>{});
+  } else {
+    for (std::size_t j = 0; j < y.size(); ++j) op(j);
+  }
+}
+
+/**
+ * @brief Advance a state by one step of the method given by @p Tableau.
+ *
+ * @tparam Tableau A @c constexpr @c ButcherTableau with static storage
+ *                 duration.
+ *
+ * @param f      Right-hand side functor satisfying @ref StateRhs.
+ * @param t      Time at the start of the step.
+ * @param y      State at the start of the step.
+ * @param h      Step size.
+ * @param y_next Output state at @p t + @p h. May alias @p y.
+ * @param ws     Workspace sized for the system.
+ */
+template <const auto& Tableau, typename F, typename State>
+  requires StateRhs<F, State>
+void ExplicitRungeKuttaStep(
+    F& f, double t, const State& y, double h, State& y_next,
+    ExplicitRKWorkspace<State, TableauTraits<Tableau>::kStages>& ws) {
+  using Traits = TableauTraits<Tableau>;
+  using T = typename State::value_type;
+  static_assert(Traits::IsExplicit(), "Tableau must be explicit.");
+  static_assert(Traits::IsConsistent(), "Tableau must be consistent.");
+
+  // Evaluate the used stages, summing over nonzero coefficients only
+  auto stage = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+    if constexpr (Traits::StageUsed(I)) {
+      constexpr auto cols = Traits::template NonZeroA<I>();
+      if constexpr (cols.empty()) {
+        f(t + Tableau.c[I] * h, y, ws.k[I]);
+      } else {
+        // Coefficients are scaled by h once and applied in the state's
+        // precision, so float states keep float-wide vector lanes
+        [&]<std::size_t... M>(std::index_sequence<M...>) {
+          const T ha[] = {static_cast<T>(h * Tableau.a[I][cols[M]])...};
+          ForEachIndex(y, [&](std::size_t j) {
+            ws.y_stage[j] = y[j] + ((ha[M] * ws.k[cols[M]][j]) + ...);
+          });
+        }(std::make_index_sequence<cols.size()>{});
+        f(t + Tableau.c[I] * h, static_cast<const State&>(ws.y_stage),
+          ws.k[I]);
+      }
+    }
+  };
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    (stage(std::integral_constant<std::size_t, I>{}), ...);
+  }(std::make_index_sequence<Traits::kStages>{});
+
+  // Combine the weighted slopes
+  constexpr auto stages = Traits::NonZeroB();
+  [&]<std::size_t... M>(std::index_sequence<M...>) {
+    const T hb[] = {static_cast<T>(h * Tableau.b[stages[M]])...};
+    ForEachIndex(y, [&](std::size_t j) {
+      y_next[j] = y[j] + ((hb[M] * ws.k[stages[M]][j]) + ...);
+    });
+  }(std::make_index_sequence<stages.size()>{});
+}
+
+/**
+ * @brief Solve an initial value problem with the explicit Runge–Kutta
+ * method given by @p Tableau.
+ *
+ * Validates the arguments, takes fixed steps of size @p h from @p t0 until
+ * @p t1 is reached and records them through @c OutputRecorder, with stage
+ * buffers allocated once before stepping (on the stack for
+ * @c std::array states).
+ *
+ * @tparam Tableau A @c constexpr @c ButcherTableau with static storage
+ *                 duration, for example @ref kRungeKutta4Tableau.
+ * @tparam F       Right-hand side functor satisfying @ref StateRhs.
+ * @tparam State   State type, @c std::vector<T> or @c std::array<T, N>
+ *                 with @c T either @c float or @c double. Stages are
+ *                 computed in @c T while time is accumulated in @c double,
+ *                 so a float solve keeps the exact time grid.
+ *
+ * @param f   Right-hand side functor.
+ * @param t0  Initial time.
+ * @param t1  Final time.
+ * @param y0  Initial state at time \f$t_0\f$.
+ * @param h   Time step size (must be positive).
+ * @param out Output selection and streaming options (optional).
+ *
+ * @return A @c BasicSolution of the state's scalar type containing the time
+ *         grid and corresponding numerical solution vectors.
+ *
+ * @throws std::invalid_argument If @p h <= 0 or @p t1 <= @p t0.
+ */
+template <const auto& Tableau, typename F, typename State>
+  requires StateRhs<F, State>
+BasicSolution<typename State::value_type> ExplicitRungeKutta(
+    F&& f, double t0, double t1, const State& y0, double h,
+    const OutputOptions& out = {}) {
+  using T = typename State::value_type;
+
+  // Validate input arguments
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+
+  // Work counters, with the stepper's right-hand side calls timed and
+  // counted from the number of steps after stepping
+  Stats stats;
+  PhaseTimer total_timer(stats.time.total);
+  auto rhs = [&f, &stats](double t, const State& y, State& dydt) {
+    PhaseTimer timer(stats.time.rhs);
+    f(t, y, dydt);
+  };
+
+  // Compute the number of integration steps
+  const auto steps = static_cast<int>(std::ceil((t1 - t0) / h));
+
+  // Initialise output recording
+  BasicOutputRecorder<T> recorder(out, y0.size(), steps,
+                                  out.events.empty() && !out.dense
+                                      ? BasicInPlaceRhs<T>()
+                                      : ToInPlaceRhs(f, y0));
+  recorder.Start(t0, y0);
+
+  // Current time and state, and stage storage
+  double t = t0;
+  State y = y0;
+  ExplicitRKWorkspace<State, TableauTraits<Tableau>::kStages> ws(y0);
+
+  // Perform time stepping
+  for (int i = 0; i < steps; ++i) {
+    ExplicitRungeKuttaStep<Tableau>(rhs, t, y, h, y, ws);
+
+    // Advance time
+    t += h;
+    stats.n_accepted++;
+    if (recorder.Step(t, y)) break;
+  }
+
+  // Return the computed solution with work counters
+  BasicSolution<T> sol = recorder.Finish();
+  stats.n_rhs_evals =
+      stats.n_accepted * TableauTraits<Tableau>::NumUsedStages() +
+      recorder.NumRhsEvals();
+  total_timer.Stop();
+  sol.stats = stats;
+  return sol;
+}
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_EXPLICIT_RUNGE_KUTTA_HPP_
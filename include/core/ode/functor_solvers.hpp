@@ -0,0 +1,98 @@
+#ifndef CORE_ODE_FUNCTOR_SOLVERS_HPP_
+#define CORE_ODE_FUNCTOR_SOLVERS_HPP_
+
+/**
+ * @file functor_solvers.hpp
+ * @brief Header-only explicit ODE solvers taking the right-hand side as a
+ * template functor.
+ *
+ * The solvers in this header accept any callable as the right-hand side and
+ * any contiguous state type, instead of a @c std::function over
+ * @c std::vector. The right-hand side call is therefore resolved at compile
+ * time and can be inlined into the stepping loop. With a
+ * @c std::array<double, N> state the stage buffers live on the stack and the
+ * loops over the state have a compile-time trip count, so small systems
+ * compile down to fully unrolled, register-resident code. Both solvers run
+ * on the tableau engine in explicit_runge_kutta.hpp, and a @c float state
+ * gives a @c float solution with twice the vector width.
+ */
+
+#include <utility>
+
+#include "explicit_runge_kutta.hpp"
+#include "output.hpp"
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Solve an initial value problem using the forward Euler method with
+ * a template right-hand side.
+ *
+ * Equivalent to the @c std::function overload of @c EulerForward, but the
+ * right-hand side is called directly and writes into a preallocated
+ * derivative of the same type as the state.
+ *
+ * @tparam F     Right-hand side functor satisfying @ref StateRhs.
+ * @tparam State State type, @c std::vector<T> or @c std::array<T, N>
+ *               with @c T either @c float or @c double.
+ *
+ * @param f   Right-hand side functor.
+ * @param t0  Initial time.
+ * @param t1  Final time.
+ * @param y0  Initial state at time \f$t_0\f$.
+ * @param h   Time step size (must be positive).
+ * @param out Output selection and streaming options (optional).
+ *
+ * @return A @c BasicSolution of the state's scalar type containing the
+ *         time grid and corresponding numerical solution vectors.
+ *
+ * @throws std::invalid_argument If @p h <= 0 or @p t1 <= @p t0.
+ */
+template <typename F, typename State>
+  requires StateRhs<F, State>
+BasicSolution<typename State::value_type> EulerForward(
+    F&& f, double t0, double t1, const State& y0, double h,
+    const OutputOptions& out = {}) {
+  return ExplicitRungeKutta<kEulerTableau>(std::forward<F>(f), t0, t1, y0, h,
+                                           out);
+}
+
+/**
+ * @brief Solve an initial value problem using the classical fourth-order
+ * Runge–Kutta method with a template right-hand side.
+ *
+ * Equivalent to the @c std::function overloads of @c RungeKutta4, but the
+ * right-hand side is called directly and the stage slopes are held in
+ * objects of the state type, allocated once before stepping (on the stack
+ * for @c std::array states).
+ *
+ * @tparam F     Right-hand side functor satisfying @ref StateRhs.
+ * @tparam State State type, @c std::vector<T> or @c std::array<T, N>
+ *               with @c T either @c float or @c double.
+ *
+ * @param f   Right-hand side functor.
+ * @param t0  Initial time.
+ * @param t1  Final time.
+ * @param y0  Initial state at time \f$t_0\f$.
+ * @param h   Time step size (must be positive).
+ * @param out Output selection and streaming options (optional).
+ *
+ * @return A @c BasicSolution of the state's scalar type containing the
+ *         time grid and corresponding numerical solution vectors.
+ *
+ * @throws std::invalid_argument If @p h <= 0 or @p t1 <= @p t0.
+ */
+template <typename F, typename State>
+  requires StateRhs<F, State>
+BasicSolution<typename State::value_type> RungeKutta4(
+    F&& f, double t0, double t1, const State& y0, double h,
+    const OutputOptions& out = {}) {
+  return ExplicitRungeKutta<kRungeKutta4Tableau>(std::forward<F>(f), t0, t1,
+                                                 y0, h, out);
+}
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_FUNCTOR_SOLVERS_HPP_
@@ -0,0 +1,86 @@
+#ifndef CORE_ODE_INTERPOLATION_HPP_
+#define CORE_ODE_INTERPOLATION_HPP_
+
+/**
+ * @file interpolation.hpp
+ * @brief Dense output between solver steps.
+ *
+ * Any solver that knows the state and its derivative at both ends of a step
+ * can evaluate the solution inside the step with a cubic Hermite
+ * interpolant. The interpolant is third-order accurate, independent of the
+ * order of the method that produced the end points. A stored trajectory
+ * is evaluated the same way on the step containing the requested time.
+ */
+
+#include <span>
+
+namespace vanta::ode {
+
+/**
+ * @brief Evaluate the cubic Hermite interpolant of a step at time @p t.
+ *
+ * @param t0  Time at the start of the step.
+ * @param y0  State at @p t0.
+ * @param f0  Derivative at @p t0.
+ * @param t1  Time at the end of the step, different from @p t0.
+ * @param y1  State at @p t1.
+ * @param f1  Derivative at @p t1.
+ * @param t   Evaluation time, normally in \f$ [t_0, t_1] \f$.
+ * @param out Interpolated state at @p t; may not alias the inputs.
+ */
+void HermiteInterpolate(double t0, std::span<const double> y0,
+                        std::span<const double> f0, double t1,
+                        std::span<const double> y1,
+                        std::span<const double> f1, double t,
+                        std::span<double> out);
+
+/**
+ * @brief Evaluate the cubic Hermite interpolant of a single-precision step.
+ *
+ * Same as the overload above. The basis weights are computed in double
+ * precision.
+ */
+void HermiteInterpolate(double t0, std::span<const float> y0,
+                        std::span<const float> f0, double t1,
+                        std::span<const float> y1, std::span<const float> f1,
+                        double t, std::span<float> out);
+
+/**
+ * @brief Evaluate a stored trajectory at time @p time.
+ *
+ * The state is interpolated with the cubic Hermite interpolant of the step
+ * containing @p time. If @p dydt is empty the derivatives at the step ends
+ * are estimated from three neighbouring samples, which keeps the
+ * interpolant third-order accurate on smooth solutions. The step is located
+ * in O(1) on uniform grids and by binary search otherwise.
+ *
+ * @param t    Increasing time points.
+ * @param y    Row-major states, @c out.size() values per time point.
+ * @param dydt Row-major derivatives laid out like @p y, or empty.
+ * @param time Evaluation time in \f$ [t_0, t_{N-1}] \f$.
+ * @param out  Interpolated state.
+ * @param work Scratch of @c 2 * out.size() values for the estimated
+ *             derivatives; allocated internally if smaller.
+ *
+ * @throws std::invalid_argument If @p t is empty or @p time lies outside
+ *         it.
+ */
+void InterpolateTrajectory(std::span<const double> t,
+                           std::span<const double> y,
+                           std::span<const double> dydt, double time,
+                           std::span<double> out,
+                           std::span<double> work = {});
+
+/**
+ * @brief Evaluate a stored single-precision trajectory at time @p time.
+ *
+ * Same as the overload above.
+ */
+void InterpolateTrajectory(std::span<const double> t,
+                           std::span<const float> y,
+                           std::span<const float> dydt, double time,
+                           std::span<float> out, std::span<float> work = {});
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_INTERPOLATION_HPP_
@@ -0,0 +1,187 @@
+#ifndef CORE_ODE_ITERATION_MATRIX_HPP_
+#define CORE_ODE_ITERATION_MATRIX_HPP_
+
+/**
+ * @file iteration_matrix.hpp
+ * @brief Cached Newton iteration matrix for implicit ODE solvers.
+ *
+ * Implicit methods solve a nonlinear system with the matrix
+ * \f$ M = I - \gamma J \f$ at every step, where @c J is the Jacobian of the
+ * right-hand side and \f$ \gamma \f$ depends on the method and step size.
+ * This header declares a helper that owns @c J and the LU factors of @c M so
+ * that solvers can reuse them across Newton iterations and steps, and
+ * refresh them only when convergence slows or \f$ \gamma \f$ changes.
+ *
+ * Given a sparsity pattern, the Jacobian is stored, differenced and factorised
+ * in sparse form, so the cost scales with the number of nonzeros. Given a
+ * batched right-hand side, all perturbed states of a finite-difference
+ * Jacobian are evaluated in one call.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "finite_difference/forward_difference.hpp"
+#include "linear_solvers/lu_decomposition.hpp"
+#include "linear_solvers/sparse_lu.hpp"
+#include "linear_solvers/sparsity_pattern.hpp"
+#include "rhs.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Jacobian and LU factors of \f$ I - \gamma J \f$ for modified Newton.
+ */
+class IterationMatrix {
+ public:
+  /**
+   * @brief Construct an empty iteration matrix for an n-dimensional system.
+   *
+   * @param f        Right-hand side, used for finite differences.
+   * @param jacobian Analytic Jacobian. If empty, the Jacobian is
+   *                 approximated by forward differences of @p f.
+   * @param n        Number of state components.
+   * @param sparsity Sparsity pattern of the Jacobian (optional). If empty,
+   *                 dense storage and LU are used. Otherwise @p jacobian must
+   *                 write the nonzero values in the pattern's CSR order.
+   * @param batch_f  Batched form of @p f (optional). If set, finite
+   *                 differences evaluate all perturbed states, one per
+   *                 column or per column colour, in one call of it.
+   *
+   * @p f and @p jacobian are referenced, not copied, and must outlive this
+   * object. All storage is allocated here, so updating, factorising and
+   * solving do not allocate, provided @p batch_f does not.
+   *
+   * @throws std::invalid_argument If @p sparsity is malformed or its size
+   *         differs from @p n.
+   */
+  IterationMatrix(const InPlaceRhs& f, const Jacobian& jacobian,
+                  std::size_t n,
+                  const vanta::linear_solvers::SparsityPattern& sparsity = {},
+                  BatchRhs batch_f = {});
+
+  // The differencing callable refers back to this object
+  IterationMatrix(const IterationMatrix&) = delete;
+  IterationMatrix& operator=(const IterationMatrix&) = delete;
+
+  /**
+   * @brief Re-evaluate the Jacobian at (@p t, @p y).
+   *
+   * @param t  Time.
+   * @param y  State.
+   * @param fy Value of f(t, y), reused by the finite-difference
+   *           approximation.
+   */
+  void UpdateJacobian(double t, std::span<const double> y,
+                      std::span<const double> fy);
+
+  /**
+   * @brief Form and factorise \f$ I - \gamma J \f$.
+   *
+   * Does nothing if the factors are already current for the present
+   * Jacobian and @p gamma.
+   *
+   * @throws std::runtime_error If the matrix is singular.
+   */
+  void Factorise(double gamma);
+
+  /**
+   * @brief Solve \f$ (I - \gamma J) x = b \f$ in place.
+   *
+   * @param b Right-hand side on entry, solution on exit.
+   */
+  void Solve(std::span<double> b) const;
+
+  /**
+   * @brief Estimate the spectral radius of the current Jacobian.
+   *
+   * Runs a fixed number of power iterations and takes the average growth
+   * rate over the second half, so complex conjugate pairs are handled as
+   * well as real dominant eigenvalues. Costs a few dozen matrix-vector
+   * products and no right-hand side evaluations.
+   *
+   * @return An estimate of the largest eigenvalue magnitude, or zero if no
+   *         Jacobian has been evaluated.
+   */
+  double SpectralRadius() const;
+
+  /// True once a Jacobian has been evaluated.
+  bool HasJacobian() const { return has_jacobian_; }
+
+  /// Number of state components.
+  std::size_t Size() const { return n_; }
+
+  /// True if the Jacobian is stored in sparse form.
+  bool IsSparse() const { return !sparsity_.Empty(); }
+
+  /**
+   * @brief Current Jacobian.
+   *
+   * Row-major and dense, or the nonzero values in CSR order if sparse.
+   */
+  std::span<const double> JacobianMatrix() const { return jac_; }
+
+  /// Number of Jacobian evaluations so far.
+  std::size_t NumJacobianEvals() const { return n_jacobian_evals_; }
+
+  /// Number of factorisations so far.
+  std::size_t NumFactorisations() const { return n_factorisations_; }
+
+  /**
+   * @brief Number of right-hand side evaluations spent on finite
+   * differences.
+   *
+   * Counts evaluated states, so a batched call over k states counts k.
+   */
+  std::size_t NumRhsEvals() const { return n_rhs_evals_; }
+
+  /// Seconds spent evaluating Jacobians so far.
+  double JacobianTime() const { return jacobian_time_; }
+
+  /// Seconds spent factorising and solving so far.
+  double LinearSolveTime() const { return linear_solve_time_; }
+
+ private:
+  const InPlaceRhs& f_;
+  const Jacobian& jacobian_;
+  BatchRhs batch_f_;
+  std::size_t n_;
+
+  std::vector<double> jac_;
+  std::vector<double> matrix_;
+
+  // f and its batched form at the time of the current Jacobian update, built
+  // once for differencing, and the differencing scratch
+  std::function<void(std::span<const double>, std::span<double>)> f_at_t_;
+  vanta::finite_difference::BatchFunction batch_at_t_;
+  double t_ = 0.0;
+  std::vector<double> fd_work_;
+  vanta::linear_solvers::LUFactors lu_;
+
+  // Sparse mode: pattern of J, column colours for differencing, pattern of
+  // I - gamma * J (J plus the diagonal) with the position of each entry of J
+  // and of each diagonal entry in it, and the sparse factors
+  vanta::linear_solvers::SparsityPattern sparsity_;
+  std::vector<std::size_t> colours_;
+  vanta::linear_solvers::SparsityPattern matrix_pattern_;
+  std::vector<std::size_t> jac_map_;
+  std::vector<std::size_t> diag_map_;
+  vanta::linear_solvers::SparseLUFactors sparse_lu_;
+  std::size_t n_colours_ = 0;
+
+  double gamma_ = 0.0;
+  bool has_jacobian_ = false;
+  bool factorised_ = false;
+
+  std::size_t n_jacobian_evals_ = 0;
+  std::size_t n_factorisations_ = 0;
+  std::size_t n_rhs_evals_ = 0;
+  double jacobian_time_ = 0.0;
+  mutable double linear_solve_time_ = 0.0;
+};
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_ITERATION_MATRIX_HPP_
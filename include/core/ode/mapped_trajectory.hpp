@@ -0,0 +1,184 @@
+#ifndef CORE_ODE_MAPPED_TRAJECTORY_HPP_
+#define CORE_ODE_MAPPED_TRAJECTORY_HPP_
+
+/**
+ * @file mapped_trajectory.hpp
+ * @brief Out-of-core trajectory storage in a memory-mapped file.
+ *
+ * A @c Solution keeps every recorded sample in memory, which limits runs to
+ * the available RAM. A @c MappedTrajectory stores the samples in a file
+ * mapped into the address space instead, so the operating system pages them
+ * out as the run proceeds. Any solver can write into one through the
+ * observer returned by @c Writer(), and a finished file is reopened
+ * zero-copy with the same accessors as @c Solution.
+ *
+ * The file starts with a 64-byte header followed by the time points and
+ * then the row-major states, all as native-endian doubles. Space is
+ * reserved ahead of the samples and doubled when it runs out; the unused
+ * tail is left sparse on file systems that support it.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "output.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Trajectory of an ODE solution stored in a memory-mapped file.
+ *
+ * Created for writing with @c Create() or opened read-only with @c Open().
+ * The header is updated on every @c Append(), so a file is readable up to
+ * the last appended sample even if the writer does not close it. Spans and
+ * views returned by the accessors point into the mapping and are
+ * invalidated when @c Append() grows the file.
+ *
+ * Usage with any solver:
+ * @code
+ * MappedTrajectory traj = MappedTrajectory::Create("run.traj", 3, steps + 1);
+ * OutputOptions out;
+ * out.observer = traj.Writer();
+ * out.store = false;
+ * RungeKutta4(f, t0, t1, y0, h, out);
+ * @endcode
+ */
+class MappedTrajectory {
+ public:
+  /**
+   * @brief Create a new trajectory file for writing.
+   *
+   * An existing file at @p path is overwritten.
+   *
+   * @param path     File to create.
+   * @param n_states Number of components in each state vector.
+   * @param capacity Number of samples to reserve space for (optional).
+   *
+   * @return A writable, empty trajectory.
+   *
+   * @throws std::invalid_argument If @p n_states is zero.
+   * @throws std::runtime_error    If the file cannot be created or mapped.
+   */
+  static MappedTrajectory Create(const std::string& path,
+                                 std::size_t n_states,
+                                 std::size_t capacity = 0);
+
+  /**
+   * @brief Open an existing trajectory file read-only.
+   *
+   * @param path File written by a trajectory from @c Create().
+   *
+   * @return A read-only trajectory mapping the file in place.
+   *
+   * @throws std::runtime_error If the file cannot be opened or mapped, or is
+   *         not a trajectory file.
+   */
+  static MappedTrajectory Open(const std::string& path);
+
+  MappedTrajectory(MappedTrajectory&& other) noexcept;
+  MappedTrajectory& operator=(MappedTrajectory&& other) noexcept;
+  ~MappedTrajectory();
+
+  /**
+   * @brief Append a time point and its state vector.
+   *
+   * @param t_i Time point.
+   * @param y_i State vector at @p t_i; must have @c NumStates() components.
+   *
+   * @throws std::invalid_argument If @p y_i has the wrong size.
+   * @throws std::runtime_error    If the trajectory is read-only or the file
+   *         cannot be grown.
+   */
+  void Append(double t_i, std::span<const double> y_i);
+
+  /**
+   * @brief Observer that appends every recorded sample.
+   *
+   * Assign it to @c OutputOptions::observer, usually with
+   * @c OutputOptions::store disabled. The trajectory must outlive the
+   * observer and must not be moved while it is in use.
+   */
+  Observer Writer();
+
+  /// Write modified pages back to the file.
+  void Flush();
+
+  /// True if the trajectory was created for writing.
+  bool IsWritable() const;
+
+  /// Number of stored time points.
+  std::size_t NumSteps() const;
+
+  /// Number of components in each state vector.
+  std::size_t NumStates() const;
+
+  /// Stored time points.
+  std::span<const double> Times() const;
+
+  /// State vector at time @c Times()[i].
+  std::span<const double> Row(std::size_t i) const {
+    return {y_ + i * NumStates(), NumStates()};
+  }
+
+  /// Trajectory of state component @p j over all time points.
+  ColumnView<const double> Col(std::size_t j) const {
+    return {y_ + j, NumSteps(), NumStates()};
+  }
+
+  /// State vector at the final time point.
+  std::span<const double> Back() const { return Row(NumSteps() - 1); }
+
+  /**
+   * @brief Evaluate the trajectory at an arbitrary time.
+   *
+   * Interpolates like @c Solution::At with estimated derivatives.
+   *
+   * @param time Evaluation time within the stored time points.
+   * @param out  Interpolated state; must have @c NumStates() components.
+   *
+   * @throws std::invalid_argument If the trajectory is empty or @p time
+   *         lies outside the stored time points.
+   */
+  void At(double time, std::span<double> out) const;
+
+  /**
+   * @brief Evaluate the trajectory at an arbitrary time.
+   *
+   * Allocating convenience form of the overload above.
+   */
+  std::vector<double> At(double time) const;
+
+  /**
+   * @brief Evaluate the trajectory at several times.
+   *
+   * @param times Evaluation times, each within the stored time points.
+   *
+   * @return An in-memory @c Solution with one row per entry of @p times.
+   *
+   * @throws std::invalid_argument If the trajectory is empty or a time
+   *         lies outside the stored time points.
+   */
+  Solution Sample(std::span<const double> times) const;
+
+ private:
+  struct File;
+
+  explicit MappedTrajectory(std::unique_ptr<File> file);
+
+  // Point the accessors at the current mapping
+  void Bind();
+
+  // Grow the file to hold capacity samples, moving the states up
+  void Reserve(std::size_t capacity);
+
+  std::unique_ptr<File> file_;
+  const double* y_ = nullptr;
+};
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_MAPPED_TRAJECTORY_HPP_
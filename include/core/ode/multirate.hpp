@@ -0,0 +1,101 @@
+#ifndef CORE_ODE_MULTIRATE_HPP_
+#define CORE_ODE_MULTIRATE_HPP_
+
+/**
+ * @file multirate.hpp
+ * @brief Multirate explicit integration of systems with fast and slow
+ * partitions.
+ *
+ * Many coupled models have a few fast state components and many slow ones.
+ * A single-rate method has to step every component at the rate of the
+ * fastest, so the slow right-hand side, often the expensive part, is
+ * evaluated far more often than its own dynamics require. The solver in
+ * this header takes a macro step for the slow partition and sub-cycles only
+ * the fast partition with smaller micro steps.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "output.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Right-hand side of one partition of the state.
+ *
+ * The callable receives the time @p t and the full state @p y and must
+ * write the derivatives of the partition's components into @p dydt, in the
+ * order the partition lists them.
+ */
+using PartitionRhs = std::function<void(double t, std::span<const double> y,
+                                        std::span<double> dydt)>;
+
+/**
+ * @brief Configuration options for multirate integration.
+ */
+struct MultirateOptions {
+  /**
+   * @brief Fast micro steps per slow macro step.
+   *
+   * Must be positive and even, so that the fast partition is available at
+   * the macro step midpoint without interpolation.
+   */
+  std::size_t substeps = 10;
+};
+
+/**
+ * @brief Solve an initial value problem with a multirate fourth-order
+ * Runge–Kutta scheme.
+ *
+ * The components listed in @p fast_indices form the fast partition and the
+ * rest the slow partition. Each macro step of size @p h proceeds fastest
+ * first:
+ *
+ * 1. The slow derivative is evaluated at the start of the step.
+ * 2. The fast partition is advanced by @p opts.substeps classical RK4 micro
+ *    steps. Meanwhile the slow components follow a quadratic extrapolation
+ *    built from the slow derivatives at the start of this and the previous
+ *    macro step.
+ * 3. The slow partition is advanced by one classical RK4 step. Its stages
+ *    use the fast values computed at the midpoint and the end of the step.
+ *
+ * The slow right-hand side is therefore evaluated four times per macro
+ * step, however many micro steps the fast partition takes. Each partition
+ * is integrated to fourth order. The extrapolated coupling limits the
+ * combined scheme to third order in @p h when the partitions interact.
+ *
+ * @param f_fast       Right-hand side of the fast partition.
+ * @param f_slow       Right-hand side of the slow partition.
+ * @param fast_indices State components in the fast partition, without
+ *                     duplicates.
+ * @param t0           Initial time.
+ * @param t1           Final time.
+ * @param y0           Initial state at time \f$t_0\f$.
+ * @param h            Macro step size (must be positive).
+ * @param opts         Sub-cycling options (optional).
+ * @param out          Output selection and streaming options (optional).
+ *                     Samples are taken at macro steps.
+ *
+ * @return A @c Solution with the macro step grid and full state vectors.
+ *         @c stats.n_rhs_evals counts slow and @c stats.n_fast_rhs_evals
+ *         fast right-hand side evaluations.
+ *
+ * @throws std::invalid_argument If @p h <= 0, @p t1 <= @p t0,
+ *         @p opts.substeps is zero or odd, or @p fast_indices contains an
+ *         index out of range or a duplicate.
+ */
+Solution MultirateRungeKutta4(const PartitionRhs& f_fast,
+                              const PartitionRhs& f_slow,
+                              const std::vector<std::size_t>& fast_indices,
+                              double t0, double t1,
+                              const std::vector<double>& y0, double h,
+                              const MultirateOptions& opts = {},
+                              const OutputOptions& out = {});
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_MULTIRATE_HPP_
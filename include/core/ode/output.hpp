@@ -0,0 +1,225 @@
+#ifndef CORE_ODE_OUTPUT_HPP_
+#define CORE_ODE_OUTPUT_HPP_
+
+/**
+ * @file output.hpp
+ * @brief Output selection and streaming for ODE solvers.
+ *
+ * This header defines the options controlling which integration steps a
+ * solver records, and the @c OutputRecorder helper the solvers use to apply
+ * them. Samples can be decimated, taken at requested times, streamed to an
+ * observer, or dropped entirely so that memory use does not grow with the
+ * number of steps. The recorder also runs event detection, so that a
+ * terminal event can stop any solver that records through it.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "events.hpp"
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Callback receiving a recorded sample of the solution.
+ *
+ * The span is only valid for the duration of the call. Samples of
+ * single-precision solvers are converted to double for the call, as are the
+ * states passed to event functions.
+ */
+using Observer = std::function<void(double t, std::span<const double> y)>;
+
+/**
+ * @brief Callback inspecting the stiffness of every accepted step.
+ *
+ * Receives the end time @p t and size @p h of the step, and the solver's
+ * estimate @p h_lambda of \f$ h |\lambda| \f$ for the dominant eigenvalue
+ * \f$ \lambda \f$ of the Jacobian. Returning true stops the solver after
+ * the step, which then becomes the final recorded sample.
+ */
+using StiffnessMonitor =
+    std::function<bool(double t, double h, double h_lambda)>;
+
+/**
+ * @brief Configuration options for solver output.
+ *
+ * By default every step is stored in the returned @c Solution, which matches
+ * the behaviour of the solvers before output options were introduced.
+ */
+struct OutputOptions {
+  /**
+   * @brief Record the initial state and every @c stride -th step.
+   *
+   * The final step is always recorded. A stride of zero records only the
+   * final state, so the returned solution has a single row.
+   */
+  std::size_t stride = 1;
+
+  /**
+   * @brief Explicit output times in ascending order.
+   *
+   * When non-empty this overrides @c stride. Times that do not coincide
+   * with a step are linearly interpolated between the surrounding steps.
+   * Times outside the integrated interval are not recorded.
+   */
+  std::vector<double> times;
+
+  /// Called for every recorded sample (optional).
+  Observer observer;
+
+  /// Keep recorded samples in the returned @c Solution.
+  bool store = true;
+
+  /**
+   * @brief Zero-crossing events to detect.
+   *
+   * Crossings are reported in @c Solution::events. A terminal event ends
+   * the integration at the crossing, and the state there becomes the final
+   * recorded sample. Detection needs the derivative at every step end, which
+   * costs one extra right-hand side evaluation per step for solvers that do
+   * not already have it.
+   */
+  std::vector<Event> events;
+
+  /**
+   * @brief Store the derivative of every stored sample in
+   * @c Solution::dydt.
+   *
+   * @c Solution::At and @c Solution::Sample then interpolate with the exact
+   * end point derivatives, so a coarsely sampled solution can still be
+   * evaluated accurately anywhere. Solvers that already have the
+   * derivative at a step end pass it on; otherwise each stored sample costs
+   * one right-hand side evaluation.
+   */
+  bool dense = false;
+};
+
+/**
+ * @brief Applies @c OutputOptions to the steps produced by a solver.
+ *
+ * A solver calls @c Start() with the initial state, @c Step() after every
+ * accepted step and @c Finish() once integration ends. The recorder decides
+ * which samples to keep, forwards them to the observer, detects events and
+ * builds the returned solution. Apart from the stored samples it holds
+ * O(n_states) memory.
+ *
+ * @tparam T State scalar type, @c float or @c double. Instantiated for
+ *           both; @c OutputRecorder is the double-precision recorder.
+ */
+template <OdeScalar T>
+class BasicOutputRecorder {
+ public:
+  /**
+   * @brief Create a recorder for a system with @p n_states components.
+   *
+   * @param opts           Output options. Must outlive the recorder.
+   * @param n_states       Number of state components.
+   * @param expected_steps Number of steps the solver expects to take, used
+   *                       to reserve storage (zero if unknown).
+   * @param f              Right-hand side, used to evaluate derivatives for
+   *                       event detection and dense output when the solver
+   *                       does not pass them. Required if @p opts.events is
+   *                       non-empty or @p opts.dense is set.
+   *
+   * @throws std::invalid_argument If @p opts.times is not sorted, or events
+   *         or dense output are requested without a right-hand side.
+   */
+  BasicOutputRecorder(const OutputOptions& opts, std::size_t n_states,
+                      std::size_t expected_steps = 0,
+                      BasicInPlaceRhs<T> f = {});
+
+  /**
+   * @brief Record the initial state.
+   *
+   * @param t0    Initial time.
+   * @param y0    Initial state.
+   * @param dydt0 Derivative at @p t0, if already known.
+   */
+  void Start(double t0, std::span<const T> y0,
+             std::span<const T> dydt0 = {});
+
+  /**
+   * @brief Record the state at the end of an accepted step.
+   *
+   * @param t    Time at the end of the step.
+   * @param y    State at @p t.
+   * @param dydt Derivative at @p t, if already known.
+   *
+   * @return True if a terminal event occurred during the step, in which
+   *         case the solver must stop and call @c Finish().
+   */
+  bool Step(double t, std::span<const T> y, std::span<const T> dydt = {});
+
+  /**
+   * @brief Flush the final state and return the stored samples.
+   *
+   * @return The solution holding every stored sample.
+   */
+  BasicSolution<T> Finish();
+
+  /// Right-hand side evaluations made for event detection and dense output.
+  std::size_t NumRhsEvals() const { return n_rhs_evals_; }
+
+ private:
+  // Apply the sampling options to the end point of a step, with its
+  // derivative if known
+  void Record(double t, std::span<const T> y, std::span<const T> dydt);
+
+  // Keep the derivative of a held step for dense output, if known
+  void KeepDerivative(std::span<const T> dydt);
+
+  // Store and/or stream one sample, evaluating its derivative for dense
+  // output if not given
+  void Emit(double t, std::span<const T> y, std::span<const T> dydt = {});
+
+  // Pass a step end to the event locator, converting to double if needed
+  void LocatorStart(double t, std::span<const T> y, std::span<const T> dydt);
+  bool LocatorStep(double t, std::span<const T> y, std::span<const T> dydt);
+
+  const OutputOptions& opts_;
+  BasicSolution<T> sol_;
+
+  // Event detection and the derivative it needs at each step end
+  EventLocator locator_;
+  BasicInPlaceRhs<T> f_;
+  std::vector<T> dydt_;
+  std::size_t n_rhs_evals_ = 0;
+  bool terminated_ = false;
+
+  // Double-precision copies for the locator and observer when T is float,
+  // and the event state converted back
+  std::vector<double> y_double_;
+  std::vector<double> dydt_double_;
+  std::vector<T> y_event_;
+
+  // Steps taken since the last recorded one
+  std::size_t steps_since_emit_ = 0;
+
+  // Most recent step, kept until it is known whether it is the last
+  double t_last_ = 0.0;
+  std::vector<T> y_last_;
+  std::vector<T> dydt_last_;
+  bool has_dydt_last_ = false;
+  bool last_emitted_ = true;
+
+  // Derivative of a stored sample for dense output
+  std::vector<T> dydt_dense_;
+
+  // Next requested output time and interpolation buffer
+  std::size_t next_time_ = 0;
+  std::vector<T> y_interp_;
+};
+
+extern template class BasicOutputRecorder<float>;
+extern template class BasicOutputRecorder<double>;
+
+/// Output recorder of a double-precision solver.
+using OutputRecorder = BasicOutputRecorder<double>;
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_OUTPUT_HPP_
@@ -0,0 +1,141 @@
+#ifndef CORE_ODE_PARAREAL_HPP_
+#define CORE_ODE_PARAREAL_HPP_
+
+/**
+ * @file parareal.hpp
+ * @brief Parallel-in-time integration using the Parareal algorithm.
+ *
+ * Parareal splits \f$[t_0, t_1]\f$ into time slices and combines a cheap,
+ * inaccurate coarse propagator \f$ G \f$ with an expensive, accurate fine
+ * propagator \f$ F \f$. Each iteration runs @c F over every slice
+ * concurrently from the current slice boundaries, then sweeps through the
+ * slices with the predictor-corrector update
+ * \f[
+ *    U^{k+1}_{n+1} = G(U^{k+1}_n) + F(U^k_n) - G(U^k_n),
+ * \f]
+ * which is sequential but only calls @c G. After @c k iterations the first
+ * @c k boundaries equal the serial fine solution exactly, and for smooth
+ * problems all of them usually agree with it to within a tolerance after a
+ * few iterations. A single trajectory can therefore use as many cores as
+ * there are slices.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Propagator advancing a state from @p t_start to @p t_end in place.
+ *
+ * Fine propagators are called concurrently from several threads and must be
+ * safe to call that way.
+ */
+using Propagator =
+    std::function<void(double t_start, double t_end, std::span<double> y)>;
+
+/**
+ * @brief Configuration options for Parareal.
+ */
+struct PararealOptions {
+  /// Number of time slices. Zero selects one slice per worker thread.
+  std::size_t n_slices = 0;
+
+  /// Number of worker threads. Zero selects the hardware concurrency.
+  std::size_t n_threads = 0;
+
+  /// Maximum number of iterations. Zero allows @c n_slices iterations,
+  /// after which the result equals the serial fine solution.
+  std::size_t max_iters = 0;
+
+  /**
+   * @brief Convergence tolerance on the slice boundaries.
+   *
+   * Iteration stops once no boundary component changes by more than
+   * @c tol * max(1, |y|) between two iterations.
+   */
+  double tol = 1e-8;
+};
+
+/**
+ * @brief Result of a Parareal integration.
+ */
+struct PararealSolution {
+  /// Time points and states at the slice boundaries.
+  Solution solution;
+
+  /// Number of fine sweeps performed.
+  std::size_t iterations = 0;
+
+  /// True if the boundaries met the tolerance, or all slices are exact.
+  bool converged = false;
+
+  /// Largest scaled boundary change in the last iteration.
+  double update = 0.0;
+
+  /// Wall-clock time of the whole integration, in seconds.
+  double wall_time = 0.0;
+
+  /**
+   * @brief Estimated time of a serial fine integration, in seconds.
+   *
+   * Measured as the total time of the fine propagations in the first
+   * iteration, which covers every slice once.
+   */
+  double serial_time = 0.0;
+
+  /// Measured speedup, @c serial_time / @c wall_time.
+  double speedup = 0.0;
+};
+
+/**
+ * @brief Integrate an initial value problem with the Parareal algorithm.
+ *
+ * @param coarse Cheap coarse propagator, only called from the calling
+ *               thread.
+ * @param fine   Accurate fine propagator, called concurrently.
+ * @param t0     Initial time.
+ * @param t1     Final time.
+ * @param y0     Initial state at time \f$t_0\f$.
+ * @param opts   Slicing, threading and convergence options (optional).
+ *
+ * @return A @c PararealSolution with the boundary states, iteration count
+ *         and timing.
+ *
+ * @throws std::invalid_argument If @p t1 <= @p t0 or a propagator is
+ *         empty.
+ * @throws Any exception thrown by a propagator.
+ */
+PararealSolution Parareal(const Propagator& coarse, const Propagator& fine,
+                          double t0, double t1, const std::vector<double>& y0,
+                          PararealOptions opts = {});
+
+/**
+ * @brief Propagator taking fixed forward Euler steps.
+ *
+ * Each call divides its interval into the smallest number of equal steps
+ * no longer than @p h. The propagator is as safe to call concurrently as
+ * @p f is.
+ *
+ * @param f In-place right-hand side. It is captured by value.
+ * @param h Largest step size (must be positive).
+ *
+ * @throws std::invalid_argument If @p h <= 0.
+ */
+Propagator EulerForwardPropagator(InPlaceRhs f, double h);
+
+/**
+ * @brief Propagator taking fixed classical RK4 steps.
+ *
+ * @copydetails EulerForwardPropagator
+ */
+Propagator RungeKutta4Propagator(InPlaceRhs f, double h);
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_PARAREAL_HPP_
@@ -0,0 +1,87 @@
+#ifndef CORE_ODE_PHASE_TIMER_HPP_
+#define CORE_ODE_PHASE_TIMER_HPP_
+
+/**
+ * @file phase_timer.hpp
+ * @brief Low-overhead timing of solver phases.
+ *
+ * Solvers accumulate the wall time of their phases into @c PhaseTimes with
+ * the helpers in this header. Timing is controlled by the
+ * @c VANTA_ODE_TIMING macro, set by the @c ODE_TIMING CMake option and off
+ * by default: when it is zero the timer holds no state and every call
+ * compiles to nothing, so the stepping loops are the same as without
+ * instrumentation. When it is enabled every timed call reads the clock
+ * twice, which can slow explicit solvers with a cheap right-hand side
+ * several times over, so it is meant for profiling builds.
+ */
+
+#include <chrono>
+#include <utility>
+
+#ifndef VANTA_ODE_TIMING
+#define VANTA_ODE_TIMING 0
+#endif
+
+namespace vanta::ode {
+
+/**
+ * @brief Adds the time from construction to @c Stop() to a counter.
+ *
+ * Stops on destruction if not stopped before.
+ */
+class PhaseTimer {
+ public:
+  /**
+   * @brief Start timing.
+   *
+   * @param seconds Counter the elapsed time is added to. Must outlive the
+   *                timer.
+   */
+  explicit PhaseTimer([[maybe_unused]] double& seconds) noexcept
+#if VANTA_ODE_TIMING
+      : seconds_(&seconds), start_(Clock::now())
+#endif
+  {
+  }
+
+  PhaseTimer(const PhaseTimer&) = delete;
+  PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+  ~PhaseTimer() { Stop(); }
+
+  /// Add the elapsed time to the counter; later calls do nothing.
+  void Stop() noexcept {
+#if VANTA_ODE_TIMING
+    if (seconds_ == nullptr) return;
+    *seconds_ += std::chrono::duration<double>(Clock::now() - start_).count();
+    seconds_ = nullptr;
+#endif
+  }
+
+ private:
+#if VANTA_ODE_TIMING
+  using Clock = std::chrono::steady_clock;
+
+  double* seconds_;
+  Clock::time_point start_;
+#endif
+};
+
+/**
+ * @brief Wrap a callable so that the time spent in each call is added to
+ * @p seconds.
+ *
+ * The wrapper references both arguments, which must outlive it. With
+ * timing disabled it forwards straight to @p f.
+ */
+template <typename F>
+auto TimedCalls(F& f, double& seconds) {
+  return [&f, &seconds](auto&&... args) -> decltype(auto) {
+    PhaseTimer timer(seconds);
+    return f(std::forward<decltype(args)>(args)...);
+  };
+}
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_PHASE_TIMER_HPP_
@@ -0,0 +1,222 @@
+#ifndef CORE_ODE_RHS_HPP_
+#define CORE_ODE_RHS_HPP_
+
+/**
+ * @file rhs.hpp
+ * @brief Right-hand side function types shared by the ODE solvers.
+ *
+ * This header declares the callable signatures used to describe the system
+ * \f$ dy/dt = f(t, y) \f$, the concepts describing template right-hand sides,
+ * and adapters from the allocating vector-returning form and from template
+ * functors to the allocation-free in-place form.
+ *
+ * The batched form evaluates \f$ f \f$ at many states in one call. Where
+ * the per-call overhead dominates, as for callbacks into an interpreter, or
+ * where the model vectorises across states, solvers that evaluate several
+ * independent states at once issue them as one batched call: ensemble
+ * members, and the perturbed states of a finite-difference Jacobian.
+ */
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace vanta::ode {
+
+/**
+ * @brief Right-hand side that returns the time derivative by value.
+ *
+ * This is the signature accepted by the original solver overloads. Every
+ * call allocates the returned vector.
+ */
+using Rhs = std::function<std::vector<double>(const double&,
+                                              const std::vector<double>&)>;
+
+/**
+ * @brief Scalar types the state of an ODE system may be stored in.
+ *
+ * Time is accumulated in @c double whatever the state type, so that long
+ * single-precision integrations do not drift off the intended time grid.
+ */
+template <typename T>
+concept OdeScalar = std::same_as<T, float> || std::same_as<T, double>;
+
+/**
+ * @brief Right-hand side that writes the time derivative in place.
+ *
+ * The callable receives the current time @p t and state @p y and must write
+ * \f$ f(t, y) \f$ into @p dydt, which has the same size as @p y. It should not
+ * allocate, so that solvers using this form perform no heap allocations per
+ * step.
+ *
+ * @tparam T State scalar type, @c float or @c double.
+ */
+template <OdeScalar T>
+using BasicInPlaceRhs = std::function<void(
+    double t, std::span<const T> y, std::span<T> dydt)>;
+
+/// In-place right-hand side of a double-precision system.
+using InPlaceRhs = BasicInPlaceRhs<double>;
+
+/**
+ * @brief Right-hand side evaluated for a batch of states at once.
+ *
+ * The @p n_members states of a batch are laid out in structure-of-arrays
+ * form: element @c y[j * n_members + m] is component @c j of member
+ * @c first_member + m. The callable must write the time derivatives into
+ * @p dydt using the same layout, so a loop over members is contiguous and
+ * can be vectorised. Every member is evaluated at the same time @p t.
+ *
+ * Ensemble solvers pass the index of the batch's first member, from which
+ * per-member parameters can be looked up. Solvers batching the states of a
+ * single system, such as finite-difference Jacobians, pass zero.
+ *
+ * @tparam T Scalar type of the state, @c float or @c double.
+ */
+template <typename T>
+using BasicBatchRhs =
+    std::function<void(double t, std::span<const T> y, std::span<T> dydt,
+                       std::size_t first_member, std::size_t n_members)>;
+
+/// Batched right-hand side over @c double states.
+using BatchRhs = BasicBatchRhs<double>;
+
+/**
+ * @brief Analytic Jacobian of the right-hand side.
+ *
+ * The callable receives the time @p t and state @p y and must write
+ * \f$ \partial f / \partial y \f$ into @p jac as a row-major n x n matrix,
+ * so element @c jac[i * n + j] is \f$ \partial f_i / \partial y_j \f$.
+ * Solvers given a sparsity pattern instead expect the nonzero values in the
+ * pattern's CSR order.
+ */
+using Jacobian = std::function<void(double t, std::span<const double> y,
+                                    std::span<double> jac)>;
+
+/**
+ * @brief Adapt a vector-returning right-hand side to the in-place form.
+ *
+ * The returned callable copies the state into an internal buffer that is
+ * reused across calls, so the only remaining allocation is the vector
+ * returned by @p f itself.
+ *
+ * @param f Right-hand side to adapt. It is captured by reference and must
+ *          outlive the returned callable.
+ *
+ * @return An @c InPlaceRhs forwarding to @p f.
+ */
+inline InPlaceRhs ToInPlaceRhs(const Rhs& f) {
+  return [&f, y_buf = std::vector<double>()](
+             double t, std::span<const double> y,
+             std::span<double> dydt) mutable {
+    y_buf.assign(y.begin(), y.end());
+    const std::vector<double> result = f(t, y_buf);
+    std::copy(result.begin(), result.end(), dydt.begin());
+  };
+}
+
+/**
+ * @brief Adapt a per-state right-hand side to the batched form.
+ *
+ * The returned callable gathers each member of the batch into a contiguous
+ * buffer, calls @p f and scatters the result back, so it performs one call
+ * of @p f per member. It lets per-state models be used with the batched
+ * solvers, but brings none of the savings of a natively batched model.
+ *
+ * @param f Right-hand side to adapt. It is captured by reference and must
+ *          outlive the returned callable.
+ * @param n Number of state components.
+ *
+ * @return A @c BatchRhs forwarding to @p f.
+ */
+inline BatchRhs ToBatchRhs(const InPlaceRhs& f, std::size_t n) {
+  return [&f, y_m = std::vector<double>(n), dydt_m = std::vector<double>(n)](
+             double t, std::span<const double> y, std::span<double> dydt,
+             std::size_t first_member [[maybe_unused]],
+             std::size_t n_members) mutable {
+    for (std::size_t m = 0; m < n_members; ++m) {
+      for (std::size_t j = 0; j < y_m.size(); ++j) {
+        y_m[j] = y[j * n_members + m];
+      }
+      f(t, y_m, dydt_m);
+      for (std::size_t j = 0; j < y_m.size(); ++j) {
+        dydt[j * n_members + m] = dydt_m[j];
+      }
+    }
+  };
+}
+
+/**
+ * @brief Adapt a batched right-hand side to the in-place form.
+ *
+ * A single state is a batch of one member, whose layout is the plain state
+ * vector, so the returned callable forwards without copying.
+ *
+ * @param f Batched right-hand side. It is captured by reference and must
+ *          outlive the returned callable.
+ *
+ * @return An @c InPlaceRhs evaluating @p f for member zero.
+ */
+inline InPlaceRhs ToInPlaceRhs(const BatchRhs& f) {
+  return [&f](double t, std::span<const double> y, std::span<double> dydt) {
+    f(t, y, dydt, 0, 1);
+  };
+}
+
+/**
+ * @brief State types accepted by the template solvers.
+ *
+ * Either a fixed-size @c std::array<T, N> or a dynamically sized
+ * @c std::vector<T>, with @c T a @ref OdeScalar.
+ */
+template <typename State>
+concept OdeState =
+    OdeScalar<typename State::value_type> &&
+    (std::same_as<State, std::vector<typename State::value_type>> ||
+     std::same_as<State, std::array<typename State::value_type,
+                                    std::tuple_size_v<State>>>);
+
+/**
+ * @brief Right-hand side functor writing \f$ f(t, y) \f$ into @c dydt.
+ *
+ * The functor is called as @c f(t, y, dydt) with @c y of type
+ * @c const State& and @c dydt of type @c State&.
+ */
+template <typename F, typename State>
+concept StateRhs = OdeState<State> &&
+                   std::invocable<F&, double, const State&, State&>;
+
+/**
+ * @brief Adapt a functor right-hand side to the in-place form.
+ *
+ * Used by the template solvers to hand the right-hand side to
+ * @c OutputRecorder for event detection and dense output. The returned
+ * callable copies through buffers of the state type, so it is slower than
+ * calling @p f directly.
+ *
+ * @param f  Right-hand side functor. It is captured by reference and must
+ *           outlive the returned callable.
+ * @param y0 State used to size the buffers.
+ *
+ * @return An @c InPlaceRhs forwarding to @p f.
+ */
+template <typename F, typename State>
+  requires StateRhs<F, State>
+BasicInPlaceRhs<typename State::value_type> ToInPlaceRhs(F& f,
+                                                         const State& y0) {
+  using T = typename State::value_type;
+  return [&f, y = y0, dydt = y0](double t, std::span<const T> y_in,
+                                 std::span<T> dydt_out) mutable {
+    std::copy(y_in.begin(), y_in.end(), y.begin());
+    f(t, static_cast<const State&>(y), dydt);
+    std::copy(dydt.begin(), dydt.end(), dydt_out.begin());
+  };
+}
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_RHS_HPP_
@@ -10,8 +10,13 @@
  * for systems of ordinary differential equations.
  */
 
+#include <cstddef>
 #include <functional>
+#include <span>
+#include <vector>
 
+#include "output.hpp"
+#include "rhs.hpp"
 #include "solution.hpp"
 
 namespace vanta::ode {
@@ -40,6 +45,8 @@ namespace vanta::ode {
  * @param t1  Final time.
  * @param y0  Initial state vector at time \f$t_0\f$.
  * @param h   Time step size (must be positive).
+ * @param out Output selection and streaming options (optional). By default
+ *            every step is stored.
  *
  * @return A @c Solution object containing the time grid and corresponding
  *         numerical solution vectors.
@@ -50,7 +57,72 @@ namespace vanta::ode {
 Solution RungeKutta4(const std::function<std::vector<double>(
                          const double&, const std::vector<double>&)>& f,
                      const double& t0, const double& t1,
-                     const std::vector<double>& y0, const double& h);
+                     const std::vector<double>& y0, const double& h,
+                     const OutputOptions& out = {});
+
+/**
+ * @brief Scratch storage for allocation-free RK4 steps.
+ *
+ * Holds the four stage slopes and the intermediate stage state. A workspace
+ * sized for an @c n component system can be reused for any number of calls
+ * to @ref RungeKutta4Step on systems of that size.
+ */
+struct RK4Workspace {
+  /**
+   * @brief Allocate stage storage for a system with @p n components.
+   *
+   * @param n Number of state components.
+   */
+  explicit RK4Workspace(std::size_t n)
+      : k1(n), k2(n), k3(n), k4(n), y_stage(n) {}
+
+  /// Stage slopes.
+  std::vector<double> k1, k2, k3, k4;
+
+  /// State at which the current stage slope is evaluated.
+  std::vector<double> y_stage;
+};
+
+/**
+ * @brief Advance a state by a single classical RK4 step.
+ *
+ * Computes \f$ y_{n+1} \f$ from \f$ y_n \f$ using the four stage slopes
+ * stored in @p ws. The step performs no heap allocations provided @p f does
+ * not allocate.
+ *
+ * @param f      In-place right-hand side function.
+ * @param t      Time at the start of the step.
+ * @param y      State at the start of the step.
+ * @param h      Step size.
+ * @param y_next Output state at @p t + @p h. May alias @p y.
+ * @param ws     Workspace sized for the system.
+ */
+void RungeKutta4Step(const InPlaceRhs& f, double t, std::span<const double> y,
+                     double h, std::span<double> y_next, RK4Workspace& ws);
+
+/**
+ * @brief Solve an initial value problem using the classical fourth-order
+ * Runge–Kutta method with an in-place right-hand side.
+ *
+ * Behaves like the vector-returning overload, but the right-hand side writes
+ * its result into a preallocated buffer and the stages live in a single
+ * @ref RK4Workspace, so once the @c Solution is allocated the time stepping
+ * loop performs no heap allocations.
+ *
+ * @param f   In-place right-hand side function defining the ODE system.
+ * @param t0  Initial time.
+ * @param t1  Final time.
+ * @param y0  Initial state vector at time \f$t_0\f$.
+ * @param h   Time step size (must be positive).
+ * @param out Output selection and streaming options (optional). By default
+ *            every step is stored.
+ *
+ * @return A @c Solution object containing the time grid and corresponding
+ *         numerical solution vectors.
+ */
+Solution RungeKutta4(const InPlaceRhs& f, const double& t0, const double& t1,
+                     const std::vector<double>& y0, const double& h,
+                     const OutputOptions& out = {});
 
 }  // namespace vanta::ode
 
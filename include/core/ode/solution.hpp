@@ -5,40 +5,347 @@
  * @file solution.h
  * @brief Data structure for storing numerical ODE solutions.
  *
- * This header defines the @c Solution struct, which represents the result of a
- * numerical time integration of an initial value problem. It stores the time
- * points at which the solution was computed and the corresponding state
- * vectors.
+ * This header defines the @c BasicSolution struct, which represents the
+ * result of a numerical time integration of an initial value problem. It
+ * stores the time points at which the solution was computed and the
+ * corresponding state vectors in a single contiguous row-major buffer, and
+ * can evaluate the solution between the stored time points. @c Solution is
+ * its double-precision instantiation.
  */
 
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace vanta::ode {
 
+/**
+ * @brief Non-owning strided view over one column of a row-major buffer.
+ *
+ * A @c ColumnView gives indexed and iterator access to every @p stride -th
+ * element of a contiguous buffer, which is how a single state component is
+ * laid out in @c Solution::y.
+ *
+ * @tparam T Element type, a possibly const-qualified state scalar.
+ */
+template <typename T>
+class ColumnView {
+ public:
+  /**
+   * @brief Forward iterator over the elements of a column.
+   */
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    Iterator() = default;
+    Iterator(T* ptr, std::size_t stride) : ptr_(ptr), stride_(stride) {}
+
+    reference operator*() const { return *ptr_; }
+    Iterator& operator++() {
+      ptr_ += stride_;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    bool operator==(const Iterator& other) const { return ptr_ == other.ptr_; }
+
+   private:
+    T* ptr_ = nullptr;
+    std::size_t stride_ = 1;
+  };
+
+  /**
+   * @brief Construct a view over @p size elements spaced @p stride apart.
+   *
+   * @param data   Pointer to the first element of the column.
+   * @param size   Number of elements in the column.
+   * @param stride Distance between consecutive elements.
+   */
+  ColumnView(T* data, std::size_t size, std::size_t stride)
+      : data_(data), size_(size), stride_(stride) {}
+
+  /// Element @p i of the column.
+  T& operator[](std::size_t i) const { return data_[i * stride_]; }
+
+  /// Number of elements in the column.
+  std::size_t size() const { return size_; }
+
+  /// True if the column has no elements.
+  bool empty() const { return size_ == 0; }
+
+  /// First element of the column.
+  T& front() const { return data_[0]; }
+
+  /// Last element of the column.
+  T& back() const { return data_[(size_ - 1) * stride_]; }
+
+  /// Iterator to the first element.
+  Iterator begin() const { return Iterator(data_, stride_); }
+
+  /// Iterator one past the last element.
+  Iterator end() const { return Iterator(data_ + size_ * stride_, stride_); }
+
+ private:
+  T* data_;
+  std::size_t size_;
+  std::size_t stride_;
+};
+
+/**
+ * @brief Wall time spent by an ODE solver in each phase, in seconds.
+ *
+ * Measured with @c std::chrono::steady_clock when the library is built with
+ * @c VANTA_ODE_TIMING enabled and left at zero otherwise (the default).
+ */
+struct PhaseTimes {
+  /// Right-hand side calls made by the stepper itself.
+  double rhs = 0.0;
+
+  /// Jacobian evaluations, including finite-difference approximations.
+  double jacobian = 0.0;
+
+  /// Forming, factorising and solving with iteration matrices.
+  double linear_solve = 0.0;
+
+  /// The whole solver call.
+  double total = 0.0;
+
+  /// Time outside the measured phases: step control, output and events.
+  double Other() const { return total - rhs - jacobian - linear_solve; }
+};
+
+/**
+ * @brief Counters describing the work performed by an ODE solver.
+ */
+struct Stats {
+  /// Number of right-hand side evaluations.
+  std::size_t n_rhs_evals = 0;
+
+  /// Number of accepted steps.
+  std::size_t n_accepted = 0;
+
+  /// Number of steps rejected by error control and retried.
+  std::size_t n_rejected = 0;
+
+  /// Number of Jacobian evaluations by implicit solvers.
+  std::size_t n_jacobian_evals = 0;
+
+  /// Number of iteration matrix factorisations by implicit solvers.
+  std::size_t n_factorisations = 0;
+
+  /// Number of fast partition right-hand side evaluations by multirate
+  /// solvers, which count slow evaluations in @c n_rhs_evals.
+  std::size_t n_fast_rhs_evals = 0;
+
+  /// Number of Newton iterations by implicit solvers.
+  std::size_t n_newton_iters = 0;
+
+  /// Wall time per phase.
+  PhaseTimes time;
+};
+
+/**
+ * @brief An event crossing located during integration.
+ */
+struct EventRecord {
+  /// Index of the event in @c OutputOptions::events.
+  std::size_t index = 0;
+
+  /// Time of the crossing.
+  double t = 0.0;
+
+  /// State at the crossing.
+  std::vector<double> y;
+};
+
 /**
  * @brief Container for a numerical solution of an ODE system.
  *
- * A @c Solution object holds the discrete time grid and the associated solution
- * vectors produced by a numerical ODE solver such as the forward Euler or
- * Runge–Kutta methods.
+ * A @c BasicSolution object holds the discrete time grid and the associated
+ * solution vectors produced by a numerical ODE solver such as the forward
+ * Euler or Runge–Kutta methods.
  *
- * The size of @c t and @c y is the same, and @c y[i] corresponds to the
- * solution at time @c t[i].
+ * The states are stored in one contiguous row-major buffer of
+ * @c NumSteps() x @c NumStates() values, so row @c i is the state vector at
+ * time @c t[i] and column @c j is the trajectory of component @c j. Times are
+ * kept in @c double for every state type.
+ *
+ * @tparam T State scalar type, @c float or @c double.
  */
-struct Solution {
+template <typename T>
+struct BasicSolution {
   /**
    * @brief Time points at which the solution is evaluated.
    */
   std::vector<double> t;
 
   /**
-   * @brief Solution vectors corresponding to each time point.
+   * @brief Row-major solution buffer.
    *
-   * Each entry @c y[i] is the state vector of the system at time @c t[i].
+   * Element @c y[i * n_states + j] is component @c j of the state vector at
+   * time @c t[i]. Prefer @c Row() and @c Col() for access.
+   */
+  std::vector<T> y;
+
+  /**
+   * @brief Number of components in each state vector.
    */
-  std::vector<std::vector<double>> y;
+  std::size_t n_states = 0;
+
+  /**
+   * @brief Row-major derivative buffer, laid out like @c y.
+   *
+   * Filled by solvers asked for dense output (@c OutputOptions::dense) and
+   * empty otherwise.
+   */
+  std::vector<T> dydt;
+
+  /**
+   * @brief Work counters and phase timings reported by the solver.
+   */
+  Stats stats;
+
+  /**
+   * @brief Event crossings located during integration, in time order.
+   */
+  std::vector<EventRecord> events;
+
+  /**
+   * @brief True if a terminal event stopped the integration early.
+   *
+   * The last stored sample, if any, is then the state at the terminal
+   * event rather than at the requested final time.
+   */
+  bool terminated = false;
+
+  /**
+   * @brief Construct an empty solution.
+   */
+  BasicSolution() = default;
+
+  /**
+   * @brief Construct a solution with storage for @p n_steps state vectors.
+   *
+   * @param n_steps  Number of time points.
+   * @param n_states Number of components in each state vector.
+   */
+  BasicSolution(std::size_t n_steps, std::size_t n_states)
+      : t(n_steps), y(n_steps * n_states), n_states(n_states) {}
+
+  /// Number of stored time points.
+  std::size_t NumSteps() const { return t.size(); }
+
+  /// Number of components in each state vector.
+  std::size_t NumStates() const { return n_states; }
+
+  /// State vector at time @c t[i].
+  std::span<T> Row(std::size_t i) {
+    return {y.data() + i * n_states, n_states};
+  }
+
+  /// State vector at time @c t[i].
+  std::span<const T> Row(std::size_t i) const {
+    return {y.data() + i * n_states, n_states};
+  }
+
+  /// Trajectory of state component @p j over all time points.
+  ColumnView<T> Col(std::size_t j) {
+    return {y.data() + j, NumSteps(), n_states};
+  }
+
+  /// Trajectory of state component @p j over all time points.
+  ColumnView<const T> Col(std::size_t j) const {
+    return {y.data() + j, NumSteps(), n_states};
+  }
+
+  /**
+   * @brief Append a time point and its state vector.
+   *
+   * Used by solvers that do not know the number of steps in advance.
+   *
+   * @param t_i Time point.
+   * @param y_i State vector at @p t_i; must have @c NumStates() components.
+   */
+  void Append(double t_i, std::span<const T> y_i) {
+    t.push_back(t_i);
+    y.insert(y.end(), y_i.begin(), y_i.end());
+  }
+
+  /// State vector at the final time point.
+  std::span<T> Back() { return Row(NumSteps() - 1); }
+
+  /// State vector at the final time point.
+  std::span<const T> Back() const { return Row(NumSteps() - 1); }
+
+  /// True if a derivative is stored for every time point.
+  bool HasDerivatives() const {
+    return !t.empty() && dydt.size() == y.size();
+  }
+
+  /// Derivative at time @c t[i]; requires @c HasDerivatives().
+  std::span<const T> Derivative(std::size_t i) const {
+    return {dydt.data() + i * n_states, n_states};
+  }
+
+  /**
+   * @brief Evaluate the solution at an arbitrary time.
+   *
+   * The state is interpolated with the cubic Hermite interpolant of the
+   * step containing @p time. Stored derivatives are used if present;
+   * otherwise the derivatives at the step ends are estimated from three
+   * neighbouring samples, which keeps the interpolant third-order accurate
+   * on smooth solutions. The step is located in O(1) on uniform grids and
+   * by binary search otherwise.
+   *
+   * @param time Evaluation time in \f$ [t_0, t_{N-1}] \f$.
+   * @param out  Interpolated state; must have @c NumStates() components.
+   *
+   * @throws std::invalid_argument If the solution is empty or @p time lies
+   *         outside the stored time points.
+   */
+  void At(double time, std::span<T> out) const;
+
+  /**
+   * @brief Evaluate the solution at an arbitrary time.
+   *
+   * Allocating convenience form of the overload above.
+   *
+   * @param time Evaluation time in \f$ [t_0, t_{N-1}] \f$.
+   *
+   * @return The interpolated state.
+   */
+  std::vector<T> At(double time) const;
+
+  /**
+   * @brief Evaluate the solution at several times.
+   *
+   * @param times Evaluation times, in any order, each within the stored
+   *              time points.
+   *
+   * @return A @c BasicSolution with one row per entry of @p times.
+   *
+   * @throws std::invalid_argument If the solution is empty or a time lies
+   *         outside the stored time points.
+   */
+  BasicSolution Sample(std::span<const double> times) const;
 };
 
+extern template struct BasicSolution<float>;
+extern template struct BasicSolution<double>;
+
+/// Solution of a double-precision system.
+using Solution = BasicSolution<double>;
+
 }  // namespace vanta::ode
 
 #endif  // CORE_ODE_SOLUTION_HPP_
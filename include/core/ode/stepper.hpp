@@ -0,0 +1,285 @@
+#ifndef CORE_ODE_STEPPER_HPP_
+#define CORE_ODE_STEPPER_HPP_
+
+/**
+ * @file stepper.hpp
+ * @brief Stateful fixed-step integrators for incremental integration.
+ *
+ * The solver functions integrate a whole interval in one call. A stepper
+ * instead holds the current time and state and is advanced on demand, for
+ * example by one tick of a fixed-rate control loop:
+ * @code
+ * RungeKutta4Stepper stepper(f, 0.0, y0, 1e-3);
+ * for (;;) {
+ *   WaitForTick();
+ *   stepper.AdvanceTo(TickTime());
+ *   Actuate(stepper.State());
+ * }
+ * @endcode
+ * Every stepper allocates its storage when constructed. @c Init(),
+ * @c Step() and @c AdvanceTo() then do not allocate, and a step costs a
+ * fixed number of right-hand side evaluations, plus for backward Euler a
+ * bounded number of Newton iterations and Jacobian updates. This holds as
+ * long as the right-hand side does not allocate itself, so the in-place
+ * form should be used.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "euler_backward.hpp"
+#include "explicit_runge_kutta.hpp"
+#include "iteration_matrix.hpp"
+#include "rhs.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Size of the next fixed step from @p t towards @p t_target.
+ *
+ * Returns the full step @p h while the target is further away, and the
+ * remaining distance otherwise, so the last step lands exactly on the
+ * target. Remainders within a relative 1e-9 of @p h are taken as @p h, so
+ * targets on the step grid keep a constant step size despite rounding, and
+ * a remainder below that tolerance returns zero.
+ *
+ * @param t        Current time.
+ * @param t_target Time to advance to; must not be before @p t.
+ * @param h        Nominal step size.
+ */
+inline double StepTowards(double t, double t_target, double h) {
+  constexpr double kRelTol = 1e-9;
+  const double remaining = t_target - t;
+  if (remaining <= kRelTol * h) return 0.0;
+  if (remaining >= h * (1.0 - kRelTol)) return h;
+  return remaining;
+}
+
+/**
+ * @brief Stateful fixed-step integrator for the explicit Runge–Kutta method
+ * given by @p Tableau.
+ *
+ * Takes the same steps as @c ExplicitRungeKutta, so stepping from @c t0 by
+ * @c Step() reproduces its solution exactly.
+ *
+ * @tparam Tableau   A @c constexpr @c ButcherTableau with static storage
+ *                   duration.
+ * @tparam F         Right-hand side functor satisfying @ref StateRhs.
+ * @tparam StateType State type, @c std::vector<T> or @c std::array<T, N>.
+ */
+template <const auto& Tableau, typename F = InPlaceRhs,
+          typename StateType = std::vector<double>>
+  requires StateRhs<F, StateType>
+class ExplicitRungeKuttaStepper {
+ public:
+  /**
+   * @brief Allocate storage and start at (@p t0, @p y0).
+   *
+   * @param f  Right-hand side functor, copied into the stepper.
+   * @param t0 Initial time.
+   * @param y0 Initial state.
+   * @param h  Step size (must be positive).
+   *
+   * @throws std::invalid_argument If @p h <= 0.
+   */
+  ExplicitRungeKuttaStepper(F f, double t0, const StateType& y0, double h)
+      : f_(std::move(f)), t_(t0), h_(h), y_(y0), ws_(y0) {
+    if (h <= 0.0) {
+      throw std::invalid_argument("Step size h must be positive.");
+    }
+  }
+
+  /**
+   * @brief Restart from (@p t0, @p y0) without reallocating.
+   *
+   * @throws std::invalid_argument If @p y0 has a different size than the
+   *         state the stepper was constructed with.
+   */
+  void Init(double t0, const StateType& y0) {
+    if (y0.size() != y_.size()) {
+      throw std::invalid_argument("State size must not change.");
+    }
+    std::copy(y0.begin(), y0.end(), y_.begin());
+    t_ = t0;
+    n_steps_ = 0;
+    n_rhs_evals_ = 0;
+  }
+
+  /// Advance by one step of size @c StepSize().
+  void Step() { Advance(h_); }
+
+  /**
+   * @brief Advance to @p t_target with steps of at most @c StepSize().
+   *
+   * The last step is shortened to land exactly on @p t_target, see
+   * @ref StepTowards.
+   *
+   * @throws std::invalid_argument If @p t_target is before @c Time().
+   */
+  void AdvanceTo(double t_target) {
+    if (t_target < t_) {
+      throw std::invalid_argument("Cannot advance to an earlier time.");
+    }
+    for (double h = StepTowards(t_, t_target, h_); h > 0.0;
+         h = StepTowards(t_, t_target, h_)) {
+      Advance(h);
+      if (h != h_) break;
+    }
+    t_ = t_target;
+  }
+
+  /// Current time.
+  double Time() const { return t_; }
+
+  /// Current state.
+  const StateType& State() const { return y_; }
+
+  /// Nominal step size.
+  double StepSize() const { return h_; }
+
+  /// Number of steps taken since construction or the last @c Init().
+  std::size_t NumSteps() const { return n_steps_; }
+
+  /// Number of right-hand side evaluations since construction or the last
+  /// @c Init().
+  std::size_t NumRhsEvals() const { return n_rhs_evals_; }
+
+ private:
+  // Take one step of size h
+  void Advance(double h) {
+    auto rhs = [this](double t, const StateType& y, StateType& dydt) {
+      ++n_rhs_evals_;
+      f_(t, y, dydt);
+    };
+    ExplicitRungeKuttaStep<Tableau>(rhs, t_, y_, h, y_, ws_);
+    t_ += h;
+    ++n_steps_;
+  }
+
+  F f_;
+  double t_;
+  double h_;
+  StateType y_;
+  ExplicitRKWorkspace<StateType, TableauTraits<Tableau>::kStages> ws_;
+  std::size_t n_steps_ = 0;
+  std::size_t n_rhs_evals_ = 0;
+};
+
+/// Stateful forward Euler integrator with an in-place right-hand side.
+using EulerForwardStepper = ExplicitRungeKuttaStepper<kEulerTableau>;
+
+/// Stateful classical Runge–Kutta integrator with an in-place right-hand
+/// side.
+using RungeKutta4Stepper = ExplicitRungeKuttaStepper<kRungeKutta4Tableau>;
+
+/**
+ * @brief Stateful fixed-step backward Euler integrator.
+ *
+ * Each step is solved by modified Newton iteration as in @c EulerBackward,
+ * which advances one of these internally, so stepping from @c t0 by
+ * @c Step() reproduces its solution exactly. A step performs at most
+ * @c opts.max_iters iterations for each of a bounded number of Jacobian
+ * updates. The iteration matrix is refactorised when the step size changes,
+ * which @c AdvanceTo() avoids for targets on the step grid.
+ *
+ * The stepper refers to its own members and can be neither copied nor
+ * moved.
+ */
+class EulerBackwardStepper {
+ public:
+  /**
+   * @brief Allocate storage and start at (@p t0, @p y0).
+   *
+   * @param f    Right-hand side function, copied into the stepper.
+   * @param t0   Initial time.
+   * @param y0   Initial state.
+   * @param h    Step size (must be positive).
+   * @param opts Newton iteration and Jacobian settings (optional).
+   *
+   * @throws std::invalid_argument If @p h <= 0 or @p opts.sparsity is
+   *         malformed or its size differs from @p y0.
+   */
+  EulerBackwardStepper(const InPlaceRhs& f, double t0,
+                       const std::vector<double>& y0, double h,
+                       const EBOptions& opts = {});
+
+  EulerBackwardStepper(const EulerBackwardStepper&) = delete;
+  EulerBackwardStepper& operator=(const EulerBackwardStepper&) = delete;
+
+  /**
+   * @brief Restart from (@p t0, @p y0) without reallocating.
+   *
+   * The Jacobian is re-evaluated on the next step.
+   *
+   * @throws std::invalid_argument If @p y0 has a different size than the
+   *         state the stepper was constructed with.
+   */
+  void Init(double t0, std::span<const double> y0);
+
+  /**
+   * @brief Advance by one step of size @c StepSize().
+   *
+   * @throws std::runtime_error If the Newton iteration fails to converge.
+   */
+  void Step();
+
+  /**
+   * @brief Advance to @p t_target with steps of at most @c StepSize().
+   *
+   * The last step is shortened to land exactly on @p t_target, see
+   * @ref StepTowards.
+   *
+   * @throws std::invalid_argument If @p t_target is before @c Time().
+   * @throws std::runtime_error    If the Newton iteration fails to converge.
+   */
+  void AdvanceTo(double t_target);
+
+  /// Current time.
+  double Time() const { return t_; }
+
+  /// Current state.
+  std::span<const double> State() const { return y_; }
+
+  /// Nominal step size.
+  double StepSize() const { return h_; }
+
+  /// Number of steps taken since construction or the last @c Init().
+  std::size_t NumSteps() const { return stats_.n_accepted; }
+
+  /**
+   * @brief Work counters since construction or the last @c Init().
+   *
+   * Includes Jacobian evaluations and factorisations, their right-hand side
+   * evaluations and the time spent in each phase except @c total.
+   */
+  Stats Statistics() const;
+
+ private:
+  // Take one step of size h
+  void Advance(double h);
+
+  InPlaceRhs f_;
+  EBOptions opts_;
+  double t_;
+  double h_;
+
+  // State, Newton iterate and work buffers
+  std::vector<double> y_, x_, fx_, res_;
+
+  // Iteration matrix I - h * J, reused across iterations and steps
+  IterationMatrix matrix_;
+  bool jacobian_stale_ = true;
+
+  // Counters of the stepper itself, and of the matrix at the last Init()
+  Stats stats_;
+  Stats matrix_base_;
+};
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_STEPPER_HPP_
@@ -0,0 +1,127 @@
+#ifndef CORE_ODE_SYMPLECTIC_HPP_
+#define CORE_ODE_SYMPLECTIC_HPP_
+
+/**
+ * @file symplectic.hpp
+ * @brief Symplectic integrators for separable second-order systems.
+ *
+ * This header declares splitting methods for mechanical systems of the form
+ * \f[
+ *    \dot{q} = v, \qquad \dot{v} = a(t, q),
+ * \f]
+ * where the acceleration depends on the positions only. The methods
+ * alternate exact position updates ("drifts") with exact velocity updates
+ * ("kicks"). For conservative forces they preserve the symplectic structure
+ * of the flow, so the energy error stays bounded over arbitrarily long
+ * horizons instead of drifting as it does for Runge–Kutta methods, and
+ * much larger steps can be taken for the same long-time fidelity.
+ *
+ * All solvers return rows \f$ [q, v] \f$, so the @c Solution has
+ * @c 2 * q0.size() components, positions first.
+ */
+
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "output.hpp"
+#include "solution.hpp"
+
+namespace vanta::ode {
+
+/**
+ * @brief Acceleration of a separable second-order system.
+ *
+ * The callable receives the time @p t and positions @p q and must write
+ * \f$ a(t, q) \f$, the force divided by the mass, into @p acc, which has
+ * the same size as @p q.
+ */
+using Acceleration = std::function<void(double t, std::span<const double> q,
+                                        std::span<double> acc)>;
+
+/**
+ * @brief Solve a separable second-order system using the velocity Verlet
+ * method.
+ *
+ * Each step is a half kick, a full drift and a half kick. The acceleration
+ * at the end of a step is reused for the first half kick of the next, so
+ * the method costs one acceleration evaluation per step. It is
+ * second-order accurate, symplectic and time-reversible, and velocities are
+ * available at the same times as positions.
+ *
+ * @param a   Acceleration of the system.
+ * @param t0  Initial time.
+ * @param t1  Final time.
+ * @param q0  Initial positions.
+ * @param v0  Initial velocities, the same size as @p q0.
+ * @param h   Time step size (must be positive).
+ * @param out Output selection and streaming options (optional).
+ *
+ * @return A @c Solution whose rows are \f$ [q, v] \f$.
+ *
+ * @throws std::invalid_argument If @p h <= 0, @p t1 <= @p t0, or @p q0 and
+ *         @p v0 differ in size.
+ */
+Solution VelocityVerlet(const Acceleration& a, double t0, double t1,
+                        const std::vector<double>& q0,
+                        const std::vector<double>& v0, double h,
+                        const OutputOptions& out = {});
+
+/**
+ * @brief Solve a separable second-order system using the leapfrog method.
+ *
+ * Each step is a half drift, a full kick at the midpoint and a half drift,
+ * costing one acceleration evaluation per step. It has the same order and
+ * conservation properties as @ref VelocityVerlet, but samples the force at
+ * mid-step positions, which suits forces that depend explicitly on time.
+ *
+ * @param a   Acceleration of the system.
+ * @param t0  Initial time.
+ * @param t1  Final time.
+ * @param q0  Initial positions.
+ * @param v0  Initial velocities, the same size as @p q0.
+ * @param h   Time step size (must be positive).
+ * @param out Output selection and streaming options (optional).
+ *
+ * @return A @c Solution whose rows are \f$ [q, v] \f$.
+ *
+ * @throws std::invalid_argument If @p h <= 0, @p t1 <= @p t0, or @p q0 and
+ *         @p v0 differ in size.
+ */
+Solution Leapfrog(const Acceleration& a, double t0, double t1,
+                  const std::vector<double>& q0,
+                  const std::vector<double>& v0, double h,
+                  const OutputOptions& out = {});
+
+/**
+ * @brief Solve a separable second-order system using Yoshida's
+ * fourth-order symplectic method.
+ *
+ * The step is a composition of three leapfrog steps with sizes
+ * \f$ w_1 h, w_0 h, w_1 h \f$, where
+ * \f$ w_1 = 1 / (2 - 2^{1/3}) \f$ and \f$ w_0 = 1 - 2 w_1 \f$, which
+ * cancels the third-order error terms. It costs three acceleration
+ * evaluations per step and, for smooth problems, allows much larger steps
+ * than the second-order methods at the same accuracy.
+ *
+ * @param a   Acceleration of the system.
+ * @param t0  Initial time.
+ * @param t1  Final time.
+ * @param q0  Initial positions.
+ * @param v0  Initial velocities, the same size as @p q0.
+ * @param h   Time step size (must be positive).
+ * @param out Output selection and streaming options (optional).
+ *
+ * @return A @c Solution whose rows are \f$ [q, v] \f$.
+ *
+ * @throws std::invalid_argument If @p h <= 0, @p t1 <= @p t0, or @p q0 and
+ *         @p v0 differ in size.
+ */
+Solution Yoshida4(const Acceleration& a, double t0, double t1,
+                  const std::vector<double>& q0,
+                  const std::vector<double>& v0, double h,
+                  const OutputOptions& out = {});
+
+}  // namespace vanta::ode
+
+#endif  // CORE_ODE_SYMPLECTIC_HPP_
@@ -0,0 +1,38 @@
+#ifndef CORE_ROOT_FINDERS_BRENT_HPP_
+#define CORE_ROOT_FINDERS_BRENT_HPP_
+
+/**
+ * @file brent.hpp
+ * @brief Bracketed scalar root finding using Brent's method.
+ */
+
+#include <functional>
+
+namespace vanta::root_finders {
+
+/**
+ * @brief Find a root of a scalar function inside a sign-changing bracket.
+ *
+ * Brent's method combines inverse quadratic interpolation and the secant
+ * method with bisection, so it converges superlinearly on smooth functions
+ * while never leaving the bracket \f$ [a, b] \f$ and never taking more
+ * iterations than bisection would need, up to a constant factor.
+ *
+ * @param f        Scalar function.
+ * @param a        One end of the bracket.
+ * @param b        Other end of the bracket.
+ * @param xtol     Absolute tolerance on the root location.
+ * @param max_iter Maximum number of iterations.
+ *
+ * @return A point within @p xtol (plus rounding) of a root of @p f.
+ *
+ * @throws std::invalid_argument If @p f(a) and @p f(b) have the same sign.
+ * @throws std::runtime_error If the tolerance is not met within
+ *         @p max_iter iterations.
+ */
+double Brent(const std::function<double(double)>& f, double a, double b,
+             double xtol = 1e-12, int max_iter = 100);
+
+}  // namespace vanta::root_finders
+
+#endif  // CORE_ROOT_FINDERS_BRENT_HPP_
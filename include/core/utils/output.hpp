@@ -9,6 +9,7 @@
  * such as writing time-dependent solution data to CSV files.
  */
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -40,6 +41,26 @@ namespace vanta::utils {
 int ToCSV(const std::string& filename, const std::vector<double>& t,
           const std::vector<std::vector<double>>& y);
 
+/**
+ * @brief Write time-series solution data stored in a flat buffer to a CSV
+ * file.
+ *
+ * Overload of @ref ToCSV for solution data held in a single contiguous
+ * row-major buffer, such as @c vanta::ode::Solution::y. The file format is
+ * identical to the nested-vector overload.
+ *
+ * @param filename Path to the output CSV file.
+ * @param t        Vector of time points.
+ * @param y        Row-major buffer of @p t.size() x @p n_states values.
+ * @param n_states Number of components in each solution vector.
+ *
+ * @return Zero on success, non-zero on failure (e.g. file could not be opened).
+ *
+ * @note The size of @p y must equal @p t.size() * @p n_states.
+ */
+int ToCSV(const std::string& filename, const std::vector<double>& t,
+          const std::vector<double>& y, std::size_t n_states);
+
 }  // namespace vanta::utils
 
 #endif  // CORE_UTILS_OUTPUT_HPP_
@@ -0,0 +1,86 @@
+#ifndef CORE_UTILS_THREAD_POOL_HPP_
+#define CORE_UTILS_THREAD_POOL_HPP_
+
+/**
+ * @file thread_pool.hpp
+ * @brief Fixed-size pool of worker threads.
+ *
+ * This header declares a simple thread pool used to run independent pieces
+ * of numerical work, such as shards of an ensemble or time slices of a
+ * parallel-in-time solve, concurrently.
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace vanta::utils {
+
+/**
+ * @brief Fixed-size pool of worker threads executing submitted tasks.
+ *
+ * Tasks are executed in submission order by the first free worker. The
+ * destructor finishes all queued tasks before joining the workers.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief Start a pool with @p n_threads workers.
+   *
+   * @param n_threads Number of worker threads. Zero selects
+   *                  @c std::thread::hardware_concurrency().
+   */
+  explicit ThreadPool(std::size_t n_threads = 0);
+
+  /**
+   * @brief Finish all queued tasks and join the worker threads.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// Number of worker threads.
+  std::size_t Size() const { return workers_.size(); }
+
+  /**
+   * @brief Queue a task for execution.
+   *
+   * @param task Callable taking no arguments.
+   *
+   * @return A future holding the task's result, or the exception it threw.
+   */
+  template <typename F>
+  std::future<std::invoke_result_t<F>> Submit(F&& task) {
+    using Result = std::invoke_result_t<F>;
+    auto packaged = std::make_shared<std::packaged_task<Result()>>(
+        std::forward<F>(task));
+    std::future<Result> result = packaged->get_future();
+    Enqueue([packaged]() { (*packaged)(); });
+    return result;
+  }
+
+ private:
+  // Add a job to the queue and wake a worker
+  void Enqueue(std::function<void()> job);
+
+  // Worker thread main loop
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> jobs_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_ = false;
+};
+
+}  // namespace vanta::utils
+
+#endif  // CORE_UTILS_THREAD_POOL_HPP_
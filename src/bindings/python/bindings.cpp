@@ -1,10 +1,14 @@
 #include <pybind11/pybind11.h>
 
+#include "ode/bdf_bindings.hpp"
+#include "ode/dormand_prince_45_bindings.hpp"
 #include "ode/euler_backward_bindings.hpp"
 #include "ode/euler_forward.hpp"
 #include "ode/euler_forward_bindings.hpp"
+#include "ode/rosenbrock_bindings.hpp"
 #include "ode/runge_kutta_4_bindings.hpp"
 #include "ode/solution_bindings.hpp"
+#include "ode/symplectic_bindings.hpp"
 #include "optimisers/genetic_algorithm_bindings.hpp"
 #include "optimisers/gradient_descent_bindings.hpp"
 #include "optimisers/particle_swarm_bindings.hpp"
@@ -21,6 +25,13 @@ PYBIND11_MODULE(vanta_core_py, m, pybind11::mod_gil_not_used()) {
   vanta::bindings::python::ode::BindEulerForward(m_ode);
   vanta::bindings::python::ode::BindRungeKutta4(m_ode);
   vanta::bindings::python::ode::BindEulerBackward(m_ode);
+  vanta::bindings::python::ode::BindDP45Options(m_ode);
+  vanta::bindings::python::ode::BindDormandPrince45(m_ode);
+  vanta::bindings::python::ode::BindBDFOptions(m_ode);
+  vanta::bindings::python::ode::BindBDF(m_ode);
+  vanta::bindings::python::ode::BindRosenbrockOptions(m_ode);
+  vanta::bindings::python::ode::BindRosenbrock(m_ode);
+  vanta::bindings::python::ode::BindSymplectic(m_ode);
 
   auto m_optimisers = m.def_submodule("optimisers", R"pbdoc(
         Optimisation algorithms
@@ -0,0 +1,115 @@
+#include "ode/bdf_bindings.hpp"
+
+#include <pybind11/functional.h>
+#include <pybind11/numpy.h>
+
+#include "ode/bdf.hpp"
+
+namespace vanta::bindings::python::ode {
+
+void BindBDFOptions(pybind11::module_& m) {
+  pybind11::class_<vanta::ode::BDFOptions>(m, "BDFOptions")
+      .def(pybind11::init<>())
+      .def_readwrite("rtol", &vanta::ode::BDFOptions::rtol)
+      .def_readwrite("atol", &vanta::ode::BDFOptions::atol)
+      .def_readwrite("h0", &vanta::ode::BDFOptions::h0)
+      .def_readwrite("h_max", &vanta::ode::BDFOptions::h_max)
+      .def_readwrite("max_steps", &vanta::ode::BDFOptions::max_steps)
+      .def_readwrite("max_order", &vanta::ode::BDFOptions::max_order)
+      .doc() = R"pbdoc(
+BDF configuration options.
+
+Controls error tolerances, the adaptive step size and the highest order.
+The Jacobian is approximated by finite differences.
+
+Attributes
+----------
+rtol : float
+    Relative error tolerance.
+atol : float
+    Absolute error tolerance.
+h0 : float
+    Initial step size (0 = choose automatically).
+h_max : float
+    Largest step size the controller may take.
+max_steps : int
+    Maximum number of attempted steps.
+max_order : int
+    Highest order the method may use (1 to 5).
+)pbdoc";
+}
+
+void BindBDF(pybind11::module_& m) {
+  m.def(
+      "bdf",
+      [](std::function<pybind11::array_t<double>(double,
+                                                 pybind11::array_t<double>)>
+             f,
+         double t0, double t1, pybind11::array_t<double> y0,
+         vanta::ode::BDFOptions opts) {
+        // Wrap the numpy-compatible callable into the signature BDF expects
+        auto f_wrapped = [&f](double t, const std::vector<double>& y) {
+          pybind11::array_t<double> y_arr(y.size(), y.data());
+          pybind11::array_t<double> dy_arr = f(t, y_arr);
+          auto buf = dy_arr.request();
+          auto* ptr = static_cast<double*>(buf.ptr);
+          return std::vector<double>(ptr, ptr + buf.size);
+        };
+
+        // Convert y0 from numpy array to std::vector
+        auto buf = y0.request();
+        auto* ptr = static_cast<double*>(buf.ptr);
+        std::vector<double> y0_vec(ptr, ptr + buf.size);
+
+        return vanta::ode::BDF(f_wrapped, t0, t1, y0_vec, opts);
+      },
+      pybind11::arg("f"), pybind11::arg("t0"), pybind11::arg("t1"),
+      pybind11::arg("y0"), pybind11::arg("opts") = vanta::ode::BDFOptions(),
+      R"pbdoc(
+            Solve a stiff ODE using the variable-order BDF method.
+
+            Numerically integrates the ODE system
+
+                dy/dt = f(t, y)
+
+            over ``[t0, t1]`` with backward differentiation formulas of
+            order 1 to 5, adapting step size and order so that the estimated
+            local error stays within ``opts.rtol`` and ``opts.atol``.
+
+            Parameters
+            ----------
+            f : Callable[[float, list[float]], list[float]]
+                Right-hand side of the ODE. Receives the current time ``t``
+                and state vector ``y``, returns the derivative ``dy/dt``.
+            t0 : float
+                Initial time.
+            t1 : float
+                Final time.
+            y0 : list[float]
+                Initial state vector at ``t0``.
+            opts : BDFOptions
+                Tolerances, step size and order settings.
+
+            Returns
+            -------
+            Solution
+                Object with attributes ``t`` (accepted time points ending at
+                ``t1``), ``y`` (corresponding state vectors) and ``stats``
+                (evaluation, factorisation and step counts).
+
+            Examples
+            --------
+            Solve the stiff decay equation  dy/dt = -1000 (y - cos t):
+
+            >>> import math
+            >>> from vanta_core_py.ode import bdf
+            >>> sol = bdf(
+            ...     f=lambda t, y: [-1000.0 * (y[0] - math.cos(t))],
+            ...     t0=0.0, t1=1.0, y0=[0.0]
+            ... )
+            >>> sol.t[-1]
+            1.0
+        )pbdoc");
+}
+
+}  // namespace vanta::bindings::python::ode
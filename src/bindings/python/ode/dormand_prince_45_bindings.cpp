@@ -0,0 +1,125 @@
+#include "ode/dormand_prince_45_bindings.hpp"
+
+#include <pybind11/functional.h>
+#include <pybind11/numpy.h>
+
+#include "ode/dormand_prince_45.hpp"
+
+namespace vanta::bindings::python::ode {
+
+void BindDP45Options(pybind11::module_& m) {
+  pybind11::class_<vanta::ode::DP45Options>(m, "DP45Options")
+      .def(pybind11::init<>())
+      .def_readwrite("rtol", &vanta::ode::DP45Options::rtol)
+      .def_readwrite("atol", &vanta::ode::DP45Options::atol)
+      .def_readwrite("h0", &vanta::ode::DP45Options::h0)
+      .def_readwrite("h_max", &vanta::ode::DP45Options::h_max)
+      .def_readwrite("max_steps", &vanta::ode::DP45Options::max_steps)
+      .def_readwrite("safety", &vanta::ode::DP45Options::safety)
+      .def_readwrite("min_factor", &vanta::ode::DP45Options::min_factor)
+      .def_readwrite("max_factor", &vanta::ode::DP45Options::max_factor)
+      .def_readwrite("beta", &vanta::ode::DP45Options::beta)
+      .doc() = R"pbdoc(
+Dormand-Prince configuration options.
+
+Controls error tolerances and the adaptive step size controller.
+
+Attributes
+----------
+rtol : float
+    Relative error tolerance.
+atol : float
+    Absolute error tolerance.
+h0 : float
+    Initial step size (0 = choose automatically).
+h_max : float
+    Largest step size the controller may take.
+max_steps : int
+    Maximum number of attempted steps.
+safety : float
+    Safety factor applied to the optimal step size.
+min_factor : float
+    Smallest factor by which a step may shrink.
+max_factor : float
+    Largest factor by which a step may grow.
+beta : float
+    Proportional-integral controller gain on the previous error.
+)pbdoc";
+}
+
+void BindDormandPrince45(pybind11::module_& m) {
+  m.def(
+      "dormand_prince_45",
+      [](std::function<pybind11::array_t<double>(double,
+                                                 pybind11::array_t<double>)>
+             f,
+         double t0, double t1, pybind11::array_t<double> y0,
+         vanta::ode::DP45Options opts) {
+        // Wrap the numpy-compatible callable into the signature
+        // DormandPrince45 expects
+        auto f_wrapped = [&f](double t, const std::vector<double>& y) {
+          pybind11::array_t<double> y_arr(y.size(), y.data());
+          pybind11::array_t<double> dy_arr = f(t, y_arr);
+          auto buf = dy_arr.request();
+          auto* ptr = static_cast<double*>(buf.ptr);
+          return std::vector<double>(ptr, ptr + buf.size);
+        };
+
+        // Convert y0 from numpy array to std::vector
+        auto buf = y0.request();
+        auto* ptr = static_cast<double*>(buf.ptr);
+        std::vector<double> y0_vec(ptr, ptr + buf.size);
+
+        return vanta::ode::DormandPrince45(f_wrapped, t0, t1, y0_vec, opts);
+      },
+      pybind11::arg("f"), pybind11::arg("t0"), pybind11::arg("t1"),
+      pybind11::arg("y0"), pybind11::arg("opts") = vanta::ode::DP45Options(),
+      R"pbdoc(
+            Solve an ODE using the adaptive Dormand-Prince RK5(4) method.
+
+            Numerically integrates the ODE system
+
+                dy/dt = f(t, y)
+
+            over ``[t0, t1]``, choosing each step size so that the estimated
+            local error stays within ``opts.rtol`` and ``opts.atol``.
+
+            Parameters
+            ----------
+            f : Callable[[float, list[float]], list[float]]
+                Right-hand side of the ODE. Receives the current time ``t``
+                and state vector ``y``, returns the derivative ``dy/dt``.
+            t0 : float
+                Initial time.
+            t1 : float
+                Final time.
+            y0 : list[float]
+                Initial state vector at ``t0``.
+            opts : DP45Options
+                Tolerances and step size controller settings.
+
+            Returns
+            -------
+            Solution
+                Object with attributes ``t`` (accepted time points ending at
+                ``t1``), ``y`` (corresponding state vectors) and ``stats``
+                (evaluation and step counts).
+
+            Examples
+            --------
+            Solve the scalar decay equation  dy/dt = -y,  y(0) = 1:
+
+            >>> from vanta_core_py.ode import dormand_prince_45, DP45Options
+            >>> opts = DP45Options()
+            >>> opts.rtol = 1e-8
+            >>> sol = dormand_prince_45(
+            ...     f=lambda t, y: [-y[0]],
+            ...     t0=0.0, t1=5.0,
+            ...     y0=[1.0], opts=opts
+            ... )
+            >>> sol.t[-1]
+            5.0
+        )pbdoc");
+}
+
+}  // namespace vanta::bindings::python::ode
@@ -2,9 +2,74 @@
 
 #include <pybind11/numpy.h>
 
+#include <span>
+#include <vector>
+
+#include "ode/phase_timer.hpp"
+
 namespace vanta::bindings::python::ode {
 
 void BindSolution(pybind11::module_& m) {
+  m.attr("timing_enabled") = static_cast<bool>(VANTA_ODE_TIMING);
+
+  pybind11::class_<vanta::ode::PhaseTimes>(m, "PhaseTimes", R"pbdoc(
+        Wall time spent by an ODE solver in each phase, in seconds.
+
+        All zero unless the library was built with ``ODE_TIMING``, which is
+        off by default; ``timing_enabled`` reports which.
+
+        Attributes
+        ----------
+        rhs : float
+            Right-hand side calls made by the stepper itself.
+        jacobian : float
+            Jacobian evaluations, including finite differences.
+        linear_solve : float
+            Forming, factorising and solving iteration matrices.
+        total : float
+            The whole solver call.
+        other : float
+            Time outside the measured phases.
+    )pbdoc")
+      .def(pybind11::init<>())
+      .def_readonly("rhs", &vanta::ode::PhaseTimes::rhs)
+      .def_readonly("jacobian", &vanta::ode::PhaseTimes::jacobian)
+      .def_readonly("linear_solve", &vanta::ode::PhaseTimes::linear_solve)
+      .def_readonly("total", &vanta::ode::PhaseTimes::total)
+      .def_property_readonly("other", &vanta::ode::PhaseTimes::Other);
+
+  pybind11::class_<vanta::ode::Stats>(m, "Stats", R"pbdoc(
+        Counters describing the work performed by an ODE solver.
+
+        Attributes
+        ----------
+        n_rhs_evals : int
+            Number of right-hand side evaluations.
+        n_accepted : int
+            Number of accepted steps.
+        n_rejected : int
+            Number of steps rejected by error control.
+        n_jacobian_evals : int
+            Number of Jacobian evaluations by implicit solvers.
+        n_factorisations : int
+            Number of iteration matrix factorisations by implicit solvers.
+        n_fast_rhs_evals : int
+            Number of fast partition evaluations by multirate solvers.
+        n_newton_iters : int
+            Number of Newton iterations by implicit solvers.
+        time : PhaseTimes
+            Wall time per phase.
+    )pbdoc")
+      .def(pybind11::init<>())
+      .def_readonly("n_rhs_evals", &vanta::ode::Stats::n_rhs_evals)
+      .def_readonly("n_accepted", &vanta::ode::Stats::n_accepted)
+      .def_readonly("n_rejected", &vanta::ode::Stats::n_rejected)
+      .def_readonly("n_jacobian_evals", &vanta::ode::Stats::n_jacobian_evals)
+      .def_readonly("n_factorisations", &vanta::ode::Stats::n_factorisations)
+      .def_readonly("n_fast_rhs_evals", &vanta::ode::Stats::n_fast_rhs_evals)
+      .def_readonly("n_newton_iters", &vanta::ode::Stats::n_newton_iters)
+      .def_readonly("time", &vanta::ode::Stats::time);
+
   pybind11::class_<vanta::ode::Solution>(m, "Solution", R"pbdoc(
         Container for a numerical ODE solution.
  
@@ -15,6 +80,11 @@ void BindSolution(pybind11::module_& m) {
         y : list[list[float]]
             State vectors corresponding to each time point.
             ``y[i]`` is the state vector at time ``t[i]``.
+        dydt : numpy.ndarray
+            Derivatives at each time point, laid out like ``y``. Empty
+            unless the solver stored dense output.
+        stats : Stats
+            Work counters reported by adaptive solvers.
     )pbdoc")
       .def(pybind11::init<>())
       .def(pybind11::init<>())
@@ -32,26 +102,88 @@ void BindSolution(pybind11::module_& m) {
       .def_property(
           "y",
           [](const vanta::ode::Solution& s) {
-            if (s.y.empty()) return pybind11::array_t<double>({0, 0});
-            size_t rows = s.y.size();
-            size_t cols = s.y[0].size();
-            pybind11::array_t<double> arr({rows, cols});
-            auto buf = arr.mutable_unchecked<2>();
-            for (size_t i = 0; i < rows; i++)
-              for (size_t j = 0; j < cols; j++) buf(i, j) = s.y[i][j];
-            return arr;
+            // Copy the contiguous row-major buffer in a single block
+            size_t cols = s.NumStates();
+            size_t rows = cols == 0 ? 0 : s.y.size() / cols;
+            return pybind11::array_t<double>({rows, cols}, s.y.data());
           },
-          [](vanta::ode::Solution& s, pybind11::array_t<double> arr) {
+          [](vanta::ode::Solution& s,
+             pybind11::array_t<double, pybind11::array::c_style |
+                                           pybind11::array::forcecast>
+                 arr) {
             auto buf = arr.request();
             if (buf.ndim != 2) throw std::runtime_error("y must be a 2D array");
             auto* ptr = static_cast<double*>(buf.ptr);
-            size_t rows = buf.shape[0];
-            size_t cols = buf.shape[1];
-            s.y.assign(rows, std::vector<double>(cols));
-            for (size_t i = 0; i < rows; i++)
-              for (size_t j = 0; j < cols; j++) s.y[i][j] = ptr[i * cols + j];
+            s.n_states = buf.shape[1];
+            s.y.assign(ptr, ptr + buf.size);
           },
           "Solution vectors corresponding to each time point.")
+      .def_property_readonly(
+          "dydt",
+          [](const vanta::ode::Solution& s) {
+            size_t cols = s.NumStates();
+            size_t rows = cols == 0 ? 0 : s.dydt.size() / cols;
+            return pybind11::array_t<double>({rows, cols}, s.dydt.data());
+          },
+          "Derivatives at each time point, if stored.")
+      .def(
+          "at",
+          [](const vanta::ode::Solution& s, double time) {
+            std::vector<double> y = s.At(time);
+            return pybind11::array_t<double>(y.size(), y.data());
+          },
+          pybind11::arg("t"), R"pbdoc(
+        Evaluate the solution at an arbitrary time.
+
+        Uses cubic Hermite interpolation within the step containing ``t``,
+        with stored derivatives if available and estimated ones otherwise.
+
+        Parameters
+        ----------
+        t : float
+            Evaluation time within the stored time points.
+
+        Returns
+        -------
+        numpy.ndarray
+            Interpolated state vector.
+
+        Raises
+        ------
+        ValueError
+            If ``t`` lies outside the stored time points.
+    )pbdoc")
+      .def(
+          "sample",
+          [](const vanta::ode::Solution& s,
+             pybind11::array_t<double, pybind11::array::c_style |
+                                           pybind11::array::forcecast>
+                 times) {
+            auto buf = times.request();
+            const auto* ptr = static_cast<const double*>(buf.ptr);
+            return s.Sample(std::span<const double>(
+                ptr, static_cast<size_t>(buf.size)));
+          },
+          pybind11::arg("times"), R"pbdoc(
+        Evaluate the solution at several times.
+
+        Parameters
+        ----------
+        times : array_like
+            Evaluation times, in any order, within the stored time points.
+
+        Returns
+        -------
+        Solution
+            A solution with one row per requested time.
+
+        Raises
+        ------
+        ValueError
+            If a time lies outside the stored time points.
+    )pbdoc")
+      .def_readonly("stats", &vanta::ode::Solution::stats,
+                    "Work counters reported by adaptive solvers.")
       .def("__repr__",
            [](const vanta::ode::Solution& s) {
              return "<Solution: " + std::to_string(s.t.size()) + " time steps>";
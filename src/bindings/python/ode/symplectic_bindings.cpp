@@ -0,0 +1,160 @@
+#include "ode/symplectic_bindings.hpp"
+
+#include <pybind11/functional.h>
+#include <pybind11/numpy.h>
+
+#include <algorithm>
+
+#include "ode/symplectic.hpp"
+
+namespace vanta::bindings::python::ode {
+
+namespace {
+
+// Python acceleration a(t, q) returning an array of the same size as q
+using PyAcceleration = std::function<pybind11::array_t<double>(
+    double, pybind11::array_t<double>)>;
+
+// Signature shared by the symplectic solvers
+using SymplecticSolver = vanta::ode::Solution (*)(
+    const vanta::ode::Acceleration&, double, double,
+    const std::vector<double>&, const std::vector<double>&, double,
+    const vanta::ode::OutputOptions&);
+
+// Wrap a solver so that it accepts numpy-compatible arguments
+auto Wrap(SymplecticSolver solver) {
+  return [solver](PyAcceleration a, double t0, double t1,
+                  pybind11::array_t<double> q0, pybind11::array_t<double> v0,
+                  double h) {
+    // Wrap the numpy-compatible callable into the in-place signature
+    auto a_wrapped = [&a](double t, std::span<const double> q,
+                          std::span<double> acc) {
+      pybind11::array_t<double> q_arr(q.size(), q.data());
+      pybind11::array_t<double> acc_arr = a(t, q_arr);
+      auto buf = acc_arr.request();
+      auto* ptr = static_cast<double*>(buf.ptr);
+      std::copy(ptr, ptr + acc.size(), acc.begin());
+    };
+
+    // Convert q0 and v0 from numpy arrays to std::vector
+    auto q_buf = q0.request();
+    auto* q_ptr = static_cast<double*>(q_buf.ptr);
+    std::vector<double> q0_vec(q_ptr, q_ptr + q_buf.size);
+    auto v_buf = v0.request();
+    auto* v_ptr = static_cast<double*>(v_buf.ptr);
+    std::vector<double> v0_vec(v_ptr, v_ptr + v_buf.size);
+
+    return solver(a_wrapped, t0, t1, q0_vec, v0_vec, h, {});
+  };
+}
+
+}  // namespace
+
+void BindSymplectic(pybind11::module_& m) {
+  m.def("velocity_verlet", Wrap(vanta::ode::VelocityVerlet),
+        pybind11::arg("a"), pybind11::arg("t0"), pybind11::arg("t1"),
+        pybind11::arg("q0"), pybind11::arg("v0"), pybind11::arg("h"),
+        R"pbdoc(
+            Solve q'' = a(t, q) using the velocity Verlet method.
+
+            Second-order symplectic method costing one acceleration
+            evaluation per step. The energy error stays bounded over long
+            horizons instead of drifting.
+
+            Parameters
+            ----------
+            a : Callable[[float, list[float]], list[float]]
+                Acceleration of the system. Receives the current time ``t``
+                and positions ``q``, returns ``d^2q/dt^2``, which must not
+                depend on the velocities.
+            t0 : float
+                Initial time.
+            t1 : float
+                Final time.
+            q0 : list[float]
+                Initial positions.
+            v0 : list[float]
+                Initial velocities, the same size as ``q0``.
+            h : float
+                Time step size.
+
+            Returns
+            -------
+            Solution
+                Object with attributes ``t`` (time grid), ``y`` (rows of
+                positions followed by velocities) and ``stats``
+                (acceleration evaluations and steps).
+        )pbdoc");
+
+  m.def("leapfrog", Wrap(vanta::ode::Leapfrog), pybind11::arg("a"),
+        pybind11::arg("t0"), pybind11::arg("t1"), pybind11::arg("q0"),
+        pybind11::arg("v0"), pybind11::arg("h"),
+        R"pbdoc(
+            Solve q'' = a(t, q) using the leapfrog method.
+
+            Drift-kick-drift form of velocity Verlet, sampling the
+            acceleration at the midpoint of each step. Second-order
+            symplectic, one acceleration evaluation per step.
+
+            Parameters
+            ----------
+            a : Callable[[float, list[float]], list[float]]
+                Acceleration of the system. Receives the current time ``t``
+                and positions ``q``, returns ``d^2q/dt^2``, which must not
+                depend on the velocities.
+            t0 : float
+                Initial time.
+            t1 : float
+                Final time.
+            q0 : list[float]
+                Initial positions.
+            v0 : list[float]
+                Initial velocities, the same size as ``q0``.
+            h : float
+                Time step size.
+
+            Returns
+            -------
+            Solution
+                Object with attributes ``t`` (time grid), ``y`` (rows of
+                positions followed by velocities) and ``stats``
+                (acceleration evaluations and steps).
+        )pbdoc");
+
+  m.def("yoshida_4", Wrap(vanta::ode::Yoshida4), pybind11::arg("a"),
+        pybind11::arg("t0"), pybind11::arg("t1"), pybind11::arg("q0"),
+        pybind11::arg("v0"), pybind11::arg("h"),
+        R"pbdoc(
+            Solve q'' = a(t, q) using Yoshida's fourth-order method.
+
+            Composition of three leapfrog steps that is fourth-order
+            accurate and symplectic, costing three acceleration evaluations
+            per step.
+
+            Parameters
+            ----------
+            a : Callable[[float, list[float]], list[float]]
+                Acceleration of the system. Receives the current time ``t``
+                and positions ``q``, returns ``d^2q/dt^2``, which must not
+                depend on the velocities.
+            t0 : float
+                Initial time.
+            t1 : float
+                Final time.
+            q0 : list[float]
+                Initial positions.
+            v0 : list[float]
+                Initial velocities, the same size as ``q0``.
+            h : float
+                Time step size.
+
+            Returns
+            -------
+            Solution
+                Object with attributes ``t`` (time grid), ``y`` (rows of
+                positions followed by velocities) and ``stats``
+                (acceleration evaluations and steps).
+        )pbdoc");
+}
+
+}  // namespace vanta::bindings::python::ode
@@ -1,5 +1,9 @@
 #include "finite_difference/forward_difference.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace vanta::finite_difference {
 
 std::vector<std::vector<double>> ForwardDifference(
@@ -26,4 +30,188 @@ std::vector<std::vector<double>> ForwardDifference(
   return jacobian;
 }
 
+void ForwardDifference(
+    const std::function<void(std::span<const double>, std::span<double>)>& f,
+    std::span<const double> x, std::span<const double> fx,
+    std::span<double> jacobian, std::span<double> work) {
+  // Determine sizes
+  const size_t n_x = x.size();
+  const size_t n_f = fx.size();
+  const double sqrt_eps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+  // Perturbed point and function value, in the caller's scratch if given
+  std::vector<double> own_work(work.empty() ? n_x + n_f : 0);
+  if (work.empty()) work = own_work;
+  const std::span<double> x_perturbed = work.first(n_x);
+  const std::span<double> fx_perturbed = work.subspan(n_x, n_f);
+  std::copy(x.begin(), x.end(), x_perturbed.begin());
+
+  for (size_t i = 0; i < n_x; ++i) {
+    // Scaled step, rounded so that x + h is exactly representable
+    const double x_i = x_perturbed[i];
+    x_perturbed[i] = x_i + sqrt_eps * std::max(std::fabs(x_i), 1.0);
+    const double h = x_perturbed[i] - x_i;
+    f(x_perturbed, fx_perturbed);
+    x_perturbed[i] = x_i;
+
+    for (size_t j = 0; j < n_f; ++j) {
+      jacobian[j * n_x + i] = (fx_perturbed[j] - fx[j]) / h;
+    }
+  }
+}
+
+std::vector<std::size_t> ColourColumns(
+    const vanta::linear_solvers::SparsityPattern& pattern) {
+  const std::size_t n = pattern.n;
+  const auto& row_ptr = pattern.row_ptr;
+  const auto& col_idx = pattern.col_idx;
+
+  // Rows in which each column has a nonzero
+  std::vector<std::size_t> col_ptr(n + 1, 0);
+  for (std::size_t j : col_idx) ++col_ptr[j + 1];
+  for (std::size_t j = 0; j < n; ++j) col_ptr[j + 1] += col_ptr[j];
+  std::vector<std::size_t> col_rows(col_idx.size());
+  std::vector<std::size_t> next(col_ptr.begin(), col_ptr.end() - 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t p = row_ptr[i]; p < row_ptr[i + 1]; ++p) {
+      col_rows[next[col_idx[p]]++] = i;
+    }
+  }
+
+  // Greedily give each column the smallest colour unused by its neighbours
+  constexpr std::size_t kNone = static_cast<std::size_t>(-1);
+  std::vector<std::size_t> colours(n, kNone);
+  std::vector<std::size_t> used_by(n, kNone);
+  for (std::size_t j = 0; j < n; ++j) {
+    for (std::size_t q = col_ptr[j]; q < col_ptr[j + 1]; ++q) {
+      const std::size_t i = col_rows[q];
+      for (std::size_t p = row_ptr[i]; p < row_ptr[i + 1]; ++p) {
+        const std::size_t c = colours[col_idx[p]];
+        if (c != kNone) used_by[c] = j;
+      }
+    }
+    std::size_t colour = 0;
+    while (used_by[colour] == j) ++colour;
+    colours[j] = colour;
+  }
+
+  return colours;
+}
+
+void ForwardDifference(
+    const std::function<void(std::span<const double>, std::span<double>)>& f,
+    std::span<const double> x, std::span<const double> fx,
+    const vanta::linear_solvers::SparsityPattern& pattern,
+    std::span<const std::size_t> colours, std::span<double> values,
+    std::span<double> work) {
+  const std::size_t n = pattern.n;
+  const double sqrt_eps = std::sqrt(std::numeric_limits<double>::epsilon());
+  const std::size_t n_colours =
+      n == 0 ? 0 : *std::max_element(colours.begin(), colours.end()) + 1;
+
+  // Perturbed point, function value and steps, in the caller's scratch if
+  // given
+  std::vector<double> own_work(work.empty() ? 3 * n : 0);
+  if (work.empty()) work = own_work;
+  const std::span<double> x_perturbed = work.first(n);
+  const std::span<double> fx_perturbed = work.subspan(n, n);
+  const std::span<double> h = work.subspan(2 * n, n);
+  std::copy(x.begin(), x.end(), x_perturbed.begin());
+
+  for (std::size_t colour = 0; colour < n_colours; ++colour) {
+    // Perturb every column of this colour at once
+    for (std::size_t j = 0; j < n; ++j) {
+      if (colours[j] != colour) continue;
+      x_perturbed[j] = x[j] + sqrt_eps * std::max(std::fabs(x[j]), 1.0);
+      h[j] = x_perturbed[j] - x[j];
+    }
+    f(x_perturbed, fx_perturbed);
+
+    // Each row has at most one nonzero in a column of this colour
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t p = pattern.row_ptr[i]; p < pattern.row_ptr[i + 1];
+           ++p) {
+        const std::size_t j = pattern.col_idx[p];
+        if (colours[j] == colour) values[p] = (fx_perturbed[i] - fx[i]) / h[j];
+      }
+    }
+
+    for (std::size_t j = 0; j < n; ++j) {
+      if (colours[j] == colour) x_perturbed[j] = x[j];
+    }
+  }
+}
+
+void BatchForwardDifference(const BatchFunction& f,
+                            std::span<const double> x,
+                            std::span<const double> fx,
+                            std::span<double> jacobian,
+                            std::span<double> work) {
+  // Determine sizes
+  const size_t n_x = x.size();
+  const size_t n_f = fx.size();
+  const double sqrt_eps = std::sqrt(std::numeric_limits<double>::epsilon());
+  if (n_x == 0) return;
+
+  // Perturbed points and their function values, one point per column, in
+  // the caller's scratch if given
+  std::vector<double> own_work(work.empty() ? n_x * (n_x + n_f) : 0);
+  if (work.empty()) work = own_work;
+  const std::span<double> x_batch = work.first(n_x * n_x);
+  const std::span<double> fx_batch = work.subspan(n_x * n_x, n_f * n_x);
+
+  // Point i is x with component i stepped as in the in-place overload
+  for (size_t j = 0; j < n_x; ++j) {
+    std::fill_n(x_batch.begin() + j * n_x, n_x, x[j]);
+    x_batch[j * n_x + j] = x[j] + sqrt_eps * std::max(std::fabs(x[j]), 1.0);
+  }
+  f(x_batch, fx_batch, n_x);
+
+  // Value j of point i sits where the row-major Jacobian keeps (j, i)
+  for (size_t i = 0; i < n_x; ++i) {
+    const double h = x_batch[i * n_x + i] - x[i];
+    for (size_t j = 0; j < n_f; ++j) {
+      jacobian[j * n_x + i] = (fx_batch[j * n_x + i] - fx[j]) / h;
+    }
+  }
+}
+
+void BatchForwardDifference(
+    const BatchFunction& f, std::span<const double> x,
+    std::span<const double> fx,
+    const vanta::linear_solvers::SparsityPattern& pattern,
+    std::span<const std::size_t> colours, std::span<double> values,
+    std::span<double> work) {
+  const std::size_t n = pattern.n;
+  const double sqrt_eps = std::sqrt(std::numeric_limits<double>::epsilon());
+  const std::size_t n_colours =
+      n == 0 ? 0 : *std::max_element(colours.begin(), colours.end()) + 1;
+  if (n_colours == 0) return;
+
+  // Perturbed points, one per colour, their function values and the steps,
+  // in the caller's scratch if given
+  std::vector<double> own_work(work.empty() ? (2 * n_colours + 1) * n : 0);
+  if (work.empty()) work = own_work;
+  const std::span<double> x_batch = work.first(n * n_colours);
+  const std::span<double> fx_batch = work.subspan(n * n_colours, n * n_colours);
+  const std::span<double> h = work.subspan(2 * n * n_colours, n);
+
+  // Point c perturbs every column of colour c
+  for (std::size_t j = 0; j < n; ++j) {
+    std::fill_n(x_batch.begin() + j * n_colours, n_colours, x[j]);
+    double& x_j = x_batch[j * n_colours + colours[j]];
+    x_j = x[j] + sqrt_eps * std::max(std::fabs(x[j]), 1.0);
+    h[j] = x_j - x[j];
+  }
+  f(x_batch, fx_batch, n_colours);
+
+  // Each row has at most one nonzero in a column of each colour
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t p = pattern.row_ptr[i]; p < pattern.row_ptr[i + 1]; ++p) {
+      const std::size_t j = pattern.col_idx[p];
+      values[p] = (fx_batch[i * n_colours + colours[j]] - fx[i]) / h[j];
+    }
+  }
+}
+
 }  // namespace vanta::finite_difference
@@ -0,0 +1,74 @@
+#include "linear_solvers/lu_decomposition.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace vanta::linear_solvers {
+
+void LUFactorise(std::span<const double> A, std::size_t n,
+                 LUFactors& factors) {
+  // Validate input arguments
+  if (A.size() != n * n) {
+    throw std::invalid_argument("Matrix must have n x n elements.");
+  }
+
+  // Copy the matrix into the factor storage
+  factors.n = n;
+  factors.lu.assign(A.begin(), A.end());
+  factors.pivots.resize(n);
+  double* lu = factors.lu.data();
+
+  for (std::size_t i = 0; i < n; ++i) {
+    // Partial pivoting
+    std::size_t max_row = i;
+    for (std::size_t k = i + 1; k < n; ++k) {
+      if (std::fabs(lu[k * n + i]) > std::fabs(lu[max_row * n + i])) {
+        max_row = k;
+      }
+    }
+    factors.pivots[i] = max_row;
+    if (lu[max_row * n + i] == 0.0) {
+      throw std::runtime_error("Matrix is singular.");
+    }
+    if (max_row != i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        std::swap(lu[i * n + j], lu[max_row * n + j]);
+      }
+    }
+
+    // Eliminate below the pivot, storing the multipliers in place
+    const double inv_pivot = 1.0 / lu[i * n + i];
+    for (std::size_t k = i + 1; k < n; ++k) {
+      const double factor = lu[k * n + i] * inv_pivot;
+      lu[k * n + i] = factor;
+      for (std::size_t j = i + 1; j < n; ++j) {
+        lu[k * n + j] -= factor * lu[i * n + j];
+      }
+    }
+  }
+}
+
+void LUSolve(const LUFactors& factors, std::span<double> b) {
+  const std::size_t n = factors.n;
+  const double* lu = factors.lu.data();
+
+  // Apply the row permutation and forward substitution with L
+  for (std::size_t i = 0; i < n; ++i) {
+    std::swap(b[i], b[factors.pivots[i]]);
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    double sum = b[i];
+    for (std::size_t j = 0; j < i; ++j) sum -= lu[i * n + j] * b[j];
+    b[i] = sum;
+  }
+
+  // Back substitution with U
+  for (std::size_t i = n; i-- > 0;) {
+    double sum = b[i];
+    for (std::size_t j = i + 1; j < n; ++j) sum -= lu[i * n + j] * b[j];
+    b[i] = sum / lu[i * n + i];
+  }
+}
+
+}  // namespace vanta::linear_solvers
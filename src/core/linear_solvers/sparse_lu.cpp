@@ -0,0 +1,214 @@
+#include "linear_solvers/sparse_lu.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace vanta::linear_solvers {
+
+namespace {
+
+// Minimum degree ordering of the graph of A + A^T: repeatedly eliminate the
+// vertex with the fewest neighbours and join its neighbours into a clique,
+// as its elimination fills them in. Ties go to the lowest index, so banded
+// matrices keep their natural order.
+std::vector<std::size_t> MinimumDegreeOrder(const SparsityPattern& pattern) {
+  const std::size_t n = pattern.n;
+  std::vector<std::vector<std::size_t>> adjacent(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t p = pattern.row_ptr[i]; p < pattern.row_ptr[i + 1]; ++p) {
+      const std::size_t j = pattern.col_idx[p];
+      if (j == i) continue;
+      adjacent[i].push_back(j);
+      adjacent[j].push_back(i);
+    }
+  }
+
+  // Queue of (degree, vertex), where entries whose degree has since changed
+  // are skipped
+  using Entry = std::pair<std::size_t, std::size_t>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::sort(adjacent[i].begin(), adjacent[i].end());
+    adjacent[i].erase(std::unique(adjacent[i].begin(), adjacent[i].end()),
+                      adjacent[i].end());
+    queue.push({adjacent[i].size(), i});
+  }
+
+  std::vector<std::size_t> order;
+  order.reserve(n);
+  std::vector<bool> eliminated(n, false);
+  std::vector<std::size_t> merged;
+  while (order.size() < n) {
+    const auto [degree, v] = queue.top();
+    queue.pop();
+    if (eliminated[v] || degree != adjacent[v].size()) continue;
+    eliminated[v] = true;
+    order.push_back(v);
+
+    for (std::size_t u : adjacent[v]) {
+      merged.clear();
+      std::set_union(adjacent[u].begin(), adjacent[u].end(),
+                     adjacent[v].begin(), adjacent[v].end(),
+                     std::back_inserter(merged));
+      std::erase_if(merged, [u, v](std::size_t w) { return w == u || w == v; });
+      adjacent[u].swap(merged);
+      queue.push({adjacent[u].size(), u});
+    }
+    std::vector<std::size_t>().swap(adjacent[v]);
+  }
+  return order;
+}
+
+}  // namespace
+
+void SparseLUAnalyse(const SparsityPattern& pattern,
+                     SparseLUFactors& factors) {
+  ValidatePattern(pattern);
+  const std::size_t n = pattern.n;
+
+  factors.n = n;
+  factors.perm = MinimumDegreeOrder(pattern);
+  std::vector<std::size_t> inverse(n);
+  for (std::size_t i = 0; i < n; ++i) inverse[factors.perm[i]] = i;
+  factors.row_ptr.assign(1, 0);
+  factors.col_idx.clear();
+  factors.diag.resize(n);
+
+  // Row i of the factors has the columns of row i of the permuted matrix,
+  // the diagonal, and the upper part of every earlier row k it eliminates
+  // with
+  std::vector<bool> mark(n, false);
+  std::vector<std::size_t> row;
+  std::priority_queue<std::size_t, std::vector<std::size_t>,
+                      std::greater<std::size_t>>
+      pending;
+  for (std::size_t i = 0; i < n; ++i) {
+    row.clear();
+    auto add = [&](std::size_t j) {
+      if (mark[j]) return;
+      mark[j] = true;
+      row.push_back(j);
+      if (j < i) pending.push(j);
+    };
+    const std::size_t r = factors.perm[i];
+    for (std::size_t p = pattern.row_ptr[r]; p < pattern.row_ptr[r + 1]; ++p) {
+      add(inverse[pattern.col_idx[p]]);
+    }
+    add(i);
+
+    // Visit eliminated columns in increasing order, adding their fill-in
+    while (!pending.empty()) {
+      const std::size_t k = pending.top();
+      pending.pop();
+      for (std::size_t p = factors.diag[k] + 1; p < factors.row_ptr[k + 1];
+           ++p) {
+        add(factors.col_idx[p]);
+      }
+    }
+
+    std::sort(row.begin(), row.end());
+    for (std::size_t j : row) {
+      if (j == i) factors.diag[i] = factors.col_idx.size();
+      factors.col_idx.push_back(j);
+      mark[j] = false;
+    }
+    factors.row_ptr.push_back(factors.col_idx.size());
+  }
+
+  // Map every entry of A to its position in the factors
+  factors.a_map.resize(pattern.NonZeros());
+  for (std::size_t r = 0; r < n; ++r) {
+    const std::size_t i = inverse[r];
+    const auto first = factors.col_idx.begin() + factors.row_ptr[i];
+    const auto last = factors.col_idx.begin() + factors.row_ptr[i + 1];
+    for (std::size_t p = pattern.row_ptr[r]; p < pattern.row_ptr[r + 1]; ++p) {
+      factors.a_map[p] = static_cast<std::size_t>(
+          std::lower_bound(first, last, inverse[pattern.col_idx[p]]) -
+          factors.col_idx.begin());
+    }
+  }
+
+  factors.values.assign(factors.col_idx.size(), 0.0);
+  factors.work.assign(n, 0.0);
+}
+
+void SparseLUFactorise(std::span<const double> values,
+                       SparseLUFactors& factors) {
+  const std::size_t n = factors.n;
+  const auto& row_ptr = factors.row_ptr;
+  const auto& col_idx = factors.col_idx;
+  auto& lu = factors.values;
+
+  // Scatter A into the factor structure, with zeros for the fill-in
+  std::fill(lu.begin(), lu.end(), 0.0);
+  for (std::size_t p = 0; p < factors.a_map.size(); ++p) {
+    lu[factors.a_map[p]] = values[p];
+  }
+
+  // Row-by-row elimination, using a dense work row indexed by column that
+  // is left zeroed after every row
+  auto& work = factors.work;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t p = row_ptr[i]; p < row_ptr[i + 1]; ++p) {
+      work[col_idx[p]] = lu[p];
+    }
+
+    for (std::size_t p = row_ptr[i]; p < factors.diag[i]; ++p) {
+      const std::size_t k = col_idx[p];
+      const double factor = work[k] / lu[factors.diag[k]];
+      work[k] = factor;
+      for (std::size_t q = factors.diag[k] + 1; q < row_ptr[k + 1]; ++q) {
+        work[col_idx[q]] -= factor * lu[q];
+      }
+    }
+
+    for (std::size_t p = row_ptr[i]; p < row_ptr[i + 1]; ++p) {
+      lu[p] = work[col_idx[p]];
+      work[col_idx[p]] = 0.0;
+    }
+    if (lu[factors.diag[i]] == 0.0) {
+      throw std::runtime_error("Zero pivot in sparse LU factorisation.");
+    }
+  }
+}
+
+void SparseLUSolve(const SparseLUFactors& factors, std::span<double> b) {
+  const std::size_t n = factors.n;
+  const auto& row_ptr = factors.row_ptr;
+  const auto& col_idx = factors.col_idx;
+  const auto& lu = factors.values;
+  const auto& perm = factors.perm;
+
+  // Permute b into the work row, which is zeroed again on the way out
+  auto& x = factors.work;
+  for (std::size_t i = 0; i < n; ++i) x[i] = b[perm[i]];
+
+  // Forward substitution with unit lower triangular L
+  for (std::size_t i = 0; i < n; ++i) {
+    double sum = x[i];
+    for (std::size_t p = row_ptr[i]; p < factors.diag[i]; ++p) {
+      sum -= lu[p] * x[col_idx[p]];
+    }
+    x[i] = sum;
+  }
+
+  // Back substitution with U
+  for (std::size_t i = n; i-- > 0;) {
+    double sum = x[i];
+    for (std::size_t p = factors.diag[i] + 1; p < row_ptr[i + 1]; ++p) {
+      sum -= lu[p] * x[col_idx[p]];
+    }
+    x[i] = sum / lu[factors.diag[i]];
+  }
+
+  for (std::size_t i = 0; i < n; ++i) {
+    b[perm[i]] = x[i];
+    x[i] = 0.0;
+  }
+}
+
+}  // namespace vanta::linear_solvers
@@ -0,0 +1,44 @@
+#include "linear_solvers/sparsity_pattern.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace vanta::linear_solvers {
+
+void ValidatePattern(const SparsityPattern& pattern) {
+  const std::size_t n = pattern.n;
+  if (pattern.row_ptr.size() != n + 1 || pattern.row_ptr[0] != 0 ||
+      pattern.row_ptr[n] != pattern.col_idx.size()) {
+    throw std::invalid_argument("Pattern row_ptr is inconsistent.");
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (pattern.row_ptr[i] > pattern.row_ptr[i + 1]) {
+      throw std::invalid_argument("Pattern row_ptr must be non-decreasing.");
+    }
+    for (std::size_t p = pattern.row_ptr[i]; p < pattern.row_ptr[i + 1]; ++p) {
+      if (pattern.col_idx[p] >= n ||
+          (p > pattern.row_ptr[i] &&
+           pattern.col_idx[p] <= pattern.col_idx[p - 1])) {
+        throw std::invalid_argument(
+            "Pattern columns must be sorted, unique and in range.");
+      }
+    }
+  }
+}
+
+SparsityPattern BandedPattern(std::size_t n, std::size_t lower,
+                              std::size_t upper) {
+  SparsityPattern pattern;
+  pattern.n = n;
+  pattern.row_ptr.reserve(n + 1);
+  pattern.row_ptr.push_back(0);
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::size_t first = i > lower ? i - lower : 0;
+    const std::size_t last = std::min(n - 1, i + upper);
+    for (std::size_t j = first; j <= last; ++j) pattern.col_idx.push_back(j);
+    pattern.row_ptr.push_back(pattern.col_idx.size());
+  }
+  return pattern;
+}
+
+}  // namespace vanta::linear_solvers
@@ -0,0 +1,451 @@
+#include "ode/adjoint.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include "linear_solvers/lu_decomposition.hpp"
+#include "ode/explicit_runge_kutta.hpp"
+#include "ode/phase_timer.hpp"
+
+namespace {
+
+using vanta::ode::AdjointSolution;
+using vanta::ode::InPlaceRhs;
+using vanta::ode::LossGradient;
+using vanta::ode::ParametricJacobian;
+using vanta::ode::ParametricRhs;
+using vanta::ode::PhaseTimer;
+using vanta::ode::Stats;
+
+// Jacobian updates allowed within one backward Euler step before giving up
+constexpr int kMaxJacobianUpdates = 4;
+
+// Euclidean norm of a vector
+double Norm(std::span<const double> v) {
+  double sum = 0.0;
+  for (double val : v) sum += val * val;
+  return std::sqrt(sum);
+}
+
+// Add scale * A^T v to out, for a row-major rows x cols matrix A
+void AddTransposeProduct(std::span<const double> a, std::size_t rows,
+                         std::size_t cols, std::span<const double> v,
+                         double scale, std::span<double> out) {
+  for (std::size_t i = 0; i < rows; ++i) {
+    const double v_i = scale * v[i];
+    if (v_i == 0.0) continue;
+    for (std::size_t k = 0; k < cols; ++k) out[k] += a[i * cols + k] * v_i;
+  }
+}
+
+void ValidateArguments(const ParametricJacobian& jacobian_y,
+                       const ParametricJacobian& jacobian_p,
+                       const LossGradient& loss_gradient, double t0,
+                       double t1, double h) {
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (!jacobian_y || !jacobian_p) {
+    throw std::invalid_argument(
+        "Adjoint solvers require both analytic Jacobians.");
+  }
+  if (!loss_gradient) {
+    throw std::invalid_argument("A loss gradient is required.");
+  }
+}
+
+// Forward step and transposed step of the classical RK4 method
+class RungeKutta4Adjoint {
+ public:
+  static constexpr const auto& kTableau = vanta::ode::kRungeKutta4Tableau;
+  static constexpr std::size_t kStages = 4;
+
+  RungeKutta4Adjoint(const ParametricRhs& f,
+                     const ParametricJacobian& jacobian_y,
+                     const ParametricJacobian& jacobian_p,
+                     const std::vector<double>& p, std::size_t n,
+                     Stats& stats)
+      : jacobian_y_(jacobian_y),
+        jacobian_p_(jacobian_p),
+        p_(p),
+        n_(n),
+        stats_(stats),
+        rhs_([&f, &p, &stats](double t, std::span<const double> y,
+                              std::span<double> dydt) {
+          PhaseTimer timer(stats.time.rhs);
+          f(t, y, p, dydt);
+          stats.n_rhs_evals++;
+        }),
+        ws_(std::vector<double>(n)),
+        y_scratch_(n),
+        jac_y_(n * n),
+        jac_p_(n * p.size()),
+        kappa_(n) {
+    mu_.fill(std::vector<double>(n));
+  }
+
+  void Step(double t, const std::vector<double>& y, double h,
+            std::vector<double>& y_next) {
+    vanta::ode::ExplicitRungeKuttaStep<kTableau>(rhs_, t, y, h, y_next, ws_);
+  }
+
+  // Map lambda = dL/dy(t + h) to dL/dy(t) and add the step's contribution
+  // to grad_p. Must follow Step from the same state, whose stage slopes it
+  // reuses.
+  void Backward(double t, const std::vector<double>& y,
+                const std::vector<double>& y_next [[maybe_unused]], double h,
+                std::vector<double>& lambda, std::vector<double>& grad_p) {
+    // Stage adjoints in reverse: kappa_i = h (b_i lambda + sum_j a_ji mu_j)
+    // and mu_i = J_y(Y_i)^T kappa_i
+    for (std::size_t i = kStages; i-- > 0;) {
+      for (std::size_t r = 0; r < n_; ++r) {
+        double sum = kTableau.b[i] * lambda[r];
+        for (std::size_t j = i + 1; j < kStages; ++j) {
+          sum += kTableau.a[j][i] * mu_[j][r];
+        }
+        kappa_[r] = h * sum;
+      }
+
+      // Stage state Y_i = y + h sum_j a_ij k_j
+      for (std::size_t r = 0; r < n_; ++r) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < i; ++j) {
+          sum += kTableau.a[i][j] * ws_.k[j][r];
+        }
+        y_scratch_[r] = y[r] + h * sum;
+      }
+
+      const double t_stage = t + kTableau.c[i] * h;
+      {
+        PhaseTimer timer(stats_.time.jacobian);
+        jacobian_y_(t_stage, y_scratch_, p_, jac_y_);
+        jacobian_p_(t_stage, y_scratch_, p_, jac_p_);
+        stats_.n_jacobian_evals += 2;
+      }
+      std::fill(mu_[i].begin(), mu_[i].end(), 0.0);
+      AddTransposeProduct(jac_y_, n_, n_, kappa_, 1.0, mu_[i]);
+      AddTransposeProduct(jac_p_, n_, p_.size(), kappa_, 1.0, grad_p);
+    }
+
+    for (std::size_t i = 0; i < kStages; ++i) {
+      for (std::size_t r = 0; r < n_; ++r) lambda[r] += mu_[i][r];
+    }
+  }
+
+ private:
+  const ParametricJacobian& jacobian_y_;
+  const ParametricJacobian& jacobian_p_;
+  const std::vector<double>& p_;
+  std::size_t n_;
+  Stats& stats_;
+
+  InPlaceRhs rhs_;
+  vanta::ode::ExplicitRKWorkspace<std::vector<double>, kStages> ws_;
+  std::vector<double> y_scratch_;
+  std::vector<double> jac_y_, jac_p_;
+  std::vector<double> kappa_;
+  std::array<std::vector<double>, kStages> mu_;
+};
+
+// Forward step and transposed step of the backward Euler method
+class EulerBackwardAdjoint {
+ public:
+  EulerBackwardAdjoint(const ParametricRhs& f,
+                       const ParametricJacobian& jacobian_y,
+                       const ParametricJacobian& jacobian_p,
+                       const std::vector<double>& p, std::size_t n,
+                       double tol, int max_iters, Stats& stats)
+      : f_(f),
+        jacobian_y_(jacobian_y),
+        jacobian_p_(jacobian_p),
+        p_(p),
+        n_(n),
+        tol_(tol),
+        max_iters_(max_iters),
+        stats_(stats),
+        fx_(n),
+        res_(n),
+        jac_y_(n * n),
+        jac_p_(n * p.size()),
+        matrix_(n * n) {}
+
+  // Solve x - y - h f(t + h, x) = 0 by modified Newton iteration. The
+  // iteration only depends on its inputs, so recomputing a step from a
+  // checkpoint reproduces the forward pass.
+  void Step(double t, const std::vector<double>& y, double h,
+            std::vector<double>& x) {
+    const double t_next = t + h;
+    x = y;
+    Evaluate(t_next, x);
+
+    int jacobian_updates = 0;
+    for (;;) {
+      // Form and factorise I - h J at the current iterate
+      FactoriseIterationMatrix(t_next, x, h, /*transpose=*/false);
+      ++jacobian_updates;
+
+      bool converged = false;
+      double res_norm_prev = 0.0;
+      for (int iter = 0;; ++iter) {
+        for (std::size_t j = 0; j < n_; ++j) {
+          res_[j] = x[j] - y[j] - h * fx_[j];
+        }
+        const double res_norm = Norm(res_);
+        if (res_norm < tol_) {
+          converged = true;
+          break;
+        }
+        if ((iter > 0 && res_norm >= res_norm_prev) || iter == max_iters_) {
+          break;
+        }
+        res_norm_prev = res_norm;
+
+        for (double& val : res_) val = -val;
+        Solve(res_);
+        stats_.n_newton_iters++;
+        for (std::size_t j = 0; j < n_; ++j) x[j] += res_[j];
+        Evaluate(t_next, x);
+        if (Norm(res_) <= tol_ * (1.0 + Norm(x))) {
+          converged = true;
+          break;
+        }
+      }
+      if (converged) return;
+
+      // Retry with the Jacobian at the latest iterate
+      if (jacobian_updates >= kMaxJacobianUpdates) {
+        throw std::runtime_error(
+            "Newton iteration failed to converge in backward Euler step.");
+      }
+    }
+  }
+
+  // Solve (I - h J)^T lambda_n = lambda_{n+1}, with J at the step end, and
+  // add h J_p^T lambda_n to grad_p
+  void Backward(double t, const std::vector<double>& y [[maybe_unused]],
+                const std::vector<double>& y_next, double h,
+                std::vector<double>& lambda, std::vector<double>& grad_p) {
+    const double t_next = t + h;
+    FactoriseIterationMatrix(t_next, y_next, h, /*transpose=*/true);
+    Solve(lambda);
+
+    {
+      PhaseTimer timer(stats_.time.jacobian);
+      jacobian_p_(t_next, y_next, p_, jac_p_);
+      stats_.n_jacobian_evals++;
+    }
+    AddTransposeProduct(jac_p_, n_, p_.size(), lambda, h, grad_p);
+  }
+
+ private:
+  void Evaluate(double t, std::span<const double> x) {
+    PhaseTimer timer(stats_.time.rhs);
+    f_(t, x, p_, fx_);
+    stats_.n_rhs_evals++;
+  }
+
+  // Evaluate J at (t, y) and factorise I - h J, or its transpose
+  void FactoriseIterationMatrix(double t, std::span<const double> y,
+                                double h, bool transpose) {
+    {
+      PhaseTimer timer(stats_.time.jacobian);
+      jacobian_y_(t, y, p_, jac_y_);
+      stats_.n_jacobian_evals++;
+    }
+    PhaseTimer timer(stats_.time.linear_solve);
+    for (std::size_t i = 0; i < n_; ++i) {
+      for (std::size_t j = 0; j < n_; ++j) {
+        const double jac = transpose ? jac_y_[j * n_ + i] : jac_y_[i * n_ + j];
+        matrix_[i * n_ + j] = (i == j ? 1.0 : 0.0) - h * jac;
+      }
+    }
+    vanta::linear_solvers::LUFactorise(matrix_, n_, lu_);
+    stats_.n_factorisations++;
+  }
+
+  // Solve with the current factors in place
+  void Solve(std::span<double> b) {
+    PhaseTimer timer(stats_.time.linear_solve);
+    vanta::linear_solvers::LUSolve(lu_, b);
+  }
+
+  const ParametricRhs& f_;
+  const ParametricJacobian& jacobian_y_;
+  const ParametricJacobian& jacobian_p_;
+  const std::vector<double>& p_;
+  std::size_t n_;
+  double tol_;
+  int max_iters_;
+  Stats& stats_;
+
+  std::vector<double> fx_, res_;
+  std::vector<double> jac_y_, jac_p_;
+  std::vector<double> matrix_;
+  vanta::linear_solvers::LUFactors lu_;
+};
+
+// Number of steps that can be reversed from a range start held in one of
+// slots checkpoints when no step is advanced more than repeats times,
+// binom(slots + repeats, slots) (Griewank and Walther), saturating at cap
+std::size_t BinomialReach(std::size_t slots, std::size_t repeats,
+                          std::size_t cap) {
+  const std::size_t k = std::min(slots, repeats);
+  const std::size_t m = std::max(slots, repeats);
+  double reach = 1.0;
+  for (std::size_t i = 1; i <= k && reach < static_cast<double>(cap); ++i) {
+    reach = reach * static_cast<double>(m + i) / static_cast<double>(i);
+  }
+  return reach >= static_cast<double>(cap) ? cap
+                                           : static_cast<std::size_t>(reach);
+}
+
+// Steps from the start of a range of length steps to the next checkpoint,
+// with slots >= 2 checkpoints available including the range start and r
+// the fewest advances per step that suffice. First parts between
+// max(beta(slots, r - 2), steps - beta(slots - 1, r)) and
+// min(beta(slots, r - 1), steps - beta(slots - 1, r - 1)) steps give the
+// fewest forward steps overall; this takes the shortest.
+std::size_t BinomialSplit(std::size_t steps, std::size_t slots) {
+  std::size_t repeats = 1;
+  while (BinomialReach(slots, repeats, steps) < steps) ++repeats;
+  const std::size_t rest = BinomialReach(slots - 1, repeats, steps);
+  const std::size_t first =
+      repeats >= 2 ? BinomialReach(slots, repeats - 2, steps) : 0;
+  return std::max({std::size_t{1}, first, steps - rest});
+}
+
+// Binomial checkpointing over a fixed-step forward pass. The states the
+// backward pass needs are restored by stepping forward from the nearest
+// checkpoint, and checkpoints are placed so that no more than budget states
+// are held while keeping the number of such forward steps minimal.
+template <typename Stepper>
+AdjointSolution RunAdjoint(Stepper& stepper, const LossGradient& loss_gradient,
+                           double t0, double t1, const std::vector<double>& y0,
+                           std::size_t n_params, double h, std::size_t budget,
+                           Stats& stats) {
+  PhaseTimer total_timer(stats.time.total);
+  const auto steps =
+      static_cast<std::size_t>(std::ceil((t1 - t0) / h));
+  const std::size_t n_slots =
+      budget == 0
+          ? std::min(steps, 2 * static_cast<std::size_t>(std::ceil(
+                                    std::sqrt(static_cast<double>(steps)))))
+          : std::min(budget, steps);
+
+  AdjointSolution result;
+  result.grad_p.assign(n_params, 0.0);
+  std::vector<double> lambda(y0.size());
+
+  // Checkpoint slots used as a stack, with the initial state in the first
+  // one, and the state being advanced
+  std::vector<std::vector<double>> slots(n_slots,
+                                         std::vector<double>(y0.size()));
+  slots[0] = y0;
+  std::vector<double> y(y0.size());
+  std::vector<double> y_next(y0.size());
+  auto time = [t0, h](std::size_t k) {
+    return t0 + static_cast<double>(k) * h;
+  };
+
+  // Load the state at step first from slot, then advance it to step last
+  auto advance = [&](std::size_t slot, std::size_t first, std::size_t last) {
+    y = slots[slot];
+    for (std::size_t k = first; k < last; ++k) {
+      stepper.Step(time(k), y, h, y_next);
+      y.swap(y_next);
+      result.n_forward_steps++;
+    }
+  };
+
+  // Retake step k from the state in y and step the adjoint back over it.
+  // The last step is reversed first and starts the adjoint from the loss.
+  auto reverse_step = [&](std::size_t k) {
+    stepper.Step(time(k), y, h, y_next);
+    if (k + 1 == steps) {
+      loss_gradient(y_next, lambda);
+      result.y1 = y_next;
+    }
+    stepper.Backward(time(k), y, y_next, h, lambda, result.grad_p);
+  };
+
+  // Ranges [first, last) of steps left to reverse, starting from the state
+  // in slot and with the slots above it free. The most recent range is the
+  // latest in time.
+  struct Range {
+    std::size_t first, last, slot;
+  };
+  std::vector<Range> pending = {{0, steps, 0}};
+  while (!pending.empty()) {
+    Range range = pending.back();
+    pending.pop_back();
+
+    // Checkpoint forward until the range is a single step, leaving the
+    // parts behind each new checkpoint for later
+    while (range.last - range.first > 1 && range.slot + 1 < n_slots) {
+      const std::size_t mid =
+          range.first + BinomialSplit(range.last - range.first,
+                                      n_slots - range.slot);
+      advance(range.slot, range.first, mid);
+      slots[range.slot + 1] = y;
+      result.n_checkpoints = std::max(result.n_checkpoints, range.slot + 2);
+      pending.push_back({range.first, mid, range.slot});
+      range = {mid, range.last, range.slot + 1};
+    }
+
+    // Reverse what is left, restoring each step from the range start, which
+    // is only needed more than once with a single checkpoint
+    for (std::size_t k = range.last; k-- > range.first;) {
+      advance(range.slot, range.first, k);
+      reverse_step(k);
+    }
+  }
+
+  result.n_checkpoints = std::max<std::size_t>(result.n_checkpoints, 1);
+  result.grad_y0 = std::move(lambda);
+  stats.n_accepted = steps;
+  total_timer.Stop();
+  result.stats = stats;
+  return result;
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+AdjointSolution AdjointRungeKutta4(const ParametricRhs& f,
+                                   const ParametricJacobian& jacobian_y,
+                                   const ParametricJacobian& jacobian_p,
+                                   const LossGradient& loss_gradient,
+                                   double t0, double t1,
+                                   const std::vector<double>& y0,
+                                   const std::vector<double>& p, double h,
+                                   const AdjointOptions& opts) {
+  ValidateArguments(jacobian_y, jacobian_p, loss_gradient, t0, t1, h);
+  Stats stats;
+  RungeKutta4Adjoint stepper(f, jacobian_y, jacobian_p, p, y0.size(), stats);
+  return RunAdjoint(stepper, loss_gradient, t0, t1, y0, p.size(), h,
+                    opts.checkpoints, stats);
+}
+
+AdjointSolution AdjointEulerBackward(const ParametricRhs& f,
+                                     const ParametricJacobian& jacobian_y,
+                                     const ParametricJacobian& jacobian_p,
+                                     const LossGradient& loss_gradient,
+                                     double t0, double t1,
+                                     const std::vector<double>& y0,
+                                     const std::vector<double>& p, double h,
+                                     const AdjointOptions& opts) {
+  ValidateArguments(jacobian_y, jacobian_p, loss_gradient, t0, t1, h);
+  Stats stats;
+  EulerBackwardAdjoint stepper(f, jacobian_y, jacobian_p, p, y0.size(),
+                               opts.tol, opts.max_iters, stats);
+  return RunAdjoint(stepper, loss_gradient, t0, t1, y0, p.size(), h,
+                    opts.checkpoints, stats);
+}
+
+}  // namespace vanta::ode
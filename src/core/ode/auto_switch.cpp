@@ -0,0 +1,152 @@
+#include "ode/auto_switch.hpp"
+
+#include <span>
+#include <stdexcept>
+
+#include "ode/bdf.hpp"
+#include "ode/dormand_prince_45.hpp"
+#include "ode/phase_timer.hpp"
+
+namespace {
+
+// Add the work counters of one segment to the running total
+void Accumulate(const vanta::ode::Stats& part, vanta::ode::Stats& total) {
+  total.n_rhs_evals += part.n_rhs_evals;
+  total.n_accepted += part.n_accepted;
+  total.n_rejected += part.n_rejected;
+  total.n_jacobian_evals += part.n_jacobian_evals;
+  total.n_factorisations += part.n_factorisations;
+  total.n_newton_iters += part.n_newton_iters;
+  total.time.rhs += part.time.rhs;
+  total.time.jacobian += part.time.jacobian;
+  total.time.linear_solve += part.time.linear_solve;
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+SwitchingSolution AutoSwitch(const Rhs& f, const double& t0, const double& t1,
+                             const std::vector<double>& y0,
+                             const SwitchingOptions& opts,
+                             const OutputOptions& out) {
+  return AutoSwitch(ToInPlaceRhs(f), t0, t1, y0, opts, out);
+}
+
+SwitchingSolution AutoSwitch(const InPlaceRhs& f, const double& t0,
+                             const double& t1, const std::vector<double>& y0,
+                             const SwitchingOptions& opts,
+                             const OutputOptions& out) {
+  // Validate input arguments; the segment solvers check the rest
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (opts.nonstiff_threshold <= 0.0 ||
+      opts.nonstiff_threshold >= opts.stiff_threshold) {
+    throw std::invalid_argument(
+        "Thresholds must satisfy 0 < nonstiff_threshold < stiff_threshold.");
+  }
+  if (opts.switch_steps < 1 || opts.monitor_interval < 1) {
+    throw std::invalid_argument(
+        "Switch steps and monitor interval must be positive.");
+  }
+
+  Stats stats;
+  PhaseTimer total_timer(stats.time.total);
+
+  // All segments feed one recorder, so output options apply across switches
+  const std::size_t n = y0.size();
+  OutputRecorder recorder(out, n, 0, f);
+  recorder.Start(t0, y0);
+
+  // Last accepted step, handed on to the next segment
+  double t = t0;
+  std::vector<double> y = y0;
+  double h = 0.0;
+
+  bool stiff = false;
+  bool terminated = false;
+  bool segment_start = true;
+  int n_signals = 0;
+
+  // Segments stream their steps here instead of storing them, skipping the
+  // initial sample that was the previous segment's last step
+  OutputOptions segment_out;
+  segment_out.store = false;
+  segment_out.observer = [&](double t_i, std::span<const double> y_i) {
+    if (segment_start) {
+      segment_start = false;
+      return;
+    }
+    t = t_i;
+    y.assign(y_i.begin(), y_i.end());
+    terminated = recorder.Step(t_i, y_i);
+  };
+
+  // End the segment after switch_steps consecutive steps on the other side
+  // of the current method's threshold, or at a terminal event
+  StiffnessMonitor monitor = [&](double t_i [[maybe_unused]], double h_i,
+                                 double h_lambda) {
+    h = h_i;
+    if (terminated) return true;
+    const bool signal = stiff ? h_lambda < opts.nonstiff_threshold
+                              : h_lambda > opts.stiff_threshold;
+    n_signals = signal ? n_signals + 1 : 0;
+    return n_signals >= opts.switch_steps;
+  };
+
+  SwitchingSolution result;
+  for (;;) {
+    const int attempts = static_cast<int>(stats.n_accepted + stats.n_rejected);
+    if (attempts >= opts.max_steps) {
+      throw std::runtime_error("Maximum number of steps exceeded.");
+    }
+
+    // The observer overwrites t and y, so each segment starts from copies
+    const double t_start = t;
+    const std::vector<double> y_start = y;
+    segment_start = true;
+    n_signals = 0;
+
+    Solution part;
+    if (stiff) {
+      BDFOptions bdf;
+      bdf.rtol = opts.rtol;
+      bdf.atol = opts.atol;
+      bdf.h0 = h;
+      bdf.h_max = opts.h_max;
+      bdf.max_steps = opts.max_steps - attempts;
+      bdf.max_order = opts.max_order;
+      bdf.jacobian = opts.jacobian;
+      bdf.sparsity = opts.sparsity;
+      bdf.batch_rhs = opts.batch_rhs;
+      bdf.monitor = monitor;
+      bdf.monitor_interval = opts.monitor_interval;
+      part = BDF(f, t_start, t1, y_start, bdf, segment_out);
+    } else {
+      DP45Options dp45;
+      dp45.rtol = opts.rtol;
+      dp45.atol = opts.atol;
+      dp45.h0 = h;
+      dp45.h_max = opts.h_max;
+      dp45.max_steps = opts.max_steps - attempts;
+      dp45.monitor = monitor;
+      part = DormandPrince45(f, t_start, t1, y_start, dp45, segment_out);
+    }
+    Accumulate(part.stats, stats);
+    if (terminated || t >= t1) break;
+
+    // The monitor ended the segment, so change method
+    stiff = !stiff;
+    result.switches.push_back({t, stiff});
+  }
+
+  // Return the combined solution with work counters
+  result.solution = recorder.Finish();
+  stats.n_rhs_evals += recorder.NumRhsEvals();
+  total_timer.Stop();
+  result.solution.stats = stats;
+  return result;
+}
+
+}  // namespace vanta::ode
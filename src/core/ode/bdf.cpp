@@ -0,0 +1,410 @@
+#include "ode/bdf.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "ode/iteration_matrix.hpp"
+#include "ode/phase_timer.hpp"
+
+namespace {
+
+// Highest supported order
+constexpr int kMaxOrder = 5;
+
+// Simplified Newton iterations allowed per attempt
+constexpr int kNewtonMaxIter = 4;
+
+// Bounds on the step size change factor
+constexpr double kMinFactor = 0.2;
+constexpr double kMaxFactor = 10.0;
+
+// gamma_k = sum_{j=1}^{k} 1/j, which is also the leading coefficient alpha_k
+constexpr std::array<double, kMaxOrder + 2> kGamma = {
+    0.0,
+    1.0,
+    1.0 + 1.0 / 2.0,
+    1.0 + 1.0 / 2.0 + 1.0 / 3.0,
+    1.0 + 1.0 / 2.0 + 1.0 / 3.0 + 1.0 / 4.0,
+    1.0 + 1.0 / 2.0 + 1.0 / 3.0 + 1.0 / 4.0 + 1.0 / 5.0,
+    1.0 + 1.0 / 2.0 + 1.0 / 3.0 + 1.0 / 4.0 + 1.0 / 5.0 + 1.0 / 6.0};
+
+// Error constant of the order k formula
+double ErrorConst(int k) { return 1.0 / (k + 1); }
+
+// Square matrix large enough for the difference rescaling at any order
+using SmallMatrix = std::array<double, (kMaxOrder + 1) * (kMaxOrder + 1)>;
+
+// Scaled root-mean-square norm, with scale atol + rtol * |y|
+double RmsNorm(const std::vector<double>& v, const std::vector<double>& y,
+               double atol, double rtol) {
+  if (v.empty()) return 0.0;
+  double sum = 0.0;
+  for (size_t i = 0; i < v.size(); ++i) {
+    const double sc = atol + rtol * std::abs(y[i]);
+    sum += (v[i] / sc) * (v[i] / sc);
+  }
+  return std::sqrt(sum / static_cast<double>(v.size()));
+}
+
+// Matrix R with R * D rescaling the differences D for a step size factor
+void ComputeR(int order, double factor, SmallMatrix& r) {
+  const int m = order + 1;
+  for (int j = 0; j < m; ++j) r[j] = 1.0;
+  for (int i = 1; i < m; ++i) {
+    r[i * m] = 0.0;
+    for (int j = 1; j < m; ++j) {
+      r[i * m + j] = r[(i - 1) * m + j] * (i - 1 - factor * j) / i;
+    }
+  }
+}
+
+// Rescale the first order + 1 rows of the difference table for a step size
+// multiplied by factor
+void ChangeD(std::vector<double>& d, std::size_t n, int order, double factor,
+             std::vector<double>& work) {
+  const int m = order + 1;
+  SmallMatrix r{};
+  SmallMatrix u{};
+  SmallMatrix ru{};
+  ComputeR(order, factor, r);
+  ComputeR(order, 1.0, u);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < m; ++j) {
+      double sum = 0.0;
+      for (int k = 0; k < m; ++k) sum += r[i * m + k] * u[k * m + j];
+      ru[i * m + j] = sum;
+    }
+  }
+
+  // D[:m] = RU^T * D[:m]
+  std::fill(work.begin(), work.begin() + m * n, 0.0);
+  for (int i = 0; i < m; ++i) {
+    for (int k = 0; k < m; ++k) {
+      const double c = ru[k * m + i];
+      for (std::size_t j = 0; j < n; ++j) work[i * n + j] += c * d[k * n + j];
+    }
+  }
+  std::copy(work.begin(), work.begin() + m * n, d.begin());
+}
+
+// Initial step size heuristic from Hairer, Nørsett and Wanner for a
+// first-order method
+double InitialStep(const vanta::ode::InPlaceRhs& f, double t0,
+                   const std::vector<double>& y0,
+                   const std::vector<double>& f0, double h_max, double atol,
+                   double rtol, std::vector<double>& y1,
+                   std::vector<double>& f1) {
+  const double d0 = RmsNorm(y0, y0, atol, rtol);
+  const double d1 = RmsNorm(f0, y0, atol, rtol);
+  double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+  h0 = std::min(h0, h_max);
+
+  // Explicit Euler step to estimate the second derivative
+  for (size_t i = 0; i < y0.size(); ++i) y1[i] = y0[i] + h0 * f0[i];
+  f(t0 + h0, y1, f1);
+  for (size_t i = 0; i < y0.size(); ++i) y1[i] = f1[i] - f0[i];
+  const double d2 = RmsNorm(y1, y0, atol, rtol) / h0;
+
+  const double d_max = std::max(d1, d2);
+  const double h1 = d_max <= 1e-15 ? std::max(1e-6, h0 * 1e-3)
+                                   : std::pow(0.01 / d_max, 1.0 / 2.0);
+  return std::min({100.0 * h0, h1, h_max});
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+Solution BDF(const Rhs& f, const double& t0, const double& t1,
+             const std::vector<double>& y0, const BDFOptions& opts,
+             const OutputOptions& out) {
+  return BDF(ToInPlaceRhs(f), t0, t1, y0, opts, out);
+}
+
+Solution BDF(const InPlaceRhs& f, const double& t0, const double& t1,
+             const std::vector<double>& y0, const BDFOptions& opts,
+             const OutputOptions& out) {
+  // Validate input arguments
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (opts.rtol <= 0.0 || opts.atol <= 0.0) {
+    throw std::invalid_argument("Tolerances rtol and atol must be positive.");
+  }
+  if (opts.h0 < 0.0 || opts.h_max <= 0.0) {
+    throw std::invalid_argument("Step sizes h0 and h_max must be positive.");
+  }
+  if (opts.max_order < 1 || opts.max_order > kMaxOrder) {
+    throw std::invalid_argument("Maximum order must be between 1 and 5.");
+  }
+  if (opts.monitor && opts.monitor_interval < 1) {
+    throw std::invalid_argument("Monitor interval must be positive.");
+  }
+
+  // Work counters, with the stepper's right-hand side calls timed
+  Stats stats;
+  PhaseTimer total_timer(stats.time.total);
+  auto rhs = TimedCalls(f, stats.time.rhs);
+
+  const std::size_t n = y0.size();
+  const double atol = opts.atol;
+  const double rtol = opts.rtol;
+  const double newton_tol =
+      std::max(10.0 * std::numeric_limits<double>::epsilon() / rtol,
+               std::min(0.03, std::sqrt(rtol)));
+
+  // Initialise output recording
+  OutputRecorder recorder(out, n, 0, f);
+  recorder.Start(t0, y0);
+
+  // State, Newton and difference table storage, allocated once. Row k of
+  // the table holds the k-th backward difference of the solution, scaled to
+  // the current step size
+  std::vector<double> y = y0;
+  std::vector<double> y_new(n), y_predict(n), fy(n), psi(n), d(n), dy(n);
+  std::vector<double> err(n);
+  std::vector<double> diffs((kMaxOrder + 3) * n, 0.0);
+  std::vector<double> work((kMaxOrder + 1) * n);
+  auto row = [&diffs, n](int k) { return diffs.data() + k * n; };
+
+  // Initial derivative and Jacobian
+  rhs(t0, y, fy);
+  stats.n_rhs_evals++;
+  IterationMatrix matrix(f, opts.jacobian, n, opts.sparsity, opts.batch_rhs);
+  matrix.UpdateJacobian(t0, y, fy);
+
+  // Spectral radius of the Jacobian for the stiffness monitor, refreshed
+  // with every Jacobian evaluation
+  double radius = opts.monitor ? matrix.SpectralRadius() : 0.0;
+  int jacobian_age = 0;
+
+  // Initial step size
+  double h = opts.h0;
+  if (h == 0.0) {
+    h = InitialStep(f, t0, y, fy, opts.h_max, atol, rtol, y_new, dy);
+    stats.n_rhs_evals++;
+  }
+  h = std::min(h, opts.h_max);
+
+  // Difference table starts as a first-order method
+  std::copy(y.begin(), y.end(), row(0));
+  for (std::size_t j = 0; j < n; ++j) row(1)[j] = h * fy[j];
+  int order = 1;
+  int n_equal_steps = 0;
+
+  double t = t0;
+  int attempts = 0;
+  while (t < t1) {
+    // Keep the step size within bounds
+    const double min_step =
+        10.0 * (std::nextafter(t, std::numeric_limits<double>::infinity()) - t);
+    if (h > opts.h_max) {
+      ChangeD(diffs, n, order, opts.h_max / h, work);
+      h = opts.h_max;
+      n_equal_steps = 0;
+    } else if (h < min_step) {
+      ChangeD(diffs, n, order, min_step / h, work);
+      h = min_step;
+      n_equal_steps = 0;
+    }
+
+    bool jacobian_current = false;
+    int n_iter = 0;
+    double error_norm = 0.0;
+    double t_new = t;
+    for (bool accepted = false; !accepted;) {
+      if (++attempts > opts.max_steps) {
+        throw std::runtime_error("Maximum number of steps exceeded.");
+      }
+      if (h < min_step) {
+        throw std::runtime_error("Step size underflow.");
+      }
+
+      // Land exactly on the final time
+      t_new = t + h;
+      if (t_new > t1) {
+        t_new = t1;
+        ChangeD(diffs, n, order, (t_new - t) / h, work);
+        n_equal_steps = 0;
+      }
+      h = t_new - t;
+
+      // Predict from the history and form the correction offset psi
+      const double alpha = kGamma[order];
+      for (std::size_t j = 0; j < n; ++j) {
+        double sum = 0.0;
+        double p = 0.0;
+        for (int k = 0; k <= order; ++k) sum += row(k)[j];
+        for (int k = 1; k <= order; ++k) p += row(k)[j] * kGamma[k];
+        y_predict[j] = sum;
+        psi[j] = p / alpha;
+      }
+      const double c = h / alpha;
+
+      // Simplified Newton iteration on (I - c J) dy = c f - psi - d
+      bool converged = false;
+      for (;;) {
+        matrix.Factorise(c);
+        y_new = y_predict;
+        std::fill(d.begin(), d.end(), 0.0);
+        double dy_norm_old = 0.0;
+        converged = false;
+        for (n_iter = 1; n_iter <= kNewtonMaxIter; ++n_iter) {
+          rhs(t_new, y_new, fy);
+          stats.n_rhs_evals++;
+          if (!std::all_of(fy.begin(), fy.end(),
+                           [](double v) { return std::isfinite(v); })) {
+            break;
+          }
+          for (std::size_t j = 0; j < n; ++j) {
+            dy[j] = c * fy[j] - psi[j] - d[j];
+          }
+          matrix.Solve(dy);
+          stats.n_newton_iters++;
+          const double dy_norm = RmsNorm(dy, y_predict, atol, rtol);
+          const double rate = n_iter > 1 ? dy_norm / dy_norm_old : 0.0;
+          if (n_iter > 1 &&
+              (rate >= 1.0 || std::pow(rate, kNewtonMaxIter - n_iter + 1) /
+                                      (1.0 - rate) * dy_norm >
+                                  newton_tol)) {
+            break;
+          }
+          for (std::size_t j = 0; j < n; ++j) {
+            y_new[j] += dy[j];
+            d[j] += dy[j];
+          }
+          if (dy_norm == 0.0 ||
+              (n_iter > 1 && rate / (1.0 - rate) * dy_norm < newton_tol)) {
+            converged = true;
+            break;
+          }
+          dy_norm_old = dy_norm;
+        }
+        n_iter = std::min(n_iter, kNewtonMaxIter);
+
+        if (converged || jacobian_current) break;
+
+        // Retry with a Jacobian evaluated at the predicted state
+        rhs(t_new, y_predict, fy);
+        stats.n_rhs_evals++;
+        matrix.UpdateJacobian(t_new, y_predict, fy);
+        jacobian_current = true;
+        if (opts.monitor) {
+          radius = matrix.SpectralRadius();
+          jacobian_age = 0;
+        }
+      }
+
+      if (!converged) {
+        // Halve the step if the Newton iteration failed
+        ChangeD(diffs, n, order, 0.5, work);
+        h *= 0.5;
+        n_equal_steps = 0;
+        stats.n_rejected++;
+        continue;
+      }
+
+      // Local error estimate from the correction
+      const double safety = 0.9 * (2 * kNewtonMaxIter + 1) /
+                            (2 * kNewtonMaxIter + n_iter);
+      for (std::size_t j = 0; j < n; ++j) err[j] = ErrorConst(order) * d[j];
+      error_norm = RmsNorm(err, y_new, atol, rtol);
+      if (error_norm > 1.0) {
+        const double factor =
+            std::max(kMinFactor,
+                     safety * std::pow(error_norm, -1.0 / (order + 1)));
+        ChangeD(diffs, n, order, factor, work);
+        h *= factor;
+        n_equal_steps = 0;
+        stats.n_rejected++;
+      } else {
+        accepted = true;
+      }
+    }
+
+    // Accept the step
+    t = t_new;
+    y.swap(y_new);
+    stats.n_accepted++;
+    if (recorder.Step(t, y)) break;
+    if (opts.monitor) {
+      if (++jacobian_age >= opts.monitor_interval) {
+        rhs(t, y, fy);
+        stats.n_rhs_evals++;
+        matrix.UpdateJacobian(t, y, fy);
+        radius = matrix.SpectralRadius();
+        jacobian_age = 0;
+      }
+      if (opts.monitor(t, h, h * radius)) break;
+    }
+    n_equal_steps++;
+
+    // Update the difference table with the correction
+    for (std::size_t j = 0; j < n; ++j) {
+      row(order + 2)[j] = d[j] - row(order + 1)[j];
+      row(order + 1)[j] = d[j];
+    }
+    for (int k = order; k >= 0; --k) {
+      for (std::size_t j = 0; j < n; ++j) row(k)[j] += row(k + 1)[j];
+    }
+
+    // Consider an order change only after order + 1 equal steps
+    if (n_equal_steps < order + 1) continue;
+
+    // Errors of the neighbouring orders, from the difference table
+    double error_m_norm = std::numeric_limits<double>::infinity();
+    double error_p_norm = std::numeric_limits<double>::infinity();
+    if (order > 1) {
+      for (std::size_t j = 0; j < n; ++j) {
+        err[j] = ErrorConst(order - 1) * row(order)[j];
+      }
+      error_m_norm = RmsNorm(err, y, atol, rtol);
+    }
+    if (order < opts.max_order) {
+      for (std::size_t j = 0; j < n; ++j) {
+        err[j] = ErrorConst(order + 1) * row(order + 2)[j];
+      }
+      error_p_norm = RmsNorm(err, y, atol, rtol);
+    }
+
+    // Choose the order that allows the largest next step
+    const std::array<double, 3> error_norms = {error_m_norm, error_norm,
+                                               error_p_norm};
+    double best_factor = 0.0;
+    int delta_order = 0;
+    for (int i = 0; i < 3; ++i) {
+      const double factor =
+          error_norms[i] == 0.0
+              ? std::numeric_limits<double>::infinity()
+              : std::pow(error_norms[i], -1.0 / (order + i));
+      if (factor > best_factor) {
+        best_factor = factor;
+        delta_order = i - 1;
+      }
+    }
+    order += delta_order;
+
+    const double safety = 0.9 * (2 * kNewtonMaxIter + 1) /
+                          (2 * kNewtonMaxIter + n_iter);
+    const double factor = std::min(kMaxFactor, safety * best_factor);
+    ChangeD(diffs, n, order, factor, work);
+    h *= factor;
+    n_equal_steps = 0;
+  }
+
+  // Return the computed solution with work counters
+  Solution sol = recorder.Finish();
+  stats.n_rhs_evals += matrix.NumRhsEvals() + recorder.NumRhsEvals();
+  stats.n_jacobian_evals = matrix.NumJacobianEvals();
+  stats.n_factorisations = matrix.NumFactorisations();
+  stats.time.jacobian = matrix.JacobianTime();
+  stats.time.linear_solve = matrix.LinearSolveTime();
+  total_timer.Stop();
+  sol.stats = stats;
+  return sol;
+}
+
+}  // namespace vanta::ode
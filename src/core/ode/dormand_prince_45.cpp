@@ -0,0 +1,259 @@
+#include "ode/dormand_prince_45.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "ode/phase_timer.hpp"
+
+namespace {
+
+// Dormand–Prince 5(4) Butcher tableau
+constexpr double kC2 = 1.0 / 5.0;
+constexpr double kC3 = 3.0 / 10.0;
+constexpr double kC4 = 4.0 / 5.0;
+constexpr double kC5 = 8.0 / 9.0;
+
+constexpr double kA21 = 1.0 / 5.0;
+constexpr double kA31 = 3.0 / 40.0;
+constexpr double kA32 = 9.0 / 40.0;
+constexpr double kA41 = 44.0 / 45.0;
+constexpr double kA42 = -56.0 / 15.0;
+constexpr double kA43 = 32.0 / 9.0;
+constexpr double kA51 = 19372.0 / 6561.0;
+constexpr double kA52 = -25360.0 / 2187.0;
+constexpr double kA53 = 64448.0 / 6561.0;
+constexpr double kA54 = -212.0 / 729.0;
+constexpr double kA61 = 9017.0 / 3168.0;
+constexpr double kA62 = -355.0 / 33.0;
+constexpr double kA63 = 46732.0 / 5247.0;
+constexpr double kA64 = 49.0 / 176.0;
+constexpr double kA65 = -5103.0 / 18656.0;
+
+// Fifth-order weights (also the last stage row, giving FSAL)
+constexpr double kB1 = 35.0 / 384.0;
+constexpr double kB3 = 500.0 / 1113.0;
+constexpr double kB4 = 125.0 / 192.0;
+constexpr double kB5 = -2187.0 / 6784.0;
+constexpr double kB6 = 11.0 / 84.0;
+
+// Difference between fifth- and fourth-order weights
+constexpr double kE1 = 71.0 / 57600.0;
+constexpr double kE3 = -71.0 / 16695.0;
+constexpr double kE4 = 71.0 / 1920.0;
+constexpr double kE5 = -17253.0 / 339200.0;
+constexpr double kE6 = 22.0 / 525.0;
+constexpr double kE7 = -1.0 / 40.0;
+
+// Method order used by the step size controller
+constexpr double kOrder = 5.0;
+
+// Scaled root-mean-square norm used for error control
+double RmsNorm(const std::vector<double>& v, const std::vector<double>& y_a,
+               const std::vector<double>& y_b, double atol, double rtol) {
+  if (v.empty()) return 0.0;
+  double sum = 0.0;
+  for (size_t i = 0; i < v.size(); ++i) {
+    const double sc =
+        atol + rtol * std::max(std::abs(y_a[i]), std::abs(y_b[i]));
+    sum += (v[i] / sc) * (v[i] / sc);
+  }
+  return std::sqrt(sum / static_cast<double>(v.size()));
+}
+
+// Initial step size heuristic from Hairer, Nørsett and Wanner
+double InitialStep(const vanta::ode::InPlaceRhs& f, double t0,
+                   const std::vector<double>& y0,
+                   const std::vector<double>& f0, double h_max, double atol,
+                   double rtol, std::vector<double>& y1,
+                   std::vector<double>& f1) {
+  const double d0 = RmsNorm(y0, y0, y0, atol, rtol);
+  const double d1 = RmsNorm(f0, y0, y0, atol, rtol);
+  double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+  h0 = std::min(h0, h_max);
+
+  // Explicit Euler step to estimate the second derivative
+  for (size_t i = 0; i < y0.size(); ++i) y1[i] = y0[i] + h0 * f0[i];
+  f(t0 + h0, y1, f1);
+  for (size_t i = 0; i < y0.size(); ++i) y1[i] = f1[i] - f0[i];
+  const double d2 = RmsNorm(y1, y0, y0, atol, rtol) / h0;
+
+  const double d_max = std::max(d1, d2);
+  const double h1 = d_max <= 1e-15 ? std::max(1e-6, h0 * 1e-3)
+                                   : std::pow(0.01 / d_max, 1.0 / kOrder);
+  return std::min({100.0 * h0, h1, h_max});
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+Solution DormandPrince45(const Rhs& f, const double& t0, const double& t1,
+                         const std::vector<double>& y0, DP45Options opts,
+                         const OutputOptions& out) {
+  return DormandPrince45(ToInPlaceRhs(f), t0, t1, y0, opts, out);
+}
+
+Solution DormandPrince45(const InPlaceRhs& f, const double& t0,
+                         const double& t1, const std::vector<double>& y0,
+                         DP45Options opts, const OutputOptions& out) {
+  // Validate input arguments
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (opts.rtol <= 0.0 || opts.atol <= 0.0) {
+    throw std::invalid_argument("Tolerances rtol and atol must be positive.");
+  }
+  if (opts.h0 < 0.0 || opts.h_max <= 0.0) {
+    throw std::invalid_argument("Step sizes h0 and h_max must be positive.");
+  }
+
+  const size_t n = y0.size();
+
+  // Work counters, with the stepper's right-hand side calls timed
+  Stats stats;
+  PhaseTimer total_timer(stats.time.total);
+  auto rhs = TimedCalls(f, stats.time.rhs);
+
+  // Stage and state storage, allocated once
+  std::vector<double> y = y0;
+  std::vector<double> y_new(n), y_stage(n), err(n);
+  std::vector<double> k1(n), k2(n), k3(n), k4(n), k5(n), k6(n), k7(n);
+
+  // First stage of the first step
+  rhs(t0, y, k1);
+  stats.n_rhs_evals++;
+
+  // Initialise output recording, handing it the known derivatives
+  OutputRecorder recorder(out, n, 0, f);
+  recorder.Start(t0, y0, k1);
+
+  // Initial step size
+  double h = opts.h0;
+  if (h == 0.0) {
+    h = InitialStep(f, t0, y, k1, opts.h_max, opts.atol, opts.rtol, y_new,
+                    k2);
+    stats.n_rhs_evals++;
+  }
+  h = std::min(h, opts.h_max);
+
+  // Controller state
+  const double expo = 1.0 / kOrder - 0.75 * opts.beta;
+  double err_old = 1e-4;
+  bool last_rejected = false;
+
+  double t = t0;
+  for (int step = 0; t < t1; ++step) {
+    if (step >= opts.max_steps) {
+      throw std::runtime_error("Maximum number of steps exceeded.");
+    }
+
+    // Land exactly on the final time
+    bool last = false;
+    if (t + h >= t1) {
+      h = t1 - t;
+      last = true;
+    }
+    if (h <= 10.0 * std::abs(t) * std::numeric_limits<double>::epsilon()) {
+      throw std::runtime_error("Step size underflow.");
+    }
+
+    // Stage 2
+    for (size_t i = 0; i < n; ++i) y_stage[i] = y[i] + h * kA21 * k1[i];
+    rhs(t + kC2 * h, y_stage, k2);
+
+    // Stage 3
+    for (size_t i = 0; i < n; ++i) {
+      y_stage[i] = y[i] + h * (kA31 * k1[i] + kA32 * k2[i]);
+    }
+    rhs(t + kC3 * h, y_stage, k3);
+
+    // Stage 4
+    for (size_t i = 0; i < n; ++i) {
+      y_stage[i] = y[i] + h * (kA41 * k1[i] + kA42 * k2[i] + kA43 * k3[i]);
+    }
+    rhs(t + kC4 * h, y_stage, k4);
+
+    // Stage 5
+    for (size_t i = 0; i < n; ++i) {
+      y_stage[i] = y[i] + h * (kA51 * k1[i] + kA52 * k2[i] + kA53 * k3[i] +
+                               kA54 * k4[i]);
+    }
+    rhs(t + kC5 * h, y_stage, k5);
+
+    // Stage 6
+    for (size_t i = 0; i < n; ++i) {
+      y_stage[i] = y[i] + h * (kA61 * k1[i] + kA62 * k2[i] + kA63 * k3[i] +
+                               kA64 * k4[i] + kA65 * k5[i]);
+    }
+    rhs(t + h, y_stage, k6);
+
+    // Fifth-order solution
+    for (size_t i = 0; i < n; ++i) {
+      y_new[i] = y[i] + h * (kB1 * k1[i] + kB3 * k3[i] + kB4 * k4[i] +
+                             kB5 * k5[i] + kB6 * k6[i]);
+    }
+
+    // Stage 7, evaluated at the new solution and reused as the next k1
+    rhs(t + h, y_new, k7);
+    stats.n_rhs_evals += 6;
+
+    // Local error estimate
+    for (size_t i = 0; i < n; ++i) {
+      err[i] = h * (kE1 * k1[i] + kE3 * k3[i] + kE4 * k4[i] + kE5 * k5[i] +
+                    kE6 * k6[i] + kE7 * k7[i]);
+    }
+    const double err_norm = RmsNorm(err, y, y_new, opts.atol, opts.rtol);
+
+    if (err_norm <= 1.0) {
+      // Stiffness estimate from the last two stages, which share a time
+      double h_lambda = 0.0;
+      if (opts.monitor) {
+        double dk = 0.0;
+        double dy_stage = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+          dk += (k7[i] - k6[i]) * (k7[i] - k6[i]);
+          dy_stage += (y_new[i] - y_stage[i]) * (y_new[i] - y_stage[i]);
+        }
+        if (dy_stage > 0.0) h_lambda = h * std::sqrt(dk / dy_stage);
+      }
+
+      // Accept the step
+      const double h_taken = h;
+      t = last ? t1 : t + h;
+      y.swap(y_new);
+      k1.swap(k7);
+      stats.n_accepted++;
+      if (recorder.Step(t, y, k1)) break;
+      if (opts.monitor && opts.monitor(t, h_taken, h_lambda)) break;
+
+      // Proportional-integral step size update
+      double factor = opts.max_factor;
+      if (err_norm > 0.0) {
+        factor = opts.safety * std::pow(err_norm, -expo) *
+                 std::pow(err_old, opts.beta);
+        factor = std::clamp(factor, opts.min_factor, opts.max_factor);
+      }
+      if (last_rejected) factor = std::min(factor, 1.0);
+      err_old = std::max(err_norm, 1e-4);
+      last_rejected = false;
+      h = std::min(h * factor, opts.h_max);
+    } else {
+      // Reject the step and retry with a smaller one
+      const double factor =
+          std::max(opts.min_factor,
+                   opts.safety * std::pow(err_norm, -1.0 / kOrder));
+      h *= factor;
+      last_rejected = true;
+      stats.n_rejected++;
+    }
+  }
+
+  // Return the computed solution
+  Solution sol = recorder.Finish();
+  total_timer.Stop();
+  sol.stats = stats;
+  return sol;
+}
+
+}  // namespace vanta::ode
@@ -0,0 +1,240 @@
+#include "ode/ensemble.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <stdexcept>
+
+#include "ode/phase_timer.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace {
+
+// Mean and sum of squared deviations of one block at every recorded time
+struct BlockMoments {
+  std::size_t count = 0;
+  std::vector<double> mean;
+  std::vector<double> m2;
+};
+
+}  // namespace
+
+namespace vanta::ode {
+
+template <typename T>
+BasicEnsembleSolution<T> IntegrateEnsemble(
+    const std::type_identity_t<EnsembleStepFactory<T>>& make_step,
+    const double& t0, const double& t1, const std::vector<T>& y0,
+    std::size_t n_states, const double& h, std::size_t rhs_calls_per_step,
+    EnsembleOptions opts) {
+  // Validate input arguments
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (n_states == 0 || y0.size() % n_states != 0) {
+    throw std::invalid_argument(
+        "y0 must hold a whole number of n_states sized states.");
+  }
+  if (opts.block_size == 0) {
+    throw std::invalid_argument("Block size must be positive.");
+  }
+
+  BasicEnsembleSolution<T> result;
+  PhaseTimer total_timer(result.stats.time.total);
+  const std::size_t n = n_states;
+  const std::size_t n_members = y0.size() / n;
+  const auto steps = static_cast<std::size_t>(std::ceil((t1 - t0) / h));
+
+  // Steps at which the ensemble is recorded, always including the last
+  std::vector<std::size_t> record_steps;
+  if (opts.stride > 0) {
+    for (std::size_t s = 0; s < steps; s += opts.stride) {
+      record_steps.push_back(s);
+    }
+  }
+  record_steps.push_back(steps);
+  const std::size_t n_records = record_steps.size();
+
+  // Recorded times, accumulated exactly as the integration loop does
+  result.t.resize(n_records);
+  {
+    double t = t0;
+    std::size_t rec = 0;
+    for (std::size_t s = 0; s <= steps; ++s, t += h) {
+      if (rec < n_records && record_steps[rec] == s) result.t[rec++] = t;
+    }
+  }
+
+  // Member trajectories are written directly by the block that owns them
+  if (opts.store_members) {
+    result.members.assign(n_members, BasicSolution<T>(n_records, n));
+    for (BasicSolution<T>& member : result.members) member.t = result.t;
+  }
+
+  // Integrate one block of members in structure-of-arrays layout
+  auto integrate_block = [&](std::size_t first, std::size_t count) {
+    std::vector<T> y(n * count);
+    EnsembleBlockStep<T> step = make_step(first, count);
+
+    BlockMoments moments;
+    moments.count = count;
+    moments.mean.resize(n_records * n);
+    moments.m2.resize(n_records * n);
+
+    // Transpose the initial states into the block
+    for (std::size_t m = 0; m < count; ++m) {
+      for (std::size_t j = 0; j < n; ++j) {
+        y[j * count + m] = y0[(first + m) * n + j];
+      }
+    }
+
+    // Store member states and block moments for one recorded time
+    auto record = [&](std::size_t rec) {
+      if (opts.store_members) {
+        for (std::size_t m = 0; m < count; ++m) {
+          std::span<T> row = result.members[first + m].Row(rec);
+          for (std::size_t j = 0; j < n; ++j) row[j] = y[j * count + m];
+        }
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        const T* yj = y.data() + j * count;
+        double sum = 0.0;
+        for (std::size_t m = 0; m < count; ++m) sum += yj[m];
+        const double mean = sum / static_cast<double>(count);
+        double m2 = 0.0;
+        for (std::size_t m = 0; m < count; ++m) {
+          m2 += (yj[m] - mean) * (yj[m] - mean);
+        }
+        moments.mean[rec * n + j] = mean;
+        moments.m2[rec * n + j] = m2;
+      }
+    };
+
+    std::size_t rec = 0;
+    if (record_steps[rec] == 0) record(rec++);
+
+    // Perform time stepping
+    double t = t0;
+    for (std::size_t s = 1; s <= steps; ++s) {
+      step(t, y);
+
+      // Advance time
+      t += h;
+      if (rec < n_records && record_steps[rec] == s) record(rec++);
+    }
+
+    return moments;
+  };
+
+  // Shard the ensemble into blocks and integrate them concurrently
+  std::vector<std::future<BlockMoments>> blocks;
+  {
+    vanta::utils::ThreadPool pool(opts.n_threads);
+    for (std::size_t first = 0; first < n_members; first += opts.block_size) {
+      const std::size_t count = std::min(opts.block_size, n_members - first);
+      blocks.push_back(pool.Submit(
+          [&integrate_block, first, count]() {
+            return integrate_block(first, count);
+          }));
+    }
+  }
+
+  // Merge block moments in a fixed order so results are reproducible
+  result.mean = BasicSolution<T>(n_records, n);
+  result.variance = BasicSolution<T>(n_records, n);
+  result.mean.t = result.t;
+  result.variance.t = result.t;
+  std::vector<double> mean(n_records * n, 0.0);
+  std::vector<double> m2(n_records * n, 0.0);
+  double total = 0.0;
+  for (auto& block : blocks) {
+    const BlockMoments moments = block.get();
+    const double count = static_cast<double>(moments.count);
+    for (std::size_t i = 0; i < n_records * n; ++i) {
+      const double delta = moments.mean[i] - mean[i];
+      mean[i] += delta * count / (total + count);
+      m2[i] += moments.m2[i] + delta * delta * total * count / (total + count);
+    }
+    total += count;
+  }
+  for (std::size_t i = 0; i < n_records * n; ++i) {
+    result.mean.y[i] = static_cast<T>(mean[i]);
+    result.variance.y[i] = static_cast<T>(total > 0.0 ? m2[i] / total : 0.0);
+  }
+
+  result.stats.n_rhs_evals = rhs_calls_per_step * steps * blocks.size();
+  result.stats.n_accepted = steps;
+  total_timer.Stop();
+
+  return result;
+}
+
+template <typename T>
+BasicEnsembleSolution<T> EnsembleRungeKutta4(
+    const std::type_identity_t<BasicBatchRhs<T>>& f, const double& t0,
+    const double& t1, const std::vector<T>& y0, std::size_t n_states,
+    const double& h, EnsembleOptions opts) {
+  // Stage coefficients in the state's precision, so float blocks update
+  // twice as many members per vector instruction
+  const T h_t = static_cast<T>(h);
+  const T half_h = static_cast<T>(0.5 * h);
+  const T sixth_h = static_cast<T>(h / 6.0);
+  const T two = 2;
+
+  // Each stage is one batched call and a contiguous loop over the block
+  auto make_step = [&](std::size_t first, std::size_t count) {
+    const std::size_t size = n_states * count;
+    return EnsembleBlockStep<T>(
+        [&f, h, h_t, half_h, sixth_h, two, first, count, size,
+         y_stage = std::vector<T>(size), k1 = std::vector<T>(size),
+         k2 = std::vector<T>(size), k3 = std::vector<T>(size),
+         k4 = std::vector<T>(size)](double t, std::vector<T>& y) mutable {
+          f(t, y, k1, first, count);
+          for (std::size_t i = 0; i < size; ++i) {
+            y_stage[i] = y[i] + half_h * k1[i];
+          }
+          f(t + 0.5 * h, y_stage, k2, first, count);
+          for (std::size_t i = 0; i < size; ++i) {
+            y_stage[i] = y[i] + half_h * k2[i];
+          }
+          f(t + 0.5 * h, y_stage, k3, first, count);
+          for (std::size_t i = 0; i < size; ++i) {
+            y_stage[i] = y[i] + h_t * k3[i];
+          }
+          f(t + h, y_stage, k4, first, count);
+          for (std::size_t i = 0; i < size; ++i) {
+            y[i] += sixth_h * (k1[i] + two * k2[i] + two * k3[i] + k4[i]);
+          }
+        });
+  };
+  return IntegrateEnsemble<T>(make_step, t0, t1, y0, n_states, h, 4, opts);
+}
+
+template BasicEnsembleSolution<float> IntegrateEnsemble<float>(
+    const EnsembleStepFactory<float>&, const double&, const double&,
+    const std::vector<float>&, std::size_t, const double&, std::size_t,
+    EnsembleOptions);
+template BasicEnsembleSolution<double> IntegrateEnsemble<double>(
+    const EnsembleStepFactory<double>&, const double&, const double&,
+    const std::vector<double>&, std::size_t, const double&, std::size_t,
+    EnsembleOptions);
+
+template BasicEnsembleSolution<float> EnsembleRungeKutta4<float>(
+    const BasicBatchRhs<float>&, const double&, const double&,
+    const std::vector<float>&, std::size_t, const double&, EnsembleOptions);
+template BasicEnsembleSolution<double> EnsembleRungeKutta4<double>(
+    const BasicBatchRhs<double>&, const double&, const double&,
+    const std::vector<double>&, std::size_t, const double&, EnsembleOptions);
+
+EnsembleSolution EnsembleRungeKutta4(const BatchRhs& f, const double& t0,
+                                     const double& t1,
+                                     const std::vector<double>& y0,
+                                     std::size_t n_states, const double& h,
+                                     EnsembleOptions opts) {
+  return EnsembleRungeKutta4<double>(f, t0, t1, y0, n_states, h, opts);
+}
+
+}  // namespace vanta::ode
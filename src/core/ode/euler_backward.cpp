@@ -1,15 +1,22 @@
 #include "ode/euler_backward.hpp"
 
-#include <iostream>
+#include <cmath>
+#include <stdexcept>
 
-#include "root_finders/newton_raphson.hpp"
+#include "ode/phase_timer.hpp"
+#include "ode/stepper.hpp"
 
 namespace vanta::ode {
 
-Solution EulerBackward(const std::function<std::vector<double>(
-                           const double&, const std::vector<double>&)>& f,
-                       const double& t0, const double& t1,
-                       const std::vector<double>& y0, const double& h) {
+Solution EulerBackward(const Rhs& f, const double& t0, const double& t1,
+                       const std::vector<double>& y0, const double& h,
+                       const EBOptions& opts, const OutputOptions& out) {
+  return EulerBackward(ToInPlaceRhs(f), t0, t1, y0, h, opts, out);
+}
+
+Solution EulerBackward(const InPlaceRhs& f, const double& t0, const double& t1,
+                       const std::vector<double>& y0, const double& h,
+                       const EBOptions& opts, const OutputOptions& out) {
   // Validate input arguments
   if (h <= 0.0) {
     throw std::invalid_argument("Step size h must be positive.");
@@ -18,38 +25,33 @@ Solution EulerBackward(const std::function<std::vector<double>(
     throw std::invalid_argument("t1 must be greater than t0.");
   }
 
+  // Wall time of the whole solve; the stepper times its own phases
+  double total_time = 0.0;
+  PhaseTimer total_timer(total_time);
+
   // Compute the number of integration steps
   const auto steps = static_cast<int>(std::ceil((t1 - t0) / h));
+  const std::size_t n = y0.size();
 
-  // Initialise solution storage
-  std::vector<std::vector<double>> y(steps + 1);
-  y[0] = y0;
-
-  std::vector<double> t(steps + 1);
-  t[0] = t0;
+  // Initialise output recording
+  OutputRecorder recorder(out, n, steps, f);
+  recorder.Start(t0, y0);
 
-  // Perform time stepping
+  // Perform time stepping with the stateful integrator
+  EulerBackwardStepper stepper(f, t0, y0, h, opts);
   for (int i = 0; i < steps; ++i) {
-    // Advance time
-    t[i + 1] = t[i] + h;
-
-    // Define backward Euler residual: F(x) = y(i + 1) - y(i) - h * f(t(i + 1),
-    // y(i + 1))
-    auto F = [h, f, t1 = t[i + 1], y0 = y[i]](const std::vector<double>& x) {
-      std::vector<double> res(x.size());
-      std::vector<double> fx = f(t1, x);
-      for (size_t j = 0; j < x.size(); ++j) {
-        res[j] = x[j] - y0[j] - h * fx[j];
-      }
-      return res;
-    };
-
-    // Solve using Newton-Raphson
-    y[i + 1] = vanta::root_finders::NewtonRaphson(F, y[i]);
+    stepper.Step();
+    if (recorder.Step(stepper.Time(), stepper.State())) break;
   }
 
-  // Return the computed solution
-  return {t, y};
+  // Return the computed solution with work counters
+  Solution sol = recorder.Finish();
+  Stats stats = stepper.Statistics();
+  stats.n_rhs_evals += recorder.NumRhsEvals();
+  total_timer.Stop();
+  stats.time.total = total_time;
+  sol.stats = stats;
+  return sol;
 }
 
 }  // namespace vanta::ode
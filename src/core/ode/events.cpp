@@ -0,0 +1,103 @@
+#include "ode/events.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "ode/interpolation.hpp"
+#include "root_finders/brent.hpp"
+
+namespace vanta::ode {
+
+EventLocator::EventLocator(const std::vector<Event>& events,
+                           std::size_t n_states)
+    : events_(events) {
+  for (const Event& event : events_) {
+    if (!event.g) {
+      throw std::invalid_argument("Event function must be callable.");
+    }
+  }
+  if (!Active()) return;
+
+  y_prev_.resize(n_states);
+  f_prev_.resize(n_states);
+  g_prev_.resize(events_.size());
+  g_.resize(events_.size());
+  y_interp_.resize(n_states);
+  y_event_.resize(n_states);
+}
+
+void EventLocator::Start(double t0, std::span<const double> y0,
+                         std::span<const double> f0) {
+  t_prev_ = t0;
+  std::copy(y0.begin(), y0.end(), y_prev_.begin());
+  std::copy(f0.begin(), f0.end(), f_prev_.begin());
+  for (std::size_t k = 0; k < events_.size(); ++k) {
+    g_prev_[k] = events_[k].g(t0, y0);
+  }
+}
+
+bool EventLocator::Step(double t, std::span<const double> y,
+                        std::span<const double> f) {
+  t_ = t;
+  y_ = y;
+  f_ = f;
+
+  // Crossings in this step, as (time, event index)
+  std::vector<std::pair<double, std::size_t>> crossings;
+  for (std::size_t k = 0; k < events_.size(); ++k) {
+    g_[k] = events_[k].g(t, y);
+    const bool rising = g_prev_[k] < 0.0 && g_[k] >= 0.0;
+    const bool falling = g_prev_[k] > 0.0 && g_[k] <= 0.0;
+    const int direction = events_[k].direction;
+    if ((rising && direction >= 0) || (falling && direction <= 0)) {
+      crossings.emplace_back(g_[k] == 0.0 ? t : Locate(k), k);
+    }
+  }
+  std::sort(crossings.begin(), crossings.end());
+
+  // Record crossings up to the first terminal one
+  bool terminal = false;
+  for (const auto& [t_root, k] : crossings) {
+    EventRecord& record = records_.emplace_back();
+    record.index = k;
+    record.t = t_root;
+    if (t_root == t) {
+      record.y.assign(y.begin(), y.end());
+    } else {
+      record.y.resize(y.size());
+      HermiteInterpolate(t_prev_, y_prev_, f_prev_, t, y, f, t_root,
+                         record.y);
+    }
+
+    if (events_[k].terminal) {
+      t_event_ = t_root;
+      std::copy(record.y.begin(), record.y.end(), y_event_.begin());
+      terminal = true;
+      break;
+    }
+  }
+
+  // The end of this step is the start of the next
+  t_prev_ = t;
+  std::copy(y.begin(), y.end(), y_prev_.begin());
+  std::copy(f.begin(), f.end(), f_prev_.begin());
+  g_prev_.swap(g_);
+  return terminal;
+}
+
+double EventLocator::Locate(std::size_t k) {
+  auto g = [this, k](double t) {
+    HermiteInterpolate(t_prev_, y_prev_, f_prev_, t_, y_, f_, t, y_interp_);
+    return events_[k].g(t, y_interp_);
+  };
+
+  // Resolve the crossing to a few units in the last place of the time
+  const double xtol = 4.0 * std::numeric_limits<double>::epsilon() *
+                      std::max(std::abs(t_prev_), std::abs(t_));
+  return vanta::root_finders::Brent(g, t_prev_, t_, xtol);
+}
+
+}  // namespace vanta::ode
@@ -0,0 +1,366 @@
+#include "ode/exponential.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+
+#include "linear_solvers/lu_decomposition.hpp"
+#include "ode/phase_timer.hpp"
+
+namespace vanta::ode {
+
+namespace {
+
+// Highest phi function needed, by ETDRK4
+constexpr int kMaxPhi = 3;
+
+// Product c = a * b of row-major m x m matrices
+void MatMul(const std::vector<double>& a, const std::vector<double>& b,
+            std::size_t m, std::vector<double>& c) {
+  std::fill(c.begin(), c.end(), 0.0);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t k = 0; k < m; ++k) {
+      const double a_ik = a[i * m + k];
+      if (a_ik == 0.0) continue;
+      for (std::size_t j = 0; j < m; ++j) {
+        c[i * m + j] += a_ik * b[k * m + j];
+      }
+    }
+  }
+}
+
+// Exponential of a row-major m x m matrix by scaling and squaring: A is
+// scaled by 2^-s until its 1-norm is at most 1/2, where the diagonal [6/6]
+// Padé approximant is accurate to double precision, and the result is
+// squared s times
+std::vector<double> Expm(std::vector<double> a, std::size_t m) {
+  // Padé coefficients c_k = (12 - k)! 6! / (12! k! (6 - k)!)
+  constexpr std::array<double, 7> kPade = {
+      1.0,         1.0 / 2.0,     5.0 / 44.0,     1.0 / 66.0,
+      1.0 / 792.0, 1.0 / 15840.0, 1.0 / 665280.0};
+
+  double norm = 0.0;
+  for (std::size_t j = 0; j < m; ++j) {
+    double column = 0.0;
+    for (std::size_t i = 0; i < m; ++i) column += std::abs(a[i * m + j]);
+    norm = std::max(norm, column);
+  }
+  int squarings = 0;
+  if (norm > 0.5) {
+    squarings = static_cast<int>(std::ceil(std::log2(norm / 0.5)));
+    const double scale = std::ldexp(1.0, -squarings);
+    for (double& a_ij : a) a_ij *= scale;
+  }
+
+  // Even and odd parts of the numerator, p(A) = u + v, q(A) = u - v
+  std::vector<double> u(m * m, 0.0), v(m * m, 0.0);
+  std::vector<double> power(m * m, 0.0), next(m * m);
+  for (std::size_t i = 0; i < m; ++i) power[i * m + i] = 1.0;
+  for (std::size_t k = 0; k < kPade.size(); ++k) {
+    std::vector<double>& part = k % 2 == 0 ? u : v;
+    for (std::size_t i = 0; i < m * m; ++i) part[i] += kPade[k] * power[i];
+    if (k + 1 < kPade.size()) {
+      MatMul(power, a, m, next);
+      power.swap(next);
+    }
+  }
+
+  // Solve q(A) X = p(A) column by column
+  std::vector<double> q(m * m);
+  for (std::size_t i = 0; i < m * m; ++i) q[i] = u[i] - v[i];
+  linear_solvers::LUFactors lu;
+  linear_solvers::LUFactorise(q, m, lu);
+  std::vector<double> x(m * m), column(m);
+  for (std::size_t j = 0; j < m; ++j) {
+    for (std::size_t i = 0; i < m; ++i) {
+      column[i] = u[i * m + j] + v[i * m + j];
+    }
+    linear_solvers::LUSolve(lu, column);
+    for (std::size_t i = 0; i < m; ++i) x[i * m + j] = column[i];
+  }
+
+  for (int s = 0; s < squarings; ++s) {
+    MatMul(x, x, m, next);
+    x.swap(next);
+  }
+  return x;
+}
+
+// phi_0(z), ..., phi_p(z) of a scalar, by their Taylor series near zero,
+// where the recurrence cancels, and by the recurrence elsewhere
+std::array<double, kMaxPhi + 1> PhiScalars(double z) {
+  std::array<double, kMaxPhi + 1> phi{};
+  if (std::abs(z) < 1.0) {
+    // phi_k(z) = sum_j z^j / (j + k)!, truncated well below rounding
+    for (int k = 0; k <= kMaxPhi; ++k) {
+      double term = 1.0;
+      for (int i = 2; i <= k; ++i) term /= i;
+      double sum = 0.0;
+      for (int j = 0; j < 20; ++j) {
+        sum += term;
+        term *= z / (j + k + 1);
+      }
+      phi[k] = sum;
+    }
+  } else {
+    phi[0] = std::exp(z);
+    double factorial = 1.0;
+    for (int k = 0; k < kMaxPhi; ++k) {
+      phi[k + 1] = (phi[k] - 1.0 / factorial) / z;
+      factorial *= k + 1;
+    }
+  }
+  return phi;
+}
+
+// A function of h L stored as its diagonal when L is diagonal, and as a
+// row-major n x n matrix otherwise
+struct MatrixFunction {
+  std::vector<double> values;
+  bool diagonal = false;
+
+  // out += F x
+  void MultiplyAdd(std::span<const double> x, std::span<double> out) const {
+    const std::size_t n = x.size();
+    if (diagonal) {
+      for (std::size_t i = 0; i < n; ++i) out[i] += values[i] * x[i];
+      return;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      double sum = 0.0;
+      for (std::size_t j = 0; j < n; ++j) sum += values[i * n + j] * x[j];
+      out[i] += sum;
+    }
+  }
+};
+
+// phi_0(hL), ..., phi_p(hL). A dense L is handled through the exponential
+// of the (p + 1) n x (p + 1) n block matrix
+//   [hL I 0 ... 0]
+//   [0  0 I ... 0]
+//   [      ...   ]
+//   [0  0 0 ... 0]
+// whose first block row is [phi_0(hL) phi_1(hL) ... phi_p(hL)]
+std::vector<MatrixFunction> PhiFunctions(const std::vector<double>& l,
+                                         std::size_t n, bool diagonal,
+                                         double h, int p) {
+  std::vector<MatrixFunction> phi(p + 1);
+  if (diagonal) {
+    for (MatrixFunction& f : phi) {
+      f.values.resize(n);
+      f.diagonal = true;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto values = PhiScalars(h * l[i * n + i]);
+      for (int k = 0; k <= p; ++k) phi[k].values[i] = values[k];
+    }
+    return phi;
+  }
+
+  const std::size_t m = (p + 1) * n;
+  std::vector<double> block(m * m, 0.0);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) block[i * m + j] = h * l[i * n + j];
+  }
+  for (std::size_t i = 0; i < m - n; ++i) block[i * m + i + n] = 1.0;
+  const std::vector<double> e = Expm(std::move(block), m);
+
+  for (int k = 0; k <= p; ++k) {
+    phi[k].values.resize(n * n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        phi[k].values[i * n + j] = e[i * m + k * n + j];
+      }
+    }
+  }
+  return phi;
+}
+
+// Sum of weights[k] * phi[k]
+MatrixFunction Combine(const std::vector<MatrixFunction>& phi,
+                       std::span<const double> weights) {
+  MatrixFunction result{std::vector<double>(phi[0].values.size(), 0.0),
+                        phi[0].diagonal};
+  for (std::size_t k = 0; k < weights.size(); ++k) {
+    if (weights[k] == 0.0) continue;
+    for (std::size_t i = 0; i < result.values.size(); ++i) {
+      result.values[i] += weights[k] * phi[k].values[i];
+    }
+  }
+  return result;
+}
+
+// Whether the n x n matrix l has no off-diagonal entries
+bool IsDiagonal(const std::vector<double>& l, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      if (i != j && l[i * n + j] != 0.0) return false;
+    }
+  }
+  return true;
+}
+
+// Fixed-step exponential integration of y' = L y + N(t, y). The method
+// builds its cached matrix functions from (L, n, diagonal, h) and returns a
+// step (t, y, y_new, N) that evaluates the nonlinear part through N
+template <typename Setup>
+Solution Integrate(const std::vector<double>& l, const InPlaceRhs& n_f,
+                   double t0, double t1, const std::vector<double>& y0,
+                   double h, const OutputOptions& out, Setup setup) {
+  // Validate input arguments
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  const std::size_t n = y0.size();
+  if (l.size() != n * n) {
+    throw std::invalid_argument(
+        "Linear part must be an n x n matrix for a state of size n.");
+  }
+
+  // Work counters, with the evaluations of N timed
+  Stats stats;
+  PhaseTimer total_timer(stats.time.total);
+  auto nonlinear = TimedCalls(n_f, stats.time.rhs);
+
+  // The matrix functions depend only on h L and are computed once
+  auto step = setup(l, n, IsDiagonal(l, n), h);
+
+  // Full right-hand side L y + N(t, y), only needed for event detection
+  InPlaceRhs rhs = [&l, &n_f, n](double t, std::span<const double> y,
+                                 std::span<double> dydt) {
+    n_f(t, y, dydt);
+    for (std::size_t i = 0; i < n; ++i) {
+      double sum = 0.0;
+      for (std::size_t j = 0; j < n; ++j) sum += l[i * n + j] * y[j];
+      dydt[i] += sum;
+    }
+  };
+
+  // Compute the number of integration steps
+  const auto steps = static_cast<int>(std::ceil((t1 - t0) / h));
+
+  // Initialise output recording
+  OutputRecorder recorder(out, n, steps, rhs);
+  recorder.Start(t0, y0);
+
+  auto evaluate = [&](double t, std::span<const double> y,
+                      std::span<double> ny) {
+    nonlinear(t, y, ny);
+    stats.n_rhs_evals++;
+  };
+
+  // Perform time stepping
+  std::vector<double> y = y0, y_new(n);
+  double t = t0;
+  for (int i = 0; i < steps; ++i) {
+    step(t, y, y_new, evaluate);
+    y.swap(y_new);
+
+    // Advance time
+    t += h;
+    stats.n_accepted++;
+    if (recorder.Step(t, y)) break;
+  }
+
+  // Return the computed solution with work counters
+  Solution sol = recorder.Finish();
+  stats.n_rhs_evals += recorder.NumRhsEvals();
+  total_timer.Stop();
+  sol.stats = stats;
+  return sol;
+}
+
+}  // namespace
+
+Solution ExponentialEuler(const std::vector<double>& l, const InPlaceRhs& n_f,
+                          double t0, double t1, const std::vector<double>& y0,
+                          double h, const OutputOptions& out) {
+  auto setup = [](const std::vector<double>& l, std::size_t n,
+                  bool diagonal, double h) {
+    // e^{hL} and h phi_1(hL)
+    const std::vector<MatrixFunction> phi =
+        PhiFunctions(l, n, diagonal, h, 1);
+    const std::array<double, 2> kE = {1.0, 0.0};
+    const std::array<double, 2> kB = {0.0, h};
+    std::vector<double> ny(n);
+    return [e = Combine(phi, kE), b = Combine(phi, kB), ny](
+               double t, std::span<const double> y, std::span<double> y_new,
+               auto& evaluate) mutable {
+      evaluate(t, y, ny);
+      std::fill(y_new.begin(), y_new.end(), 0.0);
+      e.MultiplyAdd(y, y_new);
+      b.MultiplyAdd(ny, y_new);
+    };
+  };
+  return Integrate(l, n_f, t0, t1, y0, h, out, setup);
+}
+
+Solution ETDRK4(const std::vector<double>& l, const InPlaceRhs& n_f,
+                double t0, double t1, const std::vector<double>& y0, double h,
+                const OutputOptions& out) {
+  auto setup = [](const std::vector<double>& l, std::size_t n,
+                  bool diagonal, double h) {
+    // Update weights from phi_k(hL), and the midpoint propagators e^{hL/2}
+    // and (h/2) phi_1(hL/2)
+    const std::vector<MatrixFunction> phi =
+        PhiFunctions(l, n, diagonal, h, kMaxPhi);
+    const std::vector<MatrixFunction> half =
+        PhiFunctions(l, n, diagonal, 0.5 * h, 1);
+    const std::array<double, 4> kE = {1.0, 0.0, 0.0, 0.0};
+    const std::array<double, 4> kB1 = {0.0, h, -3.0 * h, 4.0 * h};
+    const std::array<double, 4> kB2 = {0.0, 0.0, 2.0 * h, -4.0 * h};
+    const std::array<double, 4> kB4 = {0.0, 0.0, -h, 4.0 * h};
+    const std::array<double, 2> kE2 = {1.0, 0.0};
+    const std::array<double, 2> kQ = {0.0, 0.5 * h};
+
+    struct Stages {
+      std::vector<double> a, b, c, nu, na, nb, nc, e2u, tmp;
+    };
+    Stages s;
+    for (std::vector<double>* v :
+         {&s.a, &s.b, &s.c, &s.nu, &s.na, &s.nb, &s.nc, &s.e2u, &s.tmp}) {
+      v->resize(n);
+    }
+    return [e = Combine(phi, kE), b1 = Combine(phi, kB1),
+            b2 = Combine(phi, kB2), b4 = Combine(phi, kB4),
+            e2 = Combine(half, kE2), q = Combine(half, kQ), s, h, n](
+               double t, std::span<const double> y, std::span<double> y_new,
+               auto& evaluate) mutable {
+      // a = e^{hL/2} y + Q N(t, y)
+      evaluate(t, y, s.nu);
+      std::fill(s.e2u.begin(), s.e2u.end(), 0.0);
+      e2.MultiplyAdd(y, s.e2u);
+      s.a = s.e2u;
+      q.MultiplyAdd(s.nu, s.a);
+
+      // b = e^{hL/2} y + Q N(t + h/2, a)
+      evaluate(t + 0.5 * h, s.a, s.na);
+      s.b = s.e2u;
+      q.MultiplyAdd(s.na, s.b);
+
+      // c = e^{hL/2} a + Q (2 N(t + h/2, b) - N(t, y))
+      evaluate(t + 0.5 * h, s.b, s.nb);
+      std::fill(s.c.begin(), s.c.end(), 0.0);
+      e2.MultiplyAdd(s.a, s.c);
+      for (std::size_t i = 0; i < n; ++i) s.tmp[i] = 2.0 * s.nb[i] - s.nu[i];
+      q.MultiplyAdd(s.tmp, s.c);
+      evaluate(t + h, s.c, s.nc);
+
+      // Combine the stages with the phi weights
+      std::fill(y_new.begin(), y_new.end(), 0.0);
+      e.MultiplyAdd(y, y_new);
+      b1.MultiplyAdd(s.nu, y_new);
+      for (std::size_t i = 0; i < n; ++i) s.tmp[i] = s.na[i] + s.nb[i];
+      b2.MultiplyAdd(s.tmp, y_new);
+      b4.MultiplyAdd(s.nc, y_new);
+    };
+  };
+  return Integrate(l, n_f, t0, t1, y0, h, out, setup);
+}
+
+}  // namespace vanta::ode
@@ -0,0 +1,162 @@
+#include "ode/interpolation.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+template <typename T>
+void Hermite(double t0, std::span<const T> y0, std::span<const T> f0,
+             double t1, std::span<const T> y1, std::span<const T> f1,
+             double t, std::span<T> out) {
+  const double h = t1 - t0;
+  const double theta = (t - t0) / h;
+  const double s = 1.0 - theta;
+
+  // Hermite basis functions on [0, 1]
+  const double h00 = (1.0 + 2.0 * theta) * s * s;
+  const double h10 = theta * s * s * h;
+  const double h01 = theta * theta * (3.0 - 2.0 * theta);
+  const double h11 = -theta * theta * s * h;
+
+  for (std::size_t j = 0; j < out.size(); ++j) {
+    out[j] = static_cast<T>(h00 * y0[j] + h10 * f0[j] + h01 * y1[j] +
+                            h11 * f1[j]);
+  }
+}
+
+// Index i of the interval with t[i] <= time <= t[i + 1], for a grid of at
+// least two increasing points containing time. A guess from the mean
+// spacing is exact on uniform grids up to rounding, so only its neighbours
+// are checked before falling back to binary search.
+std::size_t FindInterval(std::span<const double> t, double time) {
+  const std::size_t last = t.size() - 1;
+  const double spacing = (t[last] - t[0]) / static_cast<double>(last);
+  if (spacing > 0.0) {
+    const auto guess = std::min(
+        static_cast<std::size_t>((time - t[0]) / spacing), last - 1);
+    const std::size_t lo = guess > 0 ? guess - 1 : 0;
+    const std::size_t hi = std::min(guess + 1, last - 1);
+    for (std::size_t i = lo; i <= hi; ++i) {
+      if (t[i] <= time && time <= t[i + 1]) return i;
+    }
+  }
+  const auto it = std::upper_bound(t.begin(), t.end(), time);
+  const auto i = static_cast<std::size_t>(it - t.begin());
+  return std::min(i > 0 ? i - 1 : 0, last - 1);
+}
+
+// Estimate the derivative at t[i] by differentiating the quadratic through
+// three neighbouring samples, or the line through two if that is all there
+// is
+template <typename T>
+void EstimateDerivative(std::span<const double> t, std::span<const T> y,
+                        std::size_t i, std::span<T> out) {
+  const std::size_t n = out.size();
+  auto row = [&](std::size_t k) { return y.subspan(k * n, n); };
+  const std::size_t last = t.size() - 1;
+  if (last == 1) {
+    const double h = t[1] - t[0];
+    for (std::size_t j = 0; j < n; ++j) {
+      out[j] = static_cast<T>((row(1)[j] - row(0)[j]) / h);
+    }
+    return;
+  }
+
+  // Three-point stencil centred where possible, one-sided at the ends
+  const std::size_t c = std::clamp<std::size_t>(i, 1, last - 1);
+  const double h0 = t[c] - t[c - 1];
+  const double h1 = t[c + 1] - t[c];
+  double w0, w1, w2;
+  if (i < c) {
+    w0 = -(2.0 * h0 + h1) / (h0 * (h0 + h1));
+    w1 = (h0 + h1) / (h0 * h1);
+    w2 = -h0 / (h1 * (h0 + h1));
+  } else if (i > c) {
+    w0 = h1 / (h0 * (h0 + h1));
+    w1 = -(h0 + h1) / (h0 * h1);
+    w2 = (2.0 * h1 + h0) / (h1 * (h0 + h1));
+  } else {
+    w0 = -h1 / (h0 * (h0 + h1));
+    w1 = (h1 - h0) / (h0 * h1);
+    w2 = h0 / (h1 * (h0 + h1));
+  }
+  const std::span<const T> y0 = row(c - 1);
+  const std::span<const T> y1 = row(c);
+  const std::span<const T> y2 = row(c + 1);
+  for (std::size_t j = 0; j < n; ++j) {
+    out[j] = static_cast<T>(w0 * y0[j] + w1 * y1[j] + w2 * y2[j]);
+  }
+}
+
+template <typename T>
+void Trajectory(std::span<const double> t, std::span<const T> y,
+                std::span<const T> dydt, double time, std::span<T> out,
+                std::span<T> work) {
+  if (t.empty()) {
+    throw std::invalid_argument("Solution has no time points.");
+  }
+  if (!(time >= t.front() && time <= t.back())) {
+    throw std::invalid_argument("Time outside the solution interval.");
+  }
+  const std::size_t n = out.size();
+  if (t.size() == 1) {
+    std::copy(y.begin(), y.begin() + n, out.begin());
+    return;
+  }
+
+  const std::size_t i = FindInterval(t, time);
+  std::span<const T> d0, d1;
+  std::vector<T> owned;
+  if (!dydt.empty()) {
+    d0 = dydt.subspan(i * n, n);
+    d1 = dydt.subspan((i + 1) * n, n);
+  } else {
+    if (work.size() < 2 * n) {
+      owned.resize(2 * n);
+      work = owned;
+    }
+    EstimateDerivative(t, y, i, work.first(n));
+    EstimateDerivative(t, y, i + 1, work.subspan(n, n));
+    d0 = work.first(n);
+    d1 = work.subspan(n, n);
+  }
+  Hermite<T>(t[i], y.subspan(i * n, n), d0, t[i + 1],
+             y.subspan((i + 1) * n, n), d1, time, out);
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+void HermiteInterpolate(double t0, std::span<const double> y0,
+                        std::span<const double> f0, double t1,
+                        std::span<const double> y1,
+                        std::span<const double> f1, double t,
+                        std::span<double> out) {
+  Hermite(t0, y0, f0, t1, y1, f1, t, out);
+}
+
+void HermiteInterpolate(double t0, std::span<const float> y0,
+                        std::span<const float> f0, double t1,
+                        std::span<const float> y1, std::span<const float> f1,
+                        double t, std::span<float> out) {
+  Hermite(t0, y0, f0, t1, y1, f1, t, out);
+}
+
+void InterpolateTrajectory(std::span<const double> t,
+                           std::span<const double> y,
+                           std::span<const double> dydt, double time,
+                           std::span<double> out, std::span<double> work) {
+  Trajectory(t, y, dydt, time, out, work);
+}
+
+void InterpolateTrajectory(std::span<const double> t,
+                           std::span<const float> y,
+                           std::span<const float> dydt, double time,
+                           std::span<float> out, std::span<float> work) {
+  Trajectory(t, y, dydt, time, out, work);
+}
+
+}  // namespace vanta::ode
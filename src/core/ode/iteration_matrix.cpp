@@ -0,0 +1,196 @@
+#include "ode/iteration_matrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ode/phase_timer.hpp"
+
+namespace vanta::ode {
+
+IterationMatrix::IterationMatrix(
+    const InPlaceRhs& f, const Jacobian& jacobian, std::size_t n,
+    const vanta::linear_solvers::SparsityPattern& sparsity, BatchRhs batch_f)
+    : f_(f),
+      jacobian_(jacobian),
+      batch_f_(std::move(batch_f)),
+      n_(n),
+      f_at_t_([this](std::span<const double> x, std::span<double> fx) {
+        f_(t_, x, fx);
+      }),
+      batch_at_t_([this](std::span<const double> x, std::span<double> fx,
+                         std::size_t n_points) {
+        batch_f_(t_, x, fx, 0, n_points);
+      }),
+      sparsity_(sparsity) {
+  // Differencing scratch: one perturbed state and its value, or all of them
+  // when batched
+  const bool batched = !jacobian_ && batch_f_;
+  if (sparsity_.Empty()) {
+    jac_.resize(n * n);
+    matrix_.resize(n * n);
+    lu_.lu.resize(n * n);
+    lu_.pivots.resize(n);
+    fd_work_.resize(jacobian_ ? 0 : batched ? 2 * n * n : 2 * n);
+    return;
+  }
+
+  // Validate the pattern against the system size
+  vanta::linear_solvers::ValidatePattern(sparsity_);
+  if (sparsity_.n != n) {
+    throw std::invalid_argument(
+        "Sparsity pattern size must match the number of states.");
+  }
+
+  // Pattern of I - gamma * J, adding any missing diagonal entries
+  matrix_pattern_.n = n;
+  matrix_pattern_.row_ptr.assign(1, 0);
+  jac_map_.resize(sparsity_.NonZeros());
+  diag_map_.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    bool diag_done = false;
+    for (std::size_t p = sparsity_.row_ptr[i]; p < sparsity_.row_ptr[i + 1];
+         ++p) {
+      const std::size_t j = sparsity_.col_idx[p];
+      if (!diag_done && j >= i) {
+        diag_map_[i] = matrix_pattern_.col_idx.size();
+        if (j > i) matrix_pattern_.col_idx.push_back(i);
+        diag_done = true;
+      }
+      jac_map_[p] = matrix_pattern_.col_idx.size();
+      matrix_pattern_.col_idx.push_back(j);
+    }
+    if (!diag_done) {
+      diag_map_[i] = matrix_pattern_.col_idx.size();
+      matrix_pattern_.col_idx.push_back(i);
+    }
+    matrix_pattern_.row_ptr.push_back(matrix_pattern_.col_idx.size());
+  }
+
+  // Symbolic factorisation and column grouping, done once
+  vanta::linear_solvers::SparseLUAnalyse(matrix_pattern_, sparse_lu_);
+  colours_ = vanta::finite_difference::ColourColumns(sparsity_);
+  n_colours_ =
+      n == 0 ? 0 : *std::max_element(colours_.begin(), colours_.end()) + 1;
+
+  jac_.resize(sparsity_.NonZeros());
+  matrix_.resize(matrix_pattern_.NonZeros());
+  fd_work_.resize(jacobian_ ? 0 : batched ? (2 * n_colours_ + 1) * n : 3 * n);
+}
+
+void IterationMatrix::UpdateJacobian(double t, std::span<const double> y,
+                                     std::span<const double> fy) {
+  PhaseTimer timer(jacobian_time_);
+  t_ = t;
+  if (jacobian_) {
+    // Use user provided Jacobian
+    jacobian_(t, y, jac_);
+  } else if (IsSparse()) {
+    // Use compressed numerical approximation at fixed time
+    if (batch_f_) {
+      vanta::finite_difference::BatchForwardDifference(
+          batch_at_t_, y, fy, sparsity_, colours_, jac_, fd_work_);
+    } else {
+      vanta::finite_difference::ForwardDifference(f_at_t_, y, fy, sparsity_,
+                                                  colours_, jac_, fd_work_);
+    }
+    n_rhs_evals_ += n_colours_;
+  } else if (batch_f_) {
+    // Use numerical approximation at fixed time, all columns in one call
+    vanta::finite_difference::BatchForwardDifference(batch_at_t_, y, fy, jac_,
+                                                     fd_work_);
+    n_rhs_evals_ += n_;
+  } else {
+    // Use numerical approximation at fixed time
+    vanta::finite_difference::ForwardDifference(f_at_t_, y, fy, jac_,
+                                                fd_work_);
+    n_rhs_evals_ += n_;
+  }
+
+  has_jacobian_ = true;
+  factorised_ = false;
+  ++n_jacobian_evals_;
+}
+
+void IterationMatrix::Factorise(double gamma) {
+  if (factorised_ && gamma == gamma_) return;
+
+  PhaseTimer timer(linear_solve_time_);
+  if (IsSparse()) {
+    // Form I - gamma * J in the augmented pattern
+    std::fill(matrix_.begin(), matrix_.end(), 0.0);
+    for (std::size_t p = 0; p < jac_.size(); ++p) {
+      matrix_[jac_map_[p]] = -gamma * jac_[p];
+    }
+    for (std::size_t i = 0; i < n_; ++i) matrix_[diag_map_[i]] += 1.0;
+
+    vanta::linear_solvers::SparseLUFactorise(matrix_, sparse_lu_);
+  } else {
+    // Form I - gamma * J
+    for (std::size_t i = 0; i < n_ * n_; ++i) matrix_[i] = -gamma * jac_[i];
+    for (std::size_t i = 0; i < n_; ++i) matrix_[i * n_ + i] += 1.0;
+
+    vanta::linear_solvers::LUFactorise(matrix_, n_, lu_);
+  }
+
+  gamma_ = gamma;
+  factorised_ = true;
+  ++n_factorisations_;
+}
+
+void IterationMatrix::Solve(std::span<double> b) const {
+  PhaseTimer timer(linear_solve_time_);
+  if (IsSparse()) {
+    vanta::linear_solvers::SparseLUSolve(sparse_lu_, b);
+  } else {
+    vanta::linear_solvers::LUSolve(lu_, b);
+  }
+}
+
+double IterationMatrix::SpectralRadius() const {
+  constexpr int kIters = 24;
+  if (!has_jacobian_ || n_ == 0) return 0.0;
+
+  // Start from a vector unlikely to be orthogonal to the dominant
+  // eigenvector
+  std::vector<double> v(n_), w(n_);
+  for (std::size_t i = 0; i < n_; ++i) v[i] = 1.0 + 1.0 / (i + 1.0);
+
+  double log_growth = 0.0;
+  for (int k = 0; k < kIters; ++k) {
+    // w = J v
+    if (IsSparse()) {
+      for (std::size_t i = 0; i < n_; ++i) {
+        double sum = 0.0;
+        for (std::size_t p = sparsity_.row_ptr[i];
+             p < sparsity_.row_ptr[i + 1]; ++p) {
+          sum += jac_[p] * v[sparsity_.col_idx[p]];
+        }
+        w[i] = sum;
+      }
+    } else {
+      for (std::size_t i = 0; i < n_; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < n_; ++j) sum += jac_[i * n_ + j] * v[j];
+        w[i] = sum;
+      }
+    }
+
+    double w_norm = 0.0;
+    double v_norm = 0.0;
+    for (std::size_t i = 0; i < n_; ++i) {
+      w_norm += w[i] * w[i];
+      v_norm += v[i] * v[i];
+    }
+    if (w_norm == 0.0) return 0.0;
+    w_norm = std::sqrt(w_norm);
+    v_norm = std::sqrt(v_norm);
+    if (k >= kIters / 2) log_growth += std::log(w_norm / v_norm);
+    for (std::size_t i = 0; i < n_; ++i) v[i] = w[i] / w_norm;
+  }
+  return std::exp(log_growth / (kIters - kIters / 2));
+}
+
+}  // namespace vanta::ode
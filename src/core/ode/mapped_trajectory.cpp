@@ -0,0 +1,309 @@
+#include "ode/mapped_trajectory.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ode/interpolation.hpp"
+
+namespace {
+
+// File header, followed by capacity time points and capacity state rows
+struct Header {
+  char magic[8];
+  std::uint64_t version;
+  std::uint64_t n_states;
+  std::uint64_t n_steps;
+  std::uint64_t capacity;
+  std::uint64_t reserved[3];
+};
+static_assert(sizeof(Header) == 64, "Header must keep the data aligned.");
+
+constexpr char kMagic[8] = {'V', 'A', 'N', 'T', 'A', 'T', 'R', 'J'};
+constexpr std::uint64_t kVersion = 1;
+constexpr std::size_t kDefaultCapacity = 1024;
+
+// Size in bytes of a file holding capacity samples of n_states components
+std::size_t FileBytes(std::size_t n_states, std::size_t capacity) {
+  return sizeof(Header) + capacity * (1 + n_states) * sizeof(double);
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+// Open file and its current mapping, with the platform calls kept here
+struct MappedTrajectory::File {
+  File(const std::string& path, bool create) : writable(create) {
+#ifdef _WIN32
+    handle = ::CreateFileA(
+        path.c_str(), GENERIC_READ | (create ? GENERIC_WRITE : 0),
+        FILE_SHARE_READ, nullptr, create ? CREATE_ALWAYS : OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+      throw std::runtime_error("Cannot open trajectory file " + path + ".");
+    }
+#else
+    fd = ::open(path.c_str(), create ? O_RDWR | O_CREAT | O_TRUNC : O_RDONLY,
+                0644);
+    if (fd < 0) {
+      throw std::runtime_error("Cannot open trajectory file " + path + ".");
+    }
+#endif
+  }
+
+  File(const File&) = delete;
+  File& operator=(const File&) = delete;
+
+  ~File() {
+    Unmap();
+#ifdef _WIN32
+    ::CloseHandle(handle);
+#else
+    ::close(fd);
+#endif
+  }
+
+  // Current size of the file on disk
+  std::size_t Size() const {
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(handle, &size)) {
+      throw std::runtime_error("Cannot query the trajectory file size.");
+    }
+    return static_cast<std::size_t>(size.QuadPart);
+#else
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      throw std::runtime_error("Cannot query the trajectory file size.");
+    }
+    return static_cast<std::size_t>(info.st_size);
+#endif
+  }
+
+  // Map the first size bytes, first resizing a writable file to match
+  void Map(std::size_t size) {
+    Unmap();
+#ifdef _WIN32
+    if (writable) {
+      LARGE_INTEGER end;
+      end.QuadPart = static_cast<LONGLONG>(size);
+      if (!::SetFilePointerEx(handle, end, nullptr, FILE_BEGIN) ||
+          !::SetEndOfFile(handle)) {
+        throw std::runtime_error("Cannot resize the trajectory file.");
+      }
+    }
+    const auto wide = static_cast<std::uint64_t>(size);
+    mapping = ::CreateFileMappingA(
+        handle, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+        static_cast<DWORD>(wide >> 32), static_cast<DWORD>(wide), nullptr);
+    void* view =
+        mapping ? ::MapViewOfFile(mapping,
+                                  writable ? FILE_MAP_WRITE : FILE_MAP_READ,
+                                  0, 0, size)
+                : nullptr;
+    if (view == nullptr) {
+      Unmap();
+      throw std::runtime_error("Cannot map the trajectory file.");
+    }
+#else
+    if (writable && ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+      throw std::runtime_error("Cannot resize the trajectory file.");
+    }
+    void* view = ::mmap(nullptr, size,
+                        writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                        MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED) {
+      throw std::runtime_error("Cannot map the trajectory file.");
+    }
+#endif
+    data = static_cast<std::byte*>(view);
+    bytes = size;
+  }
+
+  void Unmap() {
+#ifdef _WIN32
+    if (data != nullptr) ::UnmapViewOfFile(data);
+    if (mapping != nullptr) ::CloseHandle(mapping);
+    mapping = nullptr;
+#else
+    if (data != nullptr) ::munmap(data, bytes);
+#endif
+    data = nullptr;
+    bytes = 0;
+  }
+
+  void Sync() {
+    if (data == nullptr || !writable) return;
+#ifdef _WIN32
+    ::FlushViewOfFile(data, 0);
+    ::FlushFileBuffers(handle);
+#else
+    ::msync(data, bytes, MS_SYNC);
+#endif
+  }
+
+  Header* header() const { return reinterpret_cast<Header*>(data); }
+
+  double* times() const {
+    return reinterpret_cast<double*>(data + sizeof(Header));
+  }
+
+#ifdef _WIN32
+  HANDLE handle = INVALID_HANDLE_VALUE;
+  HANDLE mapping = nullptr;
+#else
+  int fd = -1;
+#endif
+  std::byte* data = nullptr;
+  std::size_t bytes = 0;
+  bool writable = false;
+};
+
+MappedTrajectory MappedTrajectory::Create(const std::string& path,
+                                          std::size_t n_states,
+                                          std::size_t capacity) {
+  if (n_states == 0) {
+    throw std::invalid_argument("n_states must be positive.");
+  }
+  if (capacity == 0) capacity = kDefaultCapacity;
+
+  auto file = std::make_unique<File>(path, true);
+  file->Map(FileBytes(n_states, capacity));
+  Header* header = file->header();
+  std::memcpy(header->magic, kMagic, sizeof(kMagic));
+  header->version = kVersion;
+  header->n_states = n_states;
+  header->n_steps = 0;
+  header->capacity = capacity;
+  return MappedTrajectory(std::move(file));
+}
+
+MappedTrajectory MappedTrajectory::Open(const std::string& path) {
+  auto file = std::make_unique<File>(path, false);
+  const std::size_t size = file->Size();
+  if (size < sizeof(Header)) {
+    throw std::runtime_error(path + " is not a trajectory file.");
+  }
+  file->Map(size);
+
+  // Reject foreign files and headers that point past the end of the file
+  const Header* header = file->header();
+  if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 ||
+      header->version != kVersion || header->n_states == 0 ||
+      header->n_steps > header->capacity ||
+      FileBytes(header->n_states, header->capacity) > size) {
+    throw std::runtime_error(path + " is not a trajectory file.");
+  }
+  return MappedTrajectory(std::move(file));
+}
+
+MappedTrajectory::MappedTrajectory(std::unique_ptr<File> file)
+    : file_(std::move(file)) {
+  Bind();
+}
+
+MappedTrajectory::MappedTrajectory(MappedTrajectory&& other) noexcept =
+    default;
+MappedTrajectory& MappedTrajectory::operator=(
+    MappedTrajectory&& other) noexcept = default;
+MappedTrajectory::~MappedTrajectory() = default;
+
+void MappedTrajectory::Bind() {
+  y_ = file_->times() + file_->header()->capacity;
+}
+
+void MappedTrajectory::Reserve(std::size_t capacity) {
+  const std::size_t n = NumStates();
+  const std::size_t old_capacity = file_->header()->capacity;
+  file_->Map(FileBytes(n, capacity));
+
+  // The states follow the time points, so they move up by the added
+  // capacity
+  double* times = file_->times();
+  std::memmove(times + capacity, times + old_capacity,
+               NumSteps() * n * sizeof(double));
+  file_->header()->capacity = capacity;
+  Bind();
+}
+
+void MappedTrajectory::Append(double t_i, std::span<const double> y_i) {
+  if (!IsWritable()) {
+    throw std::runtime_error("Trajectory is open read-only.");
+  }
+  const std::size_t n = NumStates();
+  if (y_i.size() != n) {
+    throw std::invalid_argument("State must have n_states components.");
+  }
+
+  const std::size_t i = NumSteps();
+  if (i == file_->header()->capacity) Reserve(2 * i);
+  double* times = file_->times();
+  times[i] = t_i;
+  std::copy(y_i.begin(), y_i.end(), times + file_->header()->capacity + i * n);
+  file_->header()->n_steps = i + 1;
+}
+
+Observer MappedTrajectory::Writer() {
+  return [this](double t, std::span<const double> y) { Append(t, y); };
+}
+
+void MappedTrajectory::Flush() {
+  if (file_) file_->Sync();
+}
+
+bool MappedTrajectory::IsWritable() const { return file_ && file_->writable; }
+
+std::size_t MappedTrajectory::NumSteps() const {
+  return file_ ? file_->header()->n_steps : 0;
+}
+
+std::size_t MappedTrajectory::NumStates() const {
+  return file_ ? file_->header()->n_states : 0;
+}
+
+std::span<const double> MappedTrajectory::Times() const {
+  if (!file_) return {};
+  return {file_->times(), NumSteps()};
+}
+
+void MappedTrajectory::At(double time, std::span<double> out) const {
+  InterpolateTrajectory(Times(), {y_, NumSteps() * NumStates()}, {}, time,
+                        out);
+}
+
+std::vector<double> MappedTrajectory::At(double time) const {
+  std::vector<double> out(NumStates());
+  At(time, out);
+  return out;
+}
+
+Solution MappedTrajectory::Sample(std::span<const double> times) const {
+  const std::size_t n = NumStates();
+  Solution samples(times.size(), n);
+  std::vector<double> work(2 * n);
+  for (std::size_t k = 0; k < times.size(); ++k) {
+    samples.t[k] = times[k];
+    InterpolateTrajectory(Times(), {y_, NumSteps() * n}, {}, times[k],
+                          samples.Row(k), work);
+  }
+  return samples;
+}
+
+}  // namespace vanta::ode
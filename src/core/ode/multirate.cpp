@@ -0,0 +1,169 @@
+#include "ode/multirate.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "ode/phase_timer.hpp"
+
+namespace vanta::ode {
+
+Solution MultirateRungeKutta4(const PartitionRhs& f_fast,
+                              const PartitionRhs& f_slow,
+                              const std::vector<std::size_t>& fast_indices,
+                              double t0, double t1,
+                              const std::vector<double>& y0, double h,
+                              const MultirateOptions& opts,
+                              const OutputOptions& out) {
+  // Validate input arguments
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (opts.substeps == 0 || opts.substeps % 2 != 0) {
+    throw std::invalid_argument(
+        "Number of substeps must be a positive even number.");
+  }
+
+  // Work counters, with the stepper's calls of both partitions timed
+  Stats stats;
+  PhaseTimer total_timer(stats.time.total);
+  auto timed_fast = TimedCalls(f_fast, stats.time.rhs);
+  auto timed_slow = TimedCalls(f_slow, stats.time.rhs);
+
+  // Split the state into the fast partition and its complement
+  const std::size_t n = y0.size();
+  std::vector<bool> is_fast(n, false);
+  for (std::size_t i : fast_indices) {
+    if (i >= n) {
+      throw std::invalid_argument("Fast index out of range.");
+    }
+    if (is_fast[i]) {
+      throw std::invalid_argument("Fast indices must not repeat.");
+    }
+    is_fast[i] = true;
+  }
+  const std::vector<std::size_t>& fast = fast_indices;
+  std::vector<std::size_t> slow;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!is_fast[i]) slow.push_back(i);
+  }
+  const std::size_t nf = fast.size();
+  const std::size_t ns = slow.size();
+
+  // Compute the number of macro steps
+  const auto steps = static_cast<int>(std::ceil((t1 - t0) / h));
+
+  // Derivative of the full state, only needed for event detection
+  InPlaceRhs rhs = [&f_fast, &f_slow, &fast, &slow,
+                    df = std::vector<double>(nf),
+                    ds = std::vector<double>(ns)](
+                       double t, std::span<const double> y,
+                       std::span<double> dydt) mutable {
+    f_fast(t, y, df);
+    f_slow(t, y, ds);
+    for (std::size_t i = 0; i < df.size(); ++i) dydt[fast[i]] = df[i];
+    for (std::size_t i = 0; i < ds.size(); ++i) dydt[slow[i]] = ds[i];
+  };
+
+  // Initialise output recording
+  OutputRecorder recorder(out, n, steps, rhs);
+  recorder.Start(t0, y0);
+
+  // Full state and the state at which the partition derivatives are taken
+  std::vector<double> y = y0;
+  std::vector<double> z(n);
+
+  // Slow derivatives at this and the previous macro step, extrapolation
+  // curvature and RK4 stage slopes
+  std::vector<double> s0(ns), s_prev(ns), curvature(ns, 0.0);
+  std::vector<double> k2(ns), k3(ns), k4(ns);
+
+  // Fast state, its value at the macro step midpoint, and micro step stages
+  std::vector<double> yf(nf), yf_mid(nf), yf_stage(nf);
+  std::vector<double> fk1(nf), fk2(nf), fk3(nf), fk4(nf);
+
+  const double dt = h / static_cast<double>(opts.substeps);
+  double t = t0;
+  for (int step = 0; step < steps; ++step) {
+    // Slow derivative at the start of the macro step
+    timed_slow(t, y, s0);
+    stats.n_rhs_evals++;
+    if (step > 0) {
+      for (std::size_t j = 0; j < ns; ++j) {
+        curvature[j] = (s0[j] - s_prev[j]) / h;
+      }
+    }
+
+    // Fast derivative at offset tau into the step, with the slow
+    // components extrapolated to that time
+    auto fast_rhs = [&](double tau, std::span<const double> stage,
+                        std::span<double> k) {
+      for (std::size_t j = 0; j < ns; ++j) {
+        z[slow[j]] =
+            y[slow[j]] + tau * s0[j] + 0.5 * tau * tau * curvature[j];
+      }
+      for (std::size_t i = 0; i < nf; ++i) z[fast[i]] = stage[i];
+      timed_fast(t + tau, z, k);
+      stats.n_fast_rhs_evals++;
+    };
+
+    // Sub-cycle the fast partition with classical RK4 micro steps
+    for (std::size_t i = 0; i < nf; ++i) yf[i] = y[fast[i]];
+    for (std::size_t m = 0; m < opts.substeps; ++m) {
+      const double tau = static_cast<double>(m) * dt;
+      fast_rhs(tau, yf, fk1);
+      for (std::size_t i = 0; i < nf; ++i) {
+        yf_stage[i] = yf[i] + 0.5 * dt * fk1[i];
+      }
+      fast_rhs(tau + 0.5 * dt, yf_stage, fk2);
+      for (std::size_t i = 0; i < nf; ++i) {
+        yf_stage[i] = yf[i] + 0.5 * dt * fk2[i];
+      }
+      fast_rhs(tau + 0.5 * dt, yf_stage, fk3);
+      for (std::size_t i = 0; i < nf; ++i) yf_stage[i] = yf[i] + dt * fk3[i];
+      fast_rhs(tau + dt, yf_stage, fk4);
+      for (std::size_t i = 0; i < nf; ++i) {
+        yf[i] += (dt / 6.0) * (fk1[i] + 2.0 * fk2[i] + 2.0 * fk3[i] + fk4[i]);
+      }
+      if (m + 1 == opts.substeps / 2) yf_mid = yf;
+    }
+
+    // Advance the slow partition by one RK4 step, taking the fast
+    // components from the sub-cycled trajectory
+    for (std::size_t i = 0; i < nf; ++i) z[fast[i]] = yf_mid[i];
+    for (std::size_t j = 0; j < ns; ++j) {
+      z[slow[j]] = y[slow[j]] + 0.5 * h * s0[j];
+    }
+    timed_slow(t + 0.5 * h, z, k2);
+    for (std::size_t j = 0; j < ns; ++j) {
+      z[slow[j]] = y[slow[j]] + 0.5 * h * k2[j];
+    }
+    timed_slow(t + 0.5 * h, z, k3);
+    for (std::size_t i = 0; i < nf; ++i) z[fast[i]] = yf[i];
+    for (std::size_t j = 0; j < ns; ++j) z[slow[j]] = y[slow[j]] + h * k3[j];
+    timed_slow(t + h, z, k4);
+    stats.n_rhs_evals += 3;
+
+    for (std::size_t j = 0; j < ns; ++j) {
+      y[slow[j]] += (h / 6.0) * (s0[j] + 2.0 * k2[j] + 2.0 * k3[j] + k4[j]);
+    }
+    for (std::size_t i = 0; i < nf; ++i) y[fast[i]] = yf[i];
+    s_prev.swap(s0);
+
+    // Advance time
+    t += h;
+    stats.n_accepted++;
+    if (recorder.Step(t, y)) break;
+  }
+
+  // Return the computed solution with work counters
+  Solution sol = recorder.Finish();
+  stats.n_rhs_evals += recorder.NumRhsEvals();
+  total_timer.Stop();
+  sol.stats = stats;
+  return sol;
+}
+
+}  // namespace vanta::ode
@@ -0,0 +1,226 @@
+#include "ode/output.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+// View of a state as doubles, converted through buffer unless it already is
+template <typename T>
+std::span<const double> AsDouble(std::span<const T> y,
+                                 std::vector<double>& buffer) {
+  if constexpr (std::is_same_v<T, double>) {
+    return y;
+  } else {
+    buffer.assign(y.begin(), y.end());
+    return buffer;
+  }
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+template <OdeScalar T>
+BasicOutputRecorder<T>::BasicOutputRecorder(const OutputOptions& opts,
+                                            std::size_t n_states,
+                                            std::size_t expected_steps,
+                                            BasicInPlaceRhs<T> f)
+    : opts_(opts),
+      sol_(0, n_states),
+      locator_(opts.events, n_states),
+      f_(std::move(f)),
+      y_last_(n_states) {
+  if (!std::is_sorted(opts_.times.begin(), opts_.times.end())) {
+    throw std::invalid_argument("Output times must be sorted.");
+  }
+  if (locator_.Active()) {
+    if (!f_) {
+      throw std::invalid_argument("Events require the right-hand side.");
+    }
+    dydt_.resize(n_states);
+    if constexpr (!std::is_same_v<T, double>) y_event_.resize(n_states);
+  }
+  if (opts_.dense && opts_.store) {
+    if (!f_) {
+      throw std::invalid_argument(
+          "Dense output requires the right-hand side.");
+    }
+    dydt_last_.resize(n_states);
+    dydt_dense_.resize(n_states);
+  }
+
+  // Reserve storage for the samples that will be kept
+  if (opts_.store) {
+    std::size_t rows = 1;
+    if (!opts_.times.empty()) {
+      rows = opts_.times.size();
+      y_interp_.resize(n_states);
+    } else if (opts_.stride > 0 && expected_steps > 0) {
+      rows = expected_steps / opts_.stride + 2;
+    }
+    sol_.t.reserve(rows);
+    sol_.y.reserve(rows * n_states);
+    if (opts_.dense) sol_.dydt.reserve(rows * n_states);
+  } else if (!opts_.times.empty()) {
+    y_interp_.resize(n_states);
+  }
+}
+
+template <OdeScalar T>
+void BasicOutputRecorder<T>::Start(double t0, std::span<const T> y0,
+                                   std::span<const T> dydt0) {
+  if (locator_.Active()) {
+    if (dydt0.empty()) {
+      f_(t0, y0, dydt_);
+      ++n_rhs_evals_;
+      dydt0 = dydt_;
+    }
+    LocatorStart(t0, y0, dydt0);
+  }
+
+  t_last_ = t0;
+  std::copy(y0.begin(), y0.end(), y_last_.begin());
+
+  if (!opts_.times.empty()) {
+    // Skip requested times before the start of integration
+    while (next_time_ < opts_.times.size() && opts_.times[next_time_] < t0) {
+      ++next_time_;
+    }
+    if (next_time_ < opts_.times.size() && opts_.times[next_time_] == t0) {
+      Emit(t0, y0, dydt0);
+      ++next_time_;
+    }
+    return;
+  }
+
+  if (opts_.stride > 0) {
+    Emit(t0, y0, dydt0);
+  } else {
+    KeepDerivative(dydt0);
+    last_emitted_ = false;
+  }
+}
+
+template <OdeScalar T>
+bool BasicOutputRecorder<T>::Step(double t, std::span<const T> y,
+                                  std::span<const T> dydt) {
+  if (locator_.Active()) {
+    if (dydt.empty()) {
+      f_(t, y, dydt_);
+      ++n_rhs_evals_;
+      dydt = dydt_;
+    }
+
+    // Cut the step short at a terminal event
+    if (LocatorStep(t, y, dydt)) {
+      terminated_ = true;
+      std::span<const T> y_event;
+      if constexpr (std::is_same_v<T, double>) {
+        y_event = locator_.State();
+      } else {
+        std::copy(locator_.State().begin(), locator_.State().end(),
+                  y_event_.begin());
+        y_event = y_event_;
+      }
+      Record(locator_.Time(), y_event, {});
+      return true;
+    }
+  }
+
+  Record(t, y, dydt);
+  return false;
+}
+
+template <OdeScalar T>
+void BasicOutputRecorder<T>::Record(double t, std::span<const T> y,
+                                    std::span<const T> dydt) {
+  if (!opts_.times.empty()) {
+    // Interpolate every requested time inside (t_last_, t]
+    while (next_time_ < opts_.times.size() && opts_.times[next_time_] <= t) {
+      const double t_out = opts_.times[next_time_];
+      if (t_out == t) {
+        Emit(t, y, dydt);
+      } else {
+        const double theta = (t_out - t_last_) / (t - t_last_);
+        for (size_t j = 0; j < y.size(); ++j) {
+          y_interp_[j] =
+              static_cast<T>(y_last_[j] + theta * (y[j] - y_last_[j]));
+        }
+        Emit(t_out, y_interp_);
+      }
+      ++next_time_;
+    }
+    t_last_ = t;
+    std::copy(y.begin(), y.end(), y_last_.begin());
+    return;
+  }
+
+  ++steps_since_emit_;
+  if (opts_.stride > 0 && steps_since_emit_ == opts_.stride) {
+    Emit(t, y, dydt);
+    steps_since_emit_ = 0;
+    last_emitted_ = true;
+  } else {
+    // Hold on to the step in case it turns out to be the last one
+    t_last_ = t;
+    std::copy(y.begin(), y.end(), y_last_.begin());
+    KeepDerivative(dydt);
+    last_emitted_ = false;
+  }
+}
+
+template <OdeScalar T>
+void BasicOutputRecorder<T>::KeepDerivative(std::span<const T> dydt) {
+  has_dydt_last_ = !dydt.empty() && !dydt_last_.empty();
+  if (has_dydt_last_) std::copy(dydt.begin(), dydt.end(), dydt_last_.begin());
+}
+
+template <OdeScalar T>
+BasicSolution<T> BasicOutputRecorder<T>::Finish() {
+  if (opts_.times.empty() && !last_emitted_) {
+    Emit(t_last_, y_last_,
+         has_dydt_last_ ? std::span<const T>(dydt_last_)
+                        : std::span<const T>());
+    last_emitted_ = true;
+  }
+  sol_.events = locator_.TakeRecords();
+  sol_.terminated = terminated_;
+  return std::move(sol_);
+}
+
+template <OdeScalar T>
+void BasicOutputRecorder<T>::Emit(double t, std::span<const T> y,
+                                  std::span<const T> dydt) {
+  if (opts_.observer) opts_.observer(t, AsDouble(y, y_double_));
+  if (!opts_.store) return;
+  sol_.Append(t, y);
+  if (opts_.dense) {
+    if (dydt.empty()) {
+      f_(t, y, dydt_dense_);
+      ++n_rhs_evals_;
+      dydt = dydt_dense_;
+    }
+    sol_.dydt.insert(sol_.dydt.end(), dydt.begin(), dydt.end());
+  }
+}
+
+template <OdeScalar T>
+void BasicOutputRecorder<T>::LocatorStart(double t, std::span<const T> y,
+                                          std::span<const T> dydt) {
+  locator_.Start(t, AsDouble(y, y_double_), AsDouble(dydt, dydt_double_));
+}
+
+template <OdeScalar T>
+bool BasicOutputRecorder<T>::LocatorStep(double t, std::span<const T> y,
+                                         std::span<const T> dydt) {
+  return locator_.Step(t, AsDouble(y, y_double_),
+                       AsDouble(dydt, dydt_double_));
+}
+
+template class BasicOutputRecorder<float>;
+template class BasicOutputRecorder<double>;
+
+}  // namespace vanta::ode
@@ -0,0 +1,156 @@
+#include "ode/parareal.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <stdexcept>
+
+#include "ode/runge_kutta_4.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace vanta::ode {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Seconds elapsed since start
+double Elapsed(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Number of equal steps of at most h covering [t_start, t_end]
+std::size_t NumSteps(double t_start, double t_end, double h) {
+  return std::max<std::size_t>(
+      1, static_cast<std::size_t>(std::ceil((t_end - t_start) / h)));
+}
+
+}  // namespace
+
+PararealSolution Parareal(const Propagator& coarse, const Propagator& fine,
+                          double t0, double t1, const std::vector<double>& y0,
+                          PararealOptions opts) {
+  // Validate input arguments
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (!coarse || !fine) {
+    throw std::invalid_argument("Coarse and fine propagators are required.");
+  }
+
+  const Clock::time_point start = Clock::now();
+  vanta::utils::ThreadPool pool(opts.n_threads);
+  const std::size_t n_slices =
+      opts.n_slices > 0 ? opts.n_slices : pool.Size();
+  const std::size_t max_iters =
+      opts.max_iters > 0 ? opts.max_iters : n_slices;
+  const std::size_t n = y0.size();
+
+  // Slice boundaries, landing exactly on t1
+  PararealSolution result;
+  Solution& sol = result.solution;
+  sol = Solution(n_slices + 1, n);
+  for (std::size_t s = 0; s < n_slices; ++s) {
+    sol.t[s] = t0 + (t1 - t0) * static_cast<double>(s) / n_slices;
+  }
+  sol.t[n_slices] = t1;
+
+  // Initial guess from a serial coarse sweep, keeping G(U_s) per slice
+  std::vector<double> g_old((n_slices + 1) * n);
+  std::copy(y0.begin(), y0.end(), sol.Row(0).begin());
+  for (std::size_t s = 0; s < n_slices; ++s) {
+    std::span<double> next = sol.Row(s + 1);
+    std::copy(sol.Row(s).begin(), sol.Row(s).end(), next.begin());
+    coarse(sol.t[s], sol.t[s + 1], next);
+    std::copy(next.begin(), next.end(), g_old.begin() + (s + 1) * n);
+  }
+
+  std::vector<double> f_new((n_slices + 1) * n);
+  std::vector<double> g_new(n);
+  std::vector<double> fine_time(n_slices);
+  for (std::size_t k = 0; k < max_iters; ++k) {
+    // Boundaries before slice k are exact, so only later slices need F
+    std::vector<std::future<void>> tasks;
+    for (std::size_t s = k; s < n_slices; ++s) {
+      tasks.push_back(pool.Submit([&, s]() {
+        const Clock::time_point task_start = Clock::now();
+        std::span<double> y(f_new.data() + (s + 1) * n, n);
+        std::copy(sol.Row(s).begin(), sol.Row(s).end(), y.begin());
+        fine(sol.t[s], sol.t[s + 1], y);
+        fine_time[s] = Elapsed(task_start);
+      }));
+    }
+    // Let every task finish before get() can rethrow, since queued tasks
+    // write into buffers that unwinding would free
+    for (const std::future<void>& task : tasks) task.wait();
+    for (std::future<void>& task : tasks) task.get();
+    if (k == 0) {
+      for (double time : fine_time) result.serial_time += time;
+    }
+
+    // Serial coarse correction sweep
+    double update = 0.0;
+    for (std::size_t s = k; s < n_slices; ++s) {
+      std::copy(sol.Row(s).begin(), sol.Row(s).end(), g_new.begin());
+      coarse(sol.t[s], sol.t[s + 1], g_new);
+
+      std::span<double> next = sol.Row(s + 1);
+      for (std::size_t j = 0; j < n; ++j) {
+        const std::size_t i = (s + 1) * n + j;
+        const double value = g_new[j] + f_new[i] - g_old[i];
+        update = std::max(update, std::abs(value - next[j]) /
+                                      std::max(1.0, std::abs(value)));
+        next[j] = value;
+        g_old[i] = g_new[j];
+      }
+    }
+
+    result.iterations = k + 1;
+    result.update = update;
+    if (update <= opts.tol || k + 1 == n_slices) {
+      result.converged = true;
+      break;
+    }
+  }
+
+  result.wall_time = Elapsed(start);
+  sol.stats.time.total = result.wall_time;
+  result.speedup = result.serial_time / result.wall_time;
+  return result;
+}
+
+Propagator EulerForwardPropagator(InPlaceRhs f, double h) {
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+
+  return [f = std::move(f), h](double t_start, double t_end,
+                               std::span<double> y) {
+    const std::size_t steps = NumSteps(t_start, t_end, h);
+    const double dt = (t_end - t_start) / static_cast<double>(steps);
+    std::vector<double> dydt(y.size());
+    for (std::size_t i = 0; i < steps; ++i) {
+      f(t_start + i * dt, y, dydt);
+      for (std::size_t j = 0; j < y.size(); ++j) y[j] += dt * dydt[j];
+    }
+  };
+}
+
+Propagator RungeKutta4Propagator(InPlaceRhs f, double h) {
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+
+  return [f = std::move(f), h](double t_start, double t_end,
+                               std::span<double> y) {
+    const std::size_t steps = NumSteps(t_start, t_end, h);
+    const double dt = (t_end - t_start) / static_cast<double>(steps);
+    RK4Workspace ws(y.size());
+    for (std::size_t i = 0; i < steps; ++i) {
+      RungeKutta4Step(f, t_start + i * dt, y, dt, y, ws);
+    }
+  };
+}
+
+}  // namespace vanta::ode
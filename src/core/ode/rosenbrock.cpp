@@ -0,0 +1,212 @@
+#include "ode/rosenbrock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "ode/iteration_matrix.hpp"
+#include "ode/phase_timer.hpp"
+
+namespace {
+
+// ROS3 coefficients in transformed form (Sandu et al., 1997)
+constexpr double kGamma = 4.3586652150845899941601945119356e-01;
+
+// Stage offsets; a31 = a21 and a32 = 0, so stages 2 and 3 share one f
+constexpr double kA21 = 1.0;
+
+constexpr double kC21 = -1.0156171083877702091975600115545;
+constexpr double kC31 = 4.0759956452537699824805835358067;
+constexpr double kC32 = 9.2076794298330791242156818474003;
+
+// Stage times alpha_i and time derivative weights gamma_i
+constexpr double kAlpha2 = 4.3586652150845899941601945119356e-01;
+constexpr double kD1 = 4.3586652150845899941601945119356e-01;
+constexpr double kD2 = 2.4291996454816804366592249683314e-01;
+constexpr double kD3 = 2.1851380027664058511513169485832;
+
+// Third-order weights
+constexpr double kM1 = 1.0;
+constexpr double kM2 = 6.1697947043828245592553615689730;
+constexpr double kM3 = -4.277225654321857332623837380651e-01;
+
+// Difference to the embedded second-order weights
+constexpr double kE1 = 0.5;
+constexpr double kE2 = -2.9079558716805469821718236208017;
+constexpr double kE3 = 2.235406989781156962736090927619e-01;
+
+// Order of the embedded solution plus one, used by the controller
+constexpr double kErrorOrder = 3.0;
+
+// Scaled root-mean-square norm used for error control
+double RmsNorm(const std::vector<double>& v, const std::vector<double>& y_a,
+               const std::vector<double>& y_b, double atol, double rtol) {
+  if (v.empty()) return 0.0;
+  double sum = 0.0;
+  for (size_t i = 0; i < v.size(); ++i) {
+    const double sc =
+        atol + rtol * std::max(std::abs(y_a[i]), std::abs(y_b[i]));
+    sum += (v[i] / sc) * (v[i] / sc);
+  }
+  return std::sqrt(sum / static_cast<double>(v.size()));
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+Solution Rosenbrock(const Rhs& f, const double& t0, const double& t1,
+                    const std::vector<double>& y0,
+                    const RosenbrockOptions& opts,
+                    const OutputOptions& out) {
+  return Rosenbrock(ToInPlaceRhs(f), t0, t1, y0, opts, out);
+}
+
+Solution Rosenbrock(const InPlaceRhs& f, const double& t0,
+                    const double& t1, const std::vector<double>& y0,
+                    const RosenbrockOptions& opts,
+                    const OutputOptions& out) {
+  // Validate input arguments
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (opts.rtol <= 0.0 || opts.atol <= 0.0) {
+    throw std::invalid_argument("Tolerances rtol and atol must be positive.");
+  }
+  if (opts.h0 < 0.0 || opts.h_max <= 0.0) {
+    throw std::invalid_argument("Step sizes h0 and h_max must be positive.");
+  }
+
+  const size_t n = y0.size();
+
+  // Work counters, with the stepper's right-hand side calls timed
+  Stats stats;
+  PhaseTimer total_timer(stats.time.total);
+  auto rhs = TimedCalls(f, stats.time.rhs);
+
+  // Stage and state storage, allocated once
+  std::vector<double> y = y0;
+  std::vector<double> y_new(n), y_stage(n), err(n);
+  std::vector<double> f0(n), ft(n, 0.0), fs(n), k1(n), k2(n), k3(n);
+  IterationMatrix matrix(f, opts.jacobian, n, opts.sparsity, opts.batch_rhs);
+
+  // Derivative at the initial state
+  rhs(t0, y, f0);
+  stats.n_rhs_evals++;
+
+  // Initialise output recording
+  OutputRecorder recorder(out, n, 0, f);
+  recorder.Start(t0, y0, f0);
+
+  // Initial step size
+  double h = opts.h0;
+  if (h == 0.0) {
+    const double d0 = RmsNorm(y, y, y, opts.atol, opts.rtol);
+    const double d1 = RmsNorm(f0, y, y, opts.atol, opts.rtol);
+    h = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+  }
+  h = std::min(h, opts.h_max);
+
+  double t = t0;
+  bool step_start = true;
+  for (int step = 0; t < t1; ++step) {
+    if (step >= opts.max_steps) {
+      throw std::runtime_error("Maximum number of steps exceeded.");
+    }
+
+    // Derivatives at the start of the step, kept if the step is rejected
+    if (step_start) {
+      if (t > t0) {
+        rhs(t, y, f0);
+        stats.n_rhs_evals++;
+      }
+      matrix.UpdateJacobian(t, y, f0);
+      if (!opts.autonomous) {
+        const double dt =
+            std::sqrt(std::numeric_limits<double>::epsilon()) *
+            std::max(std::abs(t), 1.0);
+        rhs(t + dt, y, ft);
+        stats.n_rhs_evals++;
+        for (size_t i = 0; i < n; ++i) ft[i] = (ft[i] - f0[i]) / dt;
+      }
+      step_start = false;
+    }
+
+    // Land exactly on the final time
+    bool last = false;
+    if (t + h >= t1) {
+      h = t1 - t;
+      last = true;
+    }
+    if (h <= 10.0 * std::abs(t) * std::numeric_limits<double>::epsilon()) {
+      throw std::runtime_error("Step size underflow.");
+    }
+
+    // One factorisation of I - h * gamma * J serves all three stages, which
+    // solve (I - h * gamma * J) U = h * gamma * rhs
+    const double hg = h * kGamma;
+    matrix.Factorise(hg);
+
+    // Stage 1
+    for (size_t i = 0; i < n; ++i) k1[i] = hg * (f0[i] + h * kD1 * ft[i]);
+    matrix.Solve(k1);
+
+    // Stage 2
+    for (size_t i = 0; i < n; ++i) y_stage[i] = y[i] + kA21 * k1[i];
+    rhs(t + kAlpha2 * h, y_stage, fs);
+    for (size_t i = 0; i < n; ++i) {
+      k2[i] = hg * (fs[i] + kC21 * k1[i] / h + h * kD2 * ft[i]);
+    }
+    matrix.Solve(k2);
+
+    // Stage 3, reusing the right-hand side value of stage 2
+    for (size_t i = 0; i < n; ++i) {
+      k3[i] = hg * (fs[i] + (kC31 * k1[i] + kC32 * k2[i]) / h +
+                    h * kD3 * ft[i]);
+    }
+    matrix.Solve(k3);
+    stats.n_rhs_evals++;
+
+    // Third-order solution and embedded error estimate
+    for (size_t i = 0; i < n; ++i) {
+      y_new[i] = y[i] + kM1 * k1[i] + kM2 * k2[i] + kM3 * k3[i];
+      err[i] = kE1 * k1[i] + kE2 * k2[i] + kE3 * k3[i];
+    }
+    const double err_norm = RmsNorm(err, y, y_new, opts.atol, opts.rtol);
+
+    // Step size update from the error estimate
+    double factor = opts.max_factor;
+    if (err_norm > 0.0) {
+      factor = opts.safety * std::pow(err_norm, -1.0 / kErrorOrder);
+      factor = std::clamp(factor, opts.min_factor, opts.max_factor);
+    }
+
+    if (err_norm <= 1.0) {
+      // Accept the step
+      t = last ? t1 : t + h;
+      y.swap(y_new);
+      stats.n_accepted++;
+      if (recorder.Step(t, y)) break;
+      step_start = true;
+      h = std::min(h * factor, opts.h_max);
+    } else {
+      // Reject the step and retry with a smaller one
+      h *= std::min(factor, 1.0);
+      stats.n_rejected++;
+    }
+  }
+
+  // Return the computed solution with work counters
+  Solution sol = recorder.Finish();
+  stats.n_rhs_evals += matrix.NumRhsEvals() + recorder.NumRhsEvals();
+  stats.n_jacobian_evals = matrix.NumJacobianEvals();
+  stats.n_factorisations = matrix.NumFactorisations();
+  stats.time.jacobian = matrix.JacobianTime();
+  stats.time.linear_solve = matrix.LinearSolveTime();
+  total_timer.Stop();
+  sol.stats = stats;
+  return sol;
+}
+
+}  // namespace vanta::ode
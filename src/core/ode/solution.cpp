@@ -0,0 +1,38 @@
+#include "ode/solution.hpp"
+
+#include "ode/interpolation.hpp"
+
+namespace vanta::ode {
+
+template <typename T>
+void BasicSolution<T>::At(double time, std::span<T> out) const {
+  const std::span<const T> derivatives =
+      HasDerivatives() ? std::span<const T>(dydt) : std::span<const T>();
+  InterpolateTrajectory(t, y, derivatives, time, out);
+}
+
+template <typename T>
+std::vector<T> BasicSolution<T>::At(double time) const {
+  std::vector<T> out(n_states);
+  At(time, out);
+  return out;
+}
+
+template <typename T>
+BasicSolution<T> BasicSolution<T>::Sample(
+    std::span<const double> times) const {
+  BasicSolution samples(times.size(), n_states);
+  std::vector<T> work(HasDerivatives() ? 0 : 2 * n_states);
+  const std::span<const T> derivatives =
+      HasDerivatives() ? std::span<const T>(dydt) : std::span<const T>();
+  for (std::size_t k = 0; k < times.size(); ++k) {
+    samples.t[k] = times[k];
+    InterpolateTrajectory(t, y, derivatives, times[k], samples.Row(k), work);
+  }
+  return samples;
+}
+
+template struct BasicSolution<float>;
+template struct BasicSolution<double>;
+
+}  // namespace vanta::ode
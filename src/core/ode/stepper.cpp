@@ -0,0 +1,173 @@
+#include "ode/stepper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "ode/phase_timer.hpp"
+
+namespace {
+
+// Jacobian updates allowed within one step before giving up
+constexpr int kMaxJacobianUpdates = 4;
+
+// Euclidean norm of a vector
+double Norm(std::span<const double> v) {
+  double sum = 0.0;
+  for (double val : v) sum += val * val;
+  return std::sqrt(sum);
+}
+
+}  // namespace
+
+namespace vanta::ode {
+
+EulerBackwardStepper::EulerBackwardStepper(const InPlaceRhs& f, double t0,
+                                           const std::vector<double>& y0,
+                                           double h, const EBOptions& opts)
+    : f_(f),
+      opts_(opts),
+      t_(t0),
+      h_(h),
+      y_(y0),
+      x_(y0.size()),
+      fx_(y0.size()),
+      res_(y0.size()),
+      matrix_(f_, opts_.jacobian, y0.size(), opts_.sparsity,
+              opts_.batch_rhs) {
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+}
+
+void EulerBackwardStepper::Init(double t0, std::span<const double> y0) {
+  if (y0.size() != y_.size()) {
+    throw std::invalid_argument("State size must not change.");
+  }
+  std::copy(y0.begin(), y0.end(), y_.begin());
+  t_ = t0;
+  jacobian_stale_ = true;
+
+  // The matrix counters are cumulative, so remember where this run starts
+  stats_ = {};
+  matrix_base_ = {};
+  matrix_base_.n_rhs_evals = matrix_.NumRhsEvals();
+  matrix_base_.n_jacobian_evals = matrix_.NumJacobianEvals();
+  matrix_base_.n_factorisations = matrix_.NumFactorisations();
+  matrix_base_.time.jacobian = matrix_.JacobianTime();
+  matrix_base_.time.linear_solve = matrix_.LinearSolveTime();
+}
+
+void EulerBackwardStepper::Step() { Advance(h_); }
+
+void EulerBackwardStepper::AdvanceTo(double t_target) {
+  if (t_target < t_) {
+    throw std::invalid_argument("Cannot advance to an earlier time.");
+  }
+  for (double h = StepTowards(t_, t_target, h_); h > 0.0;
+       h = StepTowards(t_, t_target, h_)) {
+    Advance(h);
+    if (h != h_) break;
+  }
+  t_ = t_target;
+}
+
+Stats EulerBackwardStepper::Statistics() const {
+  Stats stats = stats_;
+  stats.n_rhs_evals += matrix_.NumRhsEvals() - matrix_base_.n_rhs_evals;
+  stats.n_jacobian_evals =
+      matrix_.NumJacobianEvals() - matrix_base_.n_jacobian_evals;
+  stats.n_factorisations =
+      matrix_.NumFactorisations() - matrix_base_.n_factorisations;
+  stats.time.jacobian = matrix_.JacobianTime() - matrix_base_.time.jacobian;
+  stats.time.linear_solve =
+      matrix_.LinearSolveTime() - matrix_base_.time.linear_solve;
+  return stats;
+}
+
+void EulerBackwardStepper::Advance(double h) {
+  const std::size_t n = y_.size();
+  const double t = t_ + h;
+  auto rhs = TimedCalls(f_, stats_.time.rhs);
+
+  // Solve the backward Euler residual F(x) = x - y - h * f(t + h, x) by
+  // modified Newton, starting from the previous state
+  std::copy(y_.begin(), y_.end(), x_.begin());
+  rhs(t, x_, fx_);
+  ++stats_.n_rhs_evals;
+
+  int jacobian_updates = 0;
+  for (;;) {
+    // Refresh the Jacobian at the current iterate if requested
+    if (jacobian_stale_) {
+      matrix_.UpdateJacobian(t, x_, fx_);
+      jacobian_stale_ = false;
+      ++jacobian_updates;
+    }
+    matrix_.Factorise(h);
+
+    bool converged = false;
+    bool diverged = false;
+    double res_norm_prev = 0.0;
+    double rate = 0.0;
+    for (int iter = 0;; ++iter) {
+      // Evaluate residual and check convergence
+      for (std::size_t j = 0; j < n; ++j) {
+        res_[j] = x_[j] - y_[j] - h * fx_[j];
+      }
+      const double res_norm = Norm(res_);
+      if (res_norm < opts_.tol) {
+        converged = true;
+        break;
+      }
+
+      // Give up on this matrix if diverging or out of iterations
+      if (iter > 0) {
+        rate = res_norm / res_norm_prev;
+        if (rate >= 1.0) {
+          diverged = true;
+          break;
+        }
+      }
+      if (iter == opts_.max_iters) break;
+      res_norm_prev = res_norm;
+
+      // Solve (I - h * J) * delta = -F and update the iterate
+      for (double& val : res_) val = -val;
+      matrix_.Solve(res_);
+      ++stats_.n_newton_iters;
+      for (std::size_t j = 0; j < n; ++j) x_[j] += res_[j];
+      rhs(t, x_, fx_);
+      ++stats_.n_rhs_evals;
+      if (Norm(res_) <= opts_.tol * (1.0 + Norm(x_))) {
+        converged = true;
+        break;
+      }
+    }
+
+    if (converged) {
+      // Refresh the Jacobian next step if convergence was slow
+      if (rate > opts_.jacobian_rate) jacobian_stale_ = true;
+      break;
+    }
+
+    // Retry with a new Jacobian, restarting if the iteration diverged
+    if (jacobian_updates >= kMaxJacobianUpdates ||
+        (diverged && jacobian_updates > 0)) {
+      throw std::runtime_error(
+          "Newton iteration failed to converge in backward Euler step.");
+    }
+    jacobian_stale_ = true;
+    if (diverged) {
+      std::copy(y_.begin(), y_.end(), x_.begin());
+      rhs(t, x_, fx_);
+      ++stats_.n_rhs_evals;
+    }
+  }
+
+  t_ = t;
+  y_.swap(x_);
+  ++stats_.n_accepted;
+}
+
+}  // namespace vanta::ode
@@ -0,0 +1,166 @@
+#include "ode/symplectic.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include "ode/phase_timer.hpp"
+
+namespace vanta::ode {
+
+namespace {
+
+// Coefficients of a drift-kick splitting, applied alternately and scaled by
+// the step size. Kick-first methods have one more kick than drifts and end
+// on a kick at the final positions, whose acceleration the next step reuses.
+// Drift-first methods have one more drift than kicks
+struct Splitting {
+  std::span<const double> drift;
+  std::span<const double> kick;
+  bool kick_first;
+};
+
+// Velocity Verlet: half kick, drift, half kick
+constexpr std::array<double, 1> kVerletDrift = {1.0};
+constexpr std::array<double, 2> kVerletKick = {0.5, 0.5};
+
+// Leapfrog: half drift, kick, half drift
+constexpr std::array<double, 2> kLeapfrogDrift = {0.5, 0.5};
+constexpr std::array<double, 1> kLeapfrogKick = {1.0};
+
+// Yoshida: leapfrog steps of w1 h, w0 h, w1 h with adjacent drifts merged,
+// where w1 = 1 / (2 - 2^(1/3)) and w0 = 1 - 2 w1
+constexpr double kW1 = 1.3512071919596578;
+constexpr double kW0 = -1.7024143839193153;
+constexpr std::array<double, 4> kYoshidaDrift = {
+    0.5 * kW1, 0.5 * (kW0 + kW1), 0.5 * (kW0 + kW1), 0.5 * kW1};
+constexpr std::array<double, 3> kYoshidaKick = {kW1, kW0, kW1};
+
+// Integrate with the given splitting; the state is stored as [q, v]
+Solution Integrate(const Acceleration& a, double t0, double t1,
+                   const std::vector<double>& q0,
+                   const std::vector<double>& v0, double h,
+                   const OutputOptions& out, const Splitting& method) {
+  // Validate input arguments
+  if (h <= 0.0) {
+    throw std::invalid_argument("Step size h must be positive.");
+  }
+  if (t1 <= t0) {
+    throw std::invalid_argument("t1 must be greater than t0.");
+  }
+  if (q0.size() != v0.size()) {
+    throw std::invalid_argument(
+        "Initial positions and velocities must have the same size.");
+  }
+
+  // Work counters, with the stepper's acceleration calls timed
+  Stats stats;
+  PhaseTimer total_timer(stats.time.total);
+  auto accel = TimedCalls(a, stats.time.rhs);
+
+  // Compute the number of integration steps
+  const auto steps = static_cast<int>(std::ceil((t1 - t0) / h));
+  const std::size_t n = q0.size();
+
+  // State [q, v] with views of its halves, and the acceleration buffer
+  std::vector<double> y(2 * n);
+  std::copy(q0.begin(), q0.end(), y.begin());
+  std::copy(v0.begin(), v0.end(), y.begin() + n);
+  const std::span<double> q(y.data(), n);
+  const std::span<double> v(y.data() + n, n);
+  std::vector<double> acc(n);
+
+  // First-order form of the system, only needed for event detection
+  InPlaceRhs rhs = [&a, n](double t, std::span<const double> state,
+                           std::span<double> dydt) {
+    std::copy(state.begin() + n, state.end(), dydt.begin());
+    a(t, state.first(n), dydt.subspan(n));
+  };
+
+  // Initialise output recording
+  OutputRecorder recorder(out, 2 * n, steps, rhs);
+  recorder.Start(t0, y);
+
+  auto drift = [&](double c) {
+    for (std::size_t j = 0; j < n; ++j) q[j] += c * h * v[j];
+  };
+  auto kick = [&](double d) {
+    for (std::size_t j = 0; j < n; ++j) v[j] += d * h * acc[j];
+  };
+
+  // Kick-first methods start from the acceleration at the initial state
+  if (method.kick_first) {
+    accel(t0, q, acc);
+    stats.n_rhs_evals++;
+  }
+
+  // Perform time stepping, tracking the time of the current positions
+  double t = t0;
+  for (int i = 0; i < steps; ++i) {
+    double t_q = t;
+    if (method.kick_first) {
+      for (std::size_t k = 0; k < method.kick.size(); ++k) {
+        if (k > 0) {
+          accel(t_q, q, acc);
+          stats.n_rhs_evals++;
+        }
+        kick(method.kick[k]);
+        if (k < method.drift.size()) {
+          drift(method.drift[k]);
+          t_q += method.drift[k] * h;
+        }
+      }
+    } else {
+      for (std::size_t k = 0; k < method.drift.size(); ++k) {
+        drift(method.drift[k]);
+        t_q += method.drift[k] * h;
+        if (k < method.kick.size()) {
+          accel(t_q, q, acc);
+          stats.n_rhs_evals++;
+          kick(method.kick[k]);
+        }
+      }
+    }
+
+    // Advance time
+    t += h;
+    stats.n_accepted++;
+    if (recorder.Step(t, y)) break;
+  }
+
+  // Return the computed solution with work counters
+  Solution sol = recorder.Finish();
+  stats.n_rhs_evals += recorder.NumRhsEvals();
+  total_timer.Stop();
+  sol.stats = stats;
+  return sol;
+}
+
+}  // namespace
+
+Solution VelocityVerlet(const Acceleration& a, double t0, double t1,
+                        const std::vector<double>& q0,
+                        const std::vector<double>& v0, double h,
+                        const OutputOptions& out) {
+  return Integrate(a, t0, t1, q0, v0, h, out,
+                   {kVerletDrift, kVerletKick, true});
+}
+
+Solution Leapfrog(const Acceleration& a, double t0, double t1,
+                  const std::vector<double>& q0,
+                  const std::vector<double>& v0, double h,
+                  const OutputOptions& out) {
+  return Integrate(a, t0, t1, q0, v0, h, out,
+                   {kLeapfrogDrift, kLeapfrogKick, false});
+}
+
+Solution Yoshida4(const Acceleration& a, double t0, double t1,
+                  const std::vector<double>& q0,
+                  const std::vector<double>& v0, double h,
+                  const OutputOptions& out) {
+  return Integrate(a, t0, t1, q0, v0, h, out,
+                   {kYoshidaDrift, kYoshidaKick, false});
+}
+
+}  // namespace vanta::ode
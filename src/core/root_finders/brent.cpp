@@ -0,0 +1,90 @@
+#include "root_finders/brent.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace vanta::root_finders {
+
+double Brent(const std::function<double(double)>& f, double a, double b,
+             double xtol, int max_iter) {
+  double fa = f(a);
+  double fb = f(b);
+  if (fa == 0.0) return a;
+  if (fb == 0.0) return b;
+  if ((fa > 0.0) == (fb > 0.0)) {
+    throw std::invalid_argument("Root must be bracketed by a sign change.");
+  }
+
+  // b is the best estimate, c the opposite end of the bracket and a the
+  // previous estimate; d is the current step and e the one before it
+  double c = b;
+  double fc = fb;
+  double d = 0.0;
+  double e = 0.0;
+  constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+  for (int iter = 0; iter < max_iter; ++iter) {
+    // Keep the root bracketed between b and c
+    if ((fb > 0.0) == (fc > 0.0)) {
+      c = a;
+      fc = fa;
+      d = b - a;
+      e = d;
+    }
+    if (std::abs(fc) < std::abs(fb)) {
+      a = b;
+      b = c;
+      c = a;
+      fa = fb;
+      fb = fc;
+      fc = fa;
+    }
+
+    // Check convergence
+    const double tol = 2.0 * kEps * std::abs(b) + 0.5 * xtol;
+    const double m = 0.5 * (c - b);
+    if (std::abs(m) <= tol || fb == 0.0) return b;
+
+    if (std::abs(e) >= tol && std::abs(fa) > std::abs(fb)) {
+      // Secant or inverse quadratic interpolation step
+      const double s = fb / fa;
+      double p, q;
+      if (a == c) {
+        p = 2.0 * m * s;
+        q = 1.0 - s;
+      } else {
+        const double qa = fa / fc;
+        const double r = fb / fc;
+        p = s * (2.0 * m * qa * (qa - r) - (b - a) * (r - 1.0));
+        q = (qa - 1.0) * (r - 1.0) * (s - 1.0);
+      }
+      if (p > 0.0) q = -q;
+      p = std::abs(p);
+
+      // Accept the interpolation only if it stays well inside the bracket
+      if (2.0 * p < std::min(3.0 * m * q - std::abs(tol * q),
+                             std::abs(e * q))) {
+        e = d;
+        d = p / q;
+      } else {
+        d = m;
+        e = d;
+      }
+    } else {
+      // Bisection step
+      d = m;
+      e = d;
+    }
+
+    a = b;
+    fa = fb;
+    b += std::abs(d) > tol ? d : std::copysign(tol, m);
+    fb = f(b);
+  }
+
+  throw std::runtime_error("Brent's method failed to converge.");
+}
+
+}  // namespace vanta::root_finders
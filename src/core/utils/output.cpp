@@ -31,4 +31,31 @@ int ToCSV(const std::string& filename, const std::vector<double>& t,
   return 0;
 }
 
+int ToCSV(const std::string& filename, const std::vector<double>& t,
+          const std::vector<double>& y, std::size_t n_states) {
+  // Open output file
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    return 1;
+  }
+
+  // Write CSV header: time column followed by solution components
+  file << "t";
+  for (size_t j = 0; j < n_states; ++j) {
+    file << ",y" << j;
+  }
+  file << '\n';
+
+  // Write data rows
+  for (size_t i = 0; i < t.size(); ++i) {
+    file << t[i];
+    for (size_t j = 0; j < n_states; ++j) {
+      file << "," << y[i * n_states + j];
+    }
+    file << '\n';
+  }
+
+  return 0;
+}
+
 }  // namespace vanta::utils
@@ -0,0 +1,73 @@
+import math
+from vanta_core_py.ode import bdf
+from vanta_core_py.ode import BDFOptions
+from vanta_core_py.ode import Solution
+from vanta_core_py.ode import timing_enabled
+
+
+# Helpers
+def decay(t, y):
+    """dy/dt = -y  →  exact: y(t) = exp(-t)"""
+    return [-y[0]]
+
+
+def robertson(t, y):
+    """Robertson chemical kinetics, a classic stiff problem"""
+    return [
+        -0.04 * y[0] + 1e4 * y[1] * y[2],
+        0.04 * y[0] - 1e4 * y[1] * y[2] - 3e7 * y[1] ** 2,
+        3e7 * y[1] ** 2,
+    ]
+
+
+class TestBDFOutputStructure:
+    def test_returns_solution(self):
+        sol = bdf(f=decay, t0=0.0, t1=1.0, y0=[1.0])
+        assert isinstance(sol, Solution)
+
+    def test_t_and_y_same_length(self):
+        sol = bdf(f=decay, t0=0.0, t1=1.0, y0=[1.0])
+        assert len(sol.t) == len(sol.y)
+
+    def test_ends_exactly_at_t1(self):
+        sol = bdf(f=decay, t0=0.0, t1=3.7, y0=[1.0])
+        assert sol.t[-1] == 3.7
+
+
+class TestBDFCorrectness:
+    def test_decay(self):
+        opts = BDFOptions()
+        opts.rtol = 1e-8
+        opts.atol = 1e-10
+        sol = bdf(f=decay, t0=0.0, t1=5.0, y0=[1.0], opts=opts)
+        assert math.isclose(sol.y[-1][0], math.exp(-5.0), abs_tol=1e-6)
+
+    def test_robertson(self):
+        opts = BDFOptions()
+        opts.atol = 1e-10
+        sol = bdf(f=robertson, t0=0.0, t1=40.0, y0=[1.0, 0.0, 0.0],
+                  opts=opts)
+        assert math.isclose(sol.y[-1][0], 0.7158271, abs_tol=1e-5)
+        assert math.isclose(sol.y[-1][2], 0.2841637, abs_tol=1e-5)
+
+
+class TestBDFStats:
+    def test_jacobian_is_reused(self):
+        opts = BDFOptions()
+        opts.atol = 1e-10
+        sol = bdf(f=robertson, t0=0.0, t1=40.0, y0=[1.0, 0.0, 0.0],
+                  opts=opts)
+        assert sol.stats.n_jacobian_evals < sol.stats.n_accepted
+
+    def test_newton_iterations_and_phase_times(self):
+        sol = bdf(f=robertson, t0=0.0, t1=40.0, y0=[1.0, 0.0, 0.0])
+        assert sol.stats.n_newton_iters >= sol.stats.n_accepted
+        time = sol.stats.time
+        if timing_enabled:
+            assert time.total > 0.0
+        else:
+            assert time.total == 0.0
+        assert time.total >= time.rhs + time.jacobian + time.linear_solve
+        assert math.isclose(
+            time.other,
+            time.total - time.rhs - time.jacobian - time.linear_solve)
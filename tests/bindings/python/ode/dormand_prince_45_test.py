@@ -0,0 +1,76 @@
+import math
+from vanta_core_py.ode import dormand_prince_45
+from vanta_core_py.ode import DP45Options
+from vanta_core_py.ode import Solution
+
+
+# Helpers
+def decay(t, y):
+    """dy/dt = -y  →  exact: y(t) = exp(-t)"""
+    return [-y[0]]
+
+
+def harmonic(t, y):
+    """y'' + y = 0  →  state: [position, velocity]"""
+    return [y[1], -y[0]]
+
+
+def tight_opts():
+    opts = DP45Options()
+    opts.rtol = 1e-10
+    opts.atol = 1e-12
+    return opts
+
+
+class TestDormandPrince45OutputStructure:
+    def test_returns_solution(self):
+        sol = dormand_prince_45(f=decay, t0=0.0, t1=1.0, y0=[1.0])
+        assert isinstance(sol, Solution)
+
+    def test_t_and_y_same_length(self):
+        sol = dormand_prince_45(f=decay, t0=0.0, t1=1.0, y0=[1.0])
+        assert len(sol.t) == len(sol.y)
+
+    def test_state_dimension_preserved(self):
+        sol = dormand_prince_45(f=harmonic, t0=0.0, t1=1.0, y0=[1.0, 0.0])
+        assert all(len(row) == 2 for row in sol.y)
+
+
+class TestDormandPrince45TimeGrid:
+    def test_starts_at_t0(self):
+        sol = dormand_prince_45(f=decay, t0=2.0, t1=3.0, y0=[1.0])
+        assert math.isclose(sol.t[0], 2.0)
+
+    def test_ends_exactly_at_t1(self):
+        sol = dormand_prince_45(f=decay, t0=0.0, t1=3.7, y0=[1.0])
+        assert sol.t[-1] == 3.7
+
+    def test_time_is_monotone_increasing(self):
+        sol = dormand_prince_45(f=decay, t0=0.0, t1=2.0, y0=[1.0])
+        assert all(a < b for a, b in zip(sol.t, sol.t[1:]))
+
+
+class TestDormandPrince45Correctness:
+    def test_decay_high_accuracy(self):
+        sol = dormand_prince_45(f=decay, t0=0.0, t1=5.0, y0=[1.0],
+                                opts=tight_opts())
+        assert math.isclose(sol.y[-1][0], math.exp(-5.0), rel_tol=1e-8)
+
+    def test_harmonic_oscillator(self):
+        sol = dormand_prince_45(f=harmonic, t0=0.0, t1=10.0, y0=[1.0, 0.0],
+                                opts=tight_opts())
+        assert math.isclose(sol.y[-1][0], math.cos(10.0), abs_tol=1e-7)
+        assert math.isclose(sol.y[-1][1], -math.sin(10.0), abs_tol=1e-7)
+
+
+class TestDormandPrince45Stats:
+    def test_accepted_steps_match_output(self):
+        sol = dormand_prince_45(f=decay, t0=0.0, t1=5.0, y0=[1.0])
+        assert sol.stats.n_accepted == len(sol) - 1
+
+    def test_oversized_initial_step_is_rejected(self):
+        opts = DP45Options()
+        opts.h0 = 1.0
+        sol = dormand_prince_45(f=lambda t, y: [-50.0 * y[0]], t0=0.0,
+                                t1=1.0, y0=[1.0], opts=opts)
+        assert sol.stats.n_rejected > 0
@@ -0,0 +1,43 @@
+import math
+from vanta_core_py.ode import rosenbrock
+from vanta_core_py.ode import RosenbrockOptions
+from vanta_core_py.ode import Solution
+
+
+# Helpers
+def decay(t, y):
+    """dy/dt = -y  →  exact: y(t) = exp(-t)"""
+    return [-y[0]]
+
+
+def stiff_cosine(t, y):
+    """dy/dt = -1000 (y - cos t) - sin t  →  exact: y(t) = cos(t)"""
+    return [-1000.0 * (y[0] - math.cos(t)) - math.sin(t)]
+
+
+class TestRosenbrockOutputStructure:
+    def test_returns_solution(self):
+        sol = rosenbrock(f=decay, t0=0.0, t1=1.0, y0=[1.0])
+        assert isinstance(sol, Solution)
+
+    def test_ends_exactly_at_t1(self):
+        sol = rosenbrock(f=decay, t0=0.0, t1=3.7, y0=[1.0])
+        assert sol.t[-1] == 3.7
+
+
+class TestRosenbrockCorrectness:
+    def test_decay(self):
+        opts = RosenbrockOptions()
+        opts.rtol = 1e-8
+        opts.atol = 1e-10
+        sol = rosenbrock(f=decay, t0=0.0, t1=5.0, y0=[1.0], opts=opts)
+        assert math.isclose(sol.y[-1][0], math.exp(-5.0), abs_tol=1e-6)
+
+    def test_stiff_cosine(self):
+        opts = RosenbrockOptions()
+        opts.rtol = 1e-4
+        opts.atol = 1e-6
+        sol = rosenbrock(f=stiff_cosine, t0=0.0, t1=10.0, y0=[1.0],
+                         opts=opts)
+        assert math.isclose(sol.y[-1][0], math.cos(10.0), abs_tol=1e-4)
+        assert sol.stats.n_accepted < 1000
@@ -1,4 +1,6 @@
 import math
+
+import pytest
 from vanta_core_py.ode import Solution
 
 
@@ -71,3 +73,39 @@ class TestSolutionYProperty:
         for i in range(5):
             assert math.isclose(sol.y[i][0], float(i))
             assert math.isclose(sol.y[i][1], float(-i))
+
+
+class TestSolutionInterpolation:
+    def test_at_reproduces_stored_points(self):
+        sol = Solution()
+        sol.t = [0.0, 1.0, 2.0]
+        sol.y = [[0.0, 1.0], [10.0, 11.0], [20.0, 21.0]]
+        for i, t in enumerate([0.0, 1.0, 2.0]):
+            y = sol.at(t)
+            assert math.isclose(y[0], 10.0 * i)
+            assert math.isclose(y[1], 10.0 * i + 1.0)
+
+    def test_at_is_exact_for_quadratics(self):
+        times = [0.0, 0.3, 0.5, 1.2, 2.0]
+        sol = Solution()
+        sol.t = times
+        sol.y = [[t * t] for t in times]
+        for t in [0.1, 0.45, 1.7]:
+            assert math.isclose(sol.at(t)[0], t * t, rel_tol=1e-12)
+
+    def test_sample_returns_solution(self):
+        sol = Solution()
+        sol.t = [0.0, 1.0, 2.0]
+        sol.y = [[0.0], [1.0], [2.0]]
+        samples = sol.sample([1.5, 0.25])
+        assert len(samples) == 2
+        assert list(samples.t) == [1.5, 0.25]
+        assert math.isclose(samples.y[0][0], 1.5)
+        assert math.isclose(samples.y[1][0], 0.25)
+
+    def test_at_outside_interval_raises(self):
+        sol = Solution()
+        sol.t = [0.0, 1.0]
+        sol.y = [[0.0], [1.0]]
+        with pytest.raises(ValueError):
+            sol.at(1.5)
@@ -0,0 +1,51 @@
+import math
+from vanta_core_py.ode import leapfrog
+from vanta_core_py.ode import velocity_verlet
+from vanta_core_py.ode import yoshida_4
+from vanta_core_py.ode import Solution
+
+
+# Helpers
+def spring(t, q):
+    """q'' = -q  →  exact: q(t) = cos t for q(0) = 1, v(0) = 0"""
+    return [-q[0]]
+
+
+def energy(row):
+    return 0.5 * (row[0] ** 2 + row[1] ** 2)
+
+
+SOLVERS = [velocity_verlet, leapfrog, yoshida_4]
+
+
+class TestSymplecticOutputStructure:
+    def test_returns_solution(self):
+        for solver in SOLVERS:
+            sol = solver(a=spring, t0=0.0, t1=1.0, q0=[1.0], v0=[0.0], h=0.1)
+            assert isinstance(sol, Solution)
+
+    def test_rows_hold_positions_then_velocities(self):
+        sol = velocity_verlet(a=spring, t0=0.0, t1=1.0, q0=[1.0], v0=[0.0],
+                              h=0.1)
+        assert sol.y.shape == (11, 2)
+        assert sol.y[0][0] == 1.0
+        assert sol.y[0][1] == 0.0
+
+
+class TestSymplecticCorrectness:
+    def test_oscillator(self):
+        for solver in SOLVERS:
+            sol = solver(a=spring, t0=0.0, t1=1.0, q0=[1.0], v0=[0.0],
+                         h=0.001)
+            assert math.isclose(sol.y[-1][0], math.cos(1.0), abs_tol=1e-6)
+            assert math.isclose(sol.y[-1][1], -math.sin(1.0), abs_tol=1e-6)
+
+    def test_energy_bounded(self):
+        for solver in SOLVERS:
+            sol = solver(a=spring, t0=0.0, t1=500.0, q0=[1.0], v0=[0.0],
+                         h=0.5)
+            assert all(abs(energy(row) - 0.5) < 0.1 for row in sol.y)
+
+    def test_one_evaluation_per_step(self):
+        sol = leapfrog(a=spring, t0=0.0, t1=1.0, q0=[1.0], v0=[0.0], h=0.1)
+        assert sol.stats.n_rhs_evals == sol.stats.n_accepted
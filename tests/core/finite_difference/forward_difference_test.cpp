@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <span>
+#include <vector>
 
 TEST(ForwardDifferenceTest, IdentityFunction) {
   auto f = [](const std::vector<double>& x) { return x; };
@@ -78,3 +80,136 @@ TEST(ForwardDifferenceTest, SmallerStepImprovesAccuracy) {
 
   EXPECT_LT(error2, error1);
 }
+
+TEST(ForwardDifferenceTest, InPlaceMatchesAnalyticJacobian) {
+  auto f = [](std::span<const double> x, std::span<double> fx) {
+    fx[0] = x[0] * x[0] + x[1];
+    fx[1] = std::sin(x[1]);
+    fx[2] = 3.0 * x[0];
+  };
+
+  std::vector<double> x = {1e3, 0.5};
+  std::vector<double> fx(3);
+  f(x, fx);
+
+  // Row-major 3 x 2 Jacobian
+  std::vector<double> J(6);
+  vanta::finite_difference::ForwardDifference(f, x, fx, J);
+
+  EXPECT_NEAR(J[0], 2.0 * x[0], 1e-4 * x[0]);
+  EXPECT_NEAR(J[1], 1.0, 1e-6);
+  EXPECT_NEAR(J[2], 0.0, 1e-12);
+  EXPECT_NEAR(J[3], std::cos(x[1]), 1e-6);
+  EXPECT_NEAR(J[4], 3.0, 1e-5);
+  EXPECT_NEAR(J[5], 0.0, 1e-12);
+}
+
+TEST(ForwardDifferenceTest, ColourColumnsOfTridiagonal) {
+  auto pattern = vanta::linear_solvers::BandedPattern(10, 1, 1);
+
+  auto colours = vanta::finite_difference::ColourColumns(pattern);
+
+  // Columns three apart never share a row
+  for (size_t j = 0; j < 10; ++j) EXPECT_EQ(colours[j], j % 3);
+}
+
+TEST(ForwardDifferenceTest, CompressedMatchesAnalyticJacobian) {
+  // Discrete nonlinear diffusion f_i = x_{i-1} - 2 x_i^2 + x_{i+1}
+  const size_t n = 20;
+  auto f = [n](std::span<const double> x, std::span<double> fx) {
+    for (size_t i = 0; i < n; ++i) {
+      fx[i] = -2.0 * x[i] * x[i];
+      if (i > 0) fx[i] += x[i - 1];
+      if (i + 1 < n) fx[i] += x[i + 1];
+    }
+  };
+
+  std::vector<double> x(n);
+  for (size_t i = 0; i < n; ++i) x[i] = 0.1 * i;
+  std::vector<double> fx(n);
+  f(x, fx);
+
+  auto pattern = vanta::linear_solvers::BandedPattern(n, 1, 1);
+  auto colours = vanta::finite_difference::ColourColumns(pattern);
+  std::vector<double> values(pattern.NonZeros());
+  vanta::finite_difference::ForwardDifference(f, x, fx, pattern, colours,
+                                              values);
+
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t p = pattern.row_ptr[i]; p < pattern.row_ptr[i + 1]; ++p) {
+      const double exact = pattern.col_idx[p] == i ? -4.0 * x[i] : 1.0;
+      EXPECT_NEAR(values[p], exact, 1e-6);
+    }
+  }
+}
+
+TEST(ForwardDifferenceTest, BatchedMatchesInPlaceInOneCall) {
+  auto f = [](std::span<const double> x, std::span<double> fx) {
+    fx[0] = x[0] * x[0] + x[1];
+    fx[1] = std::sin(x[1]) * x[2];
+    fx[2] = 3.0 * x[0] - x[2];
+  };
+  int calls = 0;
+  auto batch = [&](std::span<const double> x, std::span<double> fx,
+                   size_t n_points) {
+    ++calls;
+    for (size_t p = 0; p < n_points; ++p) {
+      std::vector<double> x_p(3), fx_p(3);
+      for (size_t j = 0; j < 3; ++j) x_p[j] = x[j * n_points + p];
+      f(x_p, fx_p);
+      for (size_t j = 0; j < 3; ++j) fx[j * n_points + p] = fx_p[j];
+    }
+  };
+
+  std::vector<double> x = {1e3, 0.5, -2.0};
+  std::vector<double> fx(3);
+  f(x, fx);
+
+  std::vector<double> J(9), J_batch(9);
+  vanta::finite_difference::ForwardDifference(f, x, fx, J);
+  vanta::finite_difference::BatchForwardDifference(batch, x, fx, J_batch);
+
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(J_batch, J);
+}
+
+TEST(ForwardDifferenceTest, CompressedBatchedMatchesInPlaceInOneCall) {
+  // Discrete nonlinear diffusion f_i = x_{i-1} - 2 x_i^2 + x_{i+1}, written
+  // once for a whole batch of points
+  const size_t n = 20;
+  int calls = 0;
+  auto batch = [&](std::span<const double> x, std::span<double> fx,
+                   size_t n_points) {
+    ++calls;
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t p = 0; p < n_points; ++p) {
+        const double x_i = x[i * n_points + p];
+        double value = -2.0 * x_i * x_i;
+        if (i > 0) value += x[(i - 1) * n_points + p];
+        if (i + 1 < n) value += x[(i + 1) * n_points + p];
+        fx[i * n_points + p] = value;
+      }
+    }
+  };
+  auto f = [&](std::span<const double> x, std::span<double> fx) {
+    batch(x, fx, 1);
+  };
+
+  std::vector<double> x(n);
+  for (size_t i = 0; i < n; ++i) x[i] = 0.1 * i;
+  std::vector<double> fx(n);
+  f(x, fx);
+
+  auto pattern = vanta::linear_solvers::BandedPattern(n, 1, 1);
+  auto colours = vanta::finite_difference::ColourColumns(pattern);
+  std::vector<double> values(pattern.NonZeros());
+  std::vector<double> batch_values(pattern.NonZeros());
+  vanta::finite_difference::ForwardDifference(f, x, fx, pattern, colours,
+                                              values);
+  calls = 0;
+  vanta::finite_difference::BatchForwardDifference(batch, x, fx, pattern,
+                                                   colours, batch_values);
+
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(batch_values, values);
+}
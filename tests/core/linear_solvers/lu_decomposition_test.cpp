@@ -0,0 +1,74 @@
+#include "linear_solvers/lu_decomposition.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr double kLUTolerance = 1e-12;
+
+}  // namespace
+
+TEST(LUDecompositionTest, Solves3x3System) {
+  // Known solution: x = 2, y = 3, z = -1
+  std::vector<double> A = {2, 1, -1, -3, -1, 2, -2, 1, 2};
+  std::vector<double> b = {8, -11, -3};
+
+  vanta::linear_solvers::LUFactors lu;
+  vanta::linear_solvers::LUFactorise(A, 3, lu);
+  vanta::linear_solvers::LUSolve(lu, b);
+
+  EXPECT_NEAR(b[0], 2.0, kLUTolerance);
+  EXPECT_NEAR(b[1], 3.0, kLUTolerance);
+  EXPECT_NEAR(b[2], -1.0, kLUTolerance);
+}
+
+TEST(LUDecompositionTest, HandlesPartialPivoting) {
+  // Requires row swap due to small pivot
+  std::vector<double> A = {1e-10, 1.0, 1.0, 1.0};
+  std::vector<double> b = {1.0, 2.0};
+
+  vanta::linear_solvers::LUFactors lu;
+  vanta::linear_solvers::LUFactorise(A, 2, lu);
+  vanta::linear_solvers::LUSolve(lu, b);
+
+  EXPECT_NEAR(b[0], 1.0, 1e-9);
+  EXPECT_NEAR(b[1], 1.0, 1e-9);
+}
+
+TEST(LUDecompositionTest, FactorsReusedForManyRightHandSides) {
+  std::vector<double> A = {1, 2, 3, 4, 2, 5, 2, 1, 3, 1, 3, 2, 4, 2, 1, 4};
+
+  vanta::linear_solvers::LUFactors lu;
+  vanta::linear_solvers::LUFactorise(A, 4, lu);
+
+  // Validate A * x = b for each unit vector
+  for (std::size_t k = 0; k < 4; ++k) {
+    std::vector<double> x(4, 0.0);
+    x[k] = 1.0;
+    vanta::linear_solvers::LUSolve(lu, x);
+    for (std::size_t i = 0; i < 4; ++i) {
+      double sum = 0.0;
+      for (std::size_t j = 0; j < 4; ++j) sum += A[i * 4 + j] * x[j];
+      EXPECT_NEAR(sum, i == k ? 1.0 : 0.0, kLUTolerance);
+    }
+  }
+}
+
+TEST(LUDecompositionTest, SingularMatrixThrows) {
+  std::vector<double> A = {1.0, 2.0, 2.0, 4.0};
+
+  vanta::linear_solvers::LUFactors lu;
+  EXPECT_THROW(vanta::linear_solvers::LUFactorise(A, 2, lu),
+               std::runtime_error);
+}
+
+TEST(LUDecompositionTest, WrongSizeThrows) {
+  std::vector<double> A = {1.0, 2.0, 3.0};
+
+  vanta::linear_solvers::LUFactors lu;
+  EXPECT_THROW(vanta::linear_solvers::LUFactorise(A, 2, lu),
+               std::invalid_argument);
+}
@@ -0,0 +1,157 @@
+#include "linear_solvers/sparse_lu.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "linear_solvers/lu_decomposition.hpp"
+#include "linear_solvers/sparsity_pattern.hpp"
+
+namespace {
+
+constexpr double kSparseTolerance = 1e-12;
+
+// Expand pattern values to a dense row-major matrix
+std::vector<double> ToDense(const vanta::linear_solvers::SparsityPattern& p,
+                            const std::vector<double>& values) {
+  std::vector<double> dense(p.n * p.n, 0.0);
+  for (std::size_t i = 0; i < p.n; ++i) {
+    for (std::size_t k = p.row_ptr[i]; k < p.row_ptr[i + 1]; ++k) {
+      dense[i * p.n + p.col_idx[k]] = values[k];
+    }
+  }
+  return dense;
+}
+
+// Solve with the sparse factors and compare with dense LU
+void ExpectMatchesDense(const vanta::linear_solvers::SparsityPattern& pattern,
+                        const std::vector<double>& values) {
+  vanta::linear_solvers::SparseLUFactors sparse;
+  vanta::linear_solvers::SparseLUAnalyse(pattern, sparse);
+  vanta::linear_solvers::SparseLUFactorise(values, sparse);
+
+  vanta::linear_solvers::LUFactors dense;
+  vanta::linear_solvers::LUFactorise(ToDense(pattern, values), pattern.n,
+                                     dense);
+
+  std::vector<double> x(pattern.n);
+  for (std::size_t i = 0; i < pattern.n; ++i) x[i] = 1.0 + 0.5 * i;
+  std::vector<double> y = x;
+  vanta::linear_solvers::SparseLUSolve(sparse, x);
+  vanta::linear_solvers::LUSolve(dense, y);
+
+  for (std::size_t i = 0; i < pattern.n; ++i) {
+    EXPECT_NEAR(x[i], y[i], kSparseTolerance * std::max(1.0, std::abs(y[i])));
+  }
+}
+
+}  // namespace
+
+TEST(SparseLUTest, BandedPatternStructure) {
+  auto pattern = vanta::linear_solvers::BandedPattern(4, 1, 2);
+
+  EXPECT_EQ(pattern.row_ptr, (std::vector<std::size_t>{0, 3, 7, 10, 12}));
+  EXPECT_EQ(pattern.col_idx, (std::vector<std::size_t>{0, 1, 2, 0, 1, 2, 3, 1,
+                                                       2, 3, 2, 3}));
+}
+
+TEST(SparseLUTest, TridiagonalHasNoFillIn) {
+  const std::size_t n = 50;
+  auto pattern = vanta::linear_solvers::BandedPattern(n, 1, 1);
+  std::vector<double> values(pattern.NonZeros());
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t k = pattern.row_ptr[i]; k < pattern.row_ptr[i + 1]; ++k) {
+      values[k] = pattern.col_idx[k] == i ? 4.0 : -1.0 - 0.01 * k;
+    }
+  }
+
+  vanta::linear_solvers::SparseLUFactors factors;
+  vanta::linear_solvers::SparseLUAnalyse(pattern, factors);
+  EXPECT_EQ(factors.col_idx.size(), pattern.NonZeros());
+
+  ExpectMatchesDense(pattern, values);
+}
+
+TEST(SparseLUTest, ArrowMatrixIsReordered) {
+  // Dense first row and column would fill in the whole matrix if eliminated
+  // first, so the ordering moves them last
+  vanta::linear_solvers::SparsityPattern pattern;
+  pattern.n = 4;
+  pattern.row_ptr = {0, 4, 6, 8, 10};
+  pattern.col_idx = {0, 1, 2, 3, 0, 1, 0, 2, 0, 3};
+  std::vector<double> values = {5, 1, 1, 1, 1, 4, 1, 3, 1, 6};
+
+  vanta::linear_solvers::SparseLUFactors factors;
+  vanta::linear_solvers::SparseLUAnalyse(pattern, factors);
+  EXPECT_EQ(factors.col_idx.size(), pattern.NonZeros());
+
+  ExpectMatchesDense(pattern, values);
+}
+
+TEST(SparseLUTest, LaplacianFillInStaysBelowBand) {
+  // Five-point Laplacian on an m x m grid. Its natural ordering has
+  // bandwidth m and fills in nearly all n (2m + 1) entries of the band.
+  const std::size_t m = 30;
+  const std::size_t n = m * m;
+  vanta::linear_solvers::SparsityPattern pattern;
+  pattern.n = n;
+  pattern.row_ptr.assign(1, 0);
+  std::vector<double> values;
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::size_t x = i % m;
+    auto add = [&](std::size_t j, double value) {
+      pattern.col_idx.push_back(j);
+      values.push_back(value);
+    };
+    if (i >= m) add(i - m, -1.0);
+    if (x > 0) add(i - 1, -1.0);
+    add(i, 4.5);
+    if (x + 1 < m) add(i + 1, -1.0);
+    if (i + m < n) add(i + m, -1.0);
+    pattern.row_ptr.push_back(pattern.col_idx.size());
+  }
+
+  vanta::linear_solvers::SparseLUFactors factors;
+  vanta::linear_solvers::SparseLUAnalyse(pattern, factors);
+  EXPECT_LT(factors.col_idx.size(), n * (2 * m + 1) / 2);
+
+  ExpectMatchesDense(pattern, values);
+}
+
+TEST(SparseLUTest, MissingDiagonalIsAdded) {
+  // Off-diagonal only rows get a structural diagonal
+  vanta::linear_solvers::SparsityPattern pattern;
+  pattern.n = 2;
+  pattern.row_ptr = {0, 2, 3};
+  pattern.col_idx = {0, 1, 0};
+
+  vanta::linear_solvers::SparseLUFactors factors;
+  vanta::linear_solvers::SparseLUAnalyse(pattern, factors);
+  EXPECT_EQ(factors.col_idx.size(), 4);
+
+  // Without pivoting the zero diagonal cannot be eliminated
+  EXPECT_NO_THROW(vanta::linear_solvers::SparseLUFactorise(
+      std::vector<double>{1.0, 2.0, 3.0}, factors));
+  std::vector<double> b = {3.0, 3.0};
+  vanta::linear_solvers::SparseLUSolve(factors, b);
+  EXPECT_NEAR(b[0], 1.0, kSparseTolerance);
+  EXPECT_NEAR(b[1], 1.0, kSparseTolerance);
+
+  EXPECT_THROW(vanta::linear_solvers::SparseLUFactorise(
+                   std::vector<double>{0.0, 2.0, 3.0}, factors),
+               std::runtime_error);
+}
+
+TEST(SparseLUTest, MalformedPatternThrows) {
+  vanta::linear_solvers::SparsityPattern pattern;
+  pattern.n = 2;
+  pattern.row_ptr = {0, 2, 3};
+  pattern.col_idx = {1, 0, 1};
+
+  vanta::linear_solvers::SparseLUFactors factors;
+  EXPECT_THROW(vanta::linear_solvers::SparseLUAnalyse(pattern, factors),
+               std::invalid_argument);
+}
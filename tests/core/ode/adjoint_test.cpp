@@ -0,0 +1,274 @@
+#include "ode/adjoint.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "lotka_volterra.hpp"
+#include "ode/euler_backward.hpp"
+#include "ode/sensitivity.hpp"
+
+class AdjointTest : public LotkaVolterraTest {
+ protected:
+  // L = y_0^2 + 3 y_1 at the final time
+  static void Loss(std::span<const double> y, std::span<double> dldy) {
+    dldy[0] = 2.0 * y[0];
+    dldy[1] = 3.0;
+  }
+
+  // Loss gradient from forward sensitivities, dL/dp = (dL/dy)^T S
+  static std::vector<double> ForwardGradient() {
+    vanta::ode::SensitivityOptions opts;
+    opts.jacobian_y = JacobianY;
+    opts.jacobian_p = JacobianP;
+    vanta::ode::SensitivitySolution result =
+        vanta::ode::ForwardSensitivityRungeKutta4(LotkaVolterra, 0.0, kT1,
+                                                  kY0, kP, kH, opts);
+    const std::size_t last = result.solution.NumSteps() - 1;
+    std::span<const double> s = result.Sensitivity(last);
+    std::vector<double> dldy(2);
+    Loss(result.solution.Back(), dldy);
+    std::vector<double> grad(kP.size(), 0.0);
+    for (std::size_t k = 0; k < kP.size(); ++k) {
+      for (std::size_t j = 0; j < 2; ++j) {
+        grad[k] += dldy[j] * s[j * kP.size() + k];
+      }
+    }
+    return grad;
+  }
+};
+
+TEST_F(AdjointTest, RungeKutta4MatchesForwardSensitivities) {
+  vanta::ode::AdjointSolution result = vanta::ode::AdjointRungeKutta4(
+      LotkaVolterra, JacobianY, JacobianP, Loss, 0.0, kT1, kY0, kP, kH);
+
+  // Gradient with respect to the parameters
+  const std::vector<double> expected = ForwardGradient();
+  ASSERT_EQ(result.grad_p.size(), kP.size());
+  for (std::size_t k = 0; k < kP.size(); ++k) {
+    EXPECT_NEAR(result.grad_p[k], expected[k],
+                1e-10 * std::max(std::abs(expected[k]), 1.0));
+  }
+
+  // Gradient with respect to the initial state, from central differences
+  // of whole solves
+  auto loss_at = [](const std::vector<double>& y0) {
+    vanta::ode::AdjointSolution r = vanta::ode::AdjointRungeKutta4(
+        LotkaVolterra, JacobianY, JacobianP, Loss, 0.0, kT1, y0, kP, kH);
+    return r.y1[0] * r.y1[0] + 3.0 * r.y1[1];
+  };
+  const double eps = 1e-6;
+  for (std::size_t j = 0; j < 2; ++j) {
+    std::vector<double> y_plus = kY0;
+    std::vector<double> y_minus = kY0;
+    y_plus[j] += eps;
+    y_minus[j] -= eps;
+    const double fd = (loss_at(y_plus) - loss_at(y_minus)) / (2.0 * eps);
+    EXPECT_NEAR(result.grad_y0[j], fd, 1e-6 * std::max(std::abs(fd), 1.0));
+  }
+
+  // Forward steps and backward steps each evaluate f four times, and the
+  // default budget recomputes every step at most once
+  EXPECT_EQ(result.stats.n_accepted, 100u);
+  EXPECT_EQ(result.stats.n_rhs_evals, 4u * (result.n_forward_steps + 100u));
+  EXPECT_LE(result.n_forward_steps, 2u * 100u);
+  EXPECT_EQ(result.stats.n_jacobian_evals, 8u * 100u);
+}
+
+TEST_F(AdjointTest, CheckpointBudgetDoesNotChangeGradient) {
+  vanta::ode::AdjointOptions opts;
+  std::vector<vanta::ode::AdjointSolution> results;
+  for (std::size_t checkpoints : {0, 1, 7, 1000}) {
+    opts.checkpoints = checkpoints;
+    results.push_back(vanta::ode::AdjointRungeKutta4(
+        LotkaVolterra, JacobianY, JacobianP, Loss, 0.0, kT1, kY0, kP, kH,
+        opts));
+  }
+
+  // The default is twice the square root of the number of steps, and a
+  // budget larger than the number of steps keeps every state
+  EXPECT_EQ(results[0].n_checkpoints, 20u);
+  EXPECT_EQ(results[1].n_checkpoints, 1u);
+  EXPECT_EQ(results[2].n_checkpoints, 7u);
+  EXPECT_EQ(results[3].n_checkpoints, 100u);
+
+  for (const vanta::ode::AdjointSolution& r : results) {
+    EXPECT_EQ(r.y1, results[0].y1);
+    EXPECT_EQ(r.grad_p, results[0].grad_p);
+    EXPECT_EQ(r.grad_y0, results[0].grad_y0);
+  }
+}
+
+TEST_F(AdjointTest, RecomputationIsMinimalForBudget) {
+  // binom(n, k), exact for the small values used here
+  auto binomial = [](std::size_t n, std::size_t k) {
+    if (k > n) return std::size_t{0};
+    std::size_t value = 1;
+    for (std::size_t i = 1; i <= k; ++i) value = value * (n - k + i) / i;
+    return value;
+  };
+
+  // With c checkpoints, N steps and r the smallest integer with
+  // binom(c + r, r) >= N, binomial checkpointing takes
+  // r N - binom(c + r, c + 1) forward steps (Griewank and Walther)
+  auto minimal_steps = [&](std::size_t c, std::size_t steps) {
+    std::size_t r = 1;
+    while (binomial(c + r, r) < steps) ++r;
+    return r * steps - binomial(c + r, c + 1);
+  };
+
+  vanta::ode::AdjointOptions opts;
+  for (std::size_t checkpoints : {1, 2, 3, 7, 20, 99, 100}) {
+    opts.checkpoints = checkpoints;
+    vanta::ode::AdjointSolution result = vanta::ode::AdjointRungeKutta4(
+        LotkaVolterra, JacobianY, JacobianP, Loss, 0.0, kT1, kY0, kP, kH,
+        opts);
+    EXPECT_EQ(result.n_checkpoints, checkpoints);
+    EXPECT_EQ(result.n_forward_steps, minimal_steps(checkpoints, 100))
+        << checkpoints << " checkpoints";
+  }
+}
+
+TEST_F(AdjointTest, LongRunStaysWithinBudget) {
+  // 10^4 steps held in 10 checkpoints, with each step advanced at most
+  // r = 7 times since binom(17, 7) >= 10^4
+  vanta::ode::AdjointOptions opts;
+  opts.checkpoints = 10;
+  vanta::ode::AdjointSolution budgeted = vanta::ode::AdjointRungeKutta4(
+      LotkaVolterra, JacobianY, JacobianP, Loss, 0.0, 500.0, kY0, kP, kH,
+      opts);
+  EXPECT_EQ(budgeted.stats.n_accepted, 10000u);
+  EXPECT_EQ(budgeted.n_checkpoints, 10u);
+  EXPECT_LE(budgeted.n_forward_steps, 7u * 10000u);
+
+  opts.checkpoints = 10000;
+  vanta::ode::AdjointSolution stored = vanta::ode::AdjointRungeKutta4(
+      LotkaVolterra, JacobianY, JacobianP, Loss, 0.0, 500.0, kY0, kP, kH,
+      opts);
+  EXPECT_EQ(stored.n_forward_steps, 9999u);
+  EXPECT_EQ(budgeted.grad_p, stored.grad_p);
+  EXPECT_EQ(budgeted.grad_y0, stored.grad_y0);
+}
+
+TEST_F(AdjointTest, CostIndependentOfParameterCount) {
+  // y' = -p_0 y + sum_k p_k sin(k t), with many forcing amplitudes
+  auto forced = [](double t, std::span<const double> y,
+                   std::span<const double> p, std::span<double> dydt) {
+    dydt[0] = -p[0] * y[0];
+    for (std::size_t k = 1; k < p.size(); ++k) {
+      dydt[0] += p[k] * std::sin(static_cast<double>(k) * t);
+    }
+  };
+  auto jac_y = [](double t [[maybe_unused]],
+                  std::span<const double> y [[maybe_unused]],
+                  std::span<const double> p, std::span<double> jac) {
+    jac[0] = -p[0];
+  };
+  auto jac_p = [](double t, std::span<const double> y,
+                  std::span<const double> p, std::span<double> jac) {
+    jac[0] = -y[0];
+    for (std::size_t k = 1; k < p.size(); ++k) {
+      jac[k] = std::sin(static_cast<double>(k) * t);
+    }
+  };
+  auto loss = [](std::span<const double> y, std::span<double> dldy) {
+    dldy[0] = y[0];
+  };
+
+  auto run = [&](std::size_t n_params) {
+    std::vector<double> p(n_params, 0.01);
+    p[0] = 0.5;
+    return vanta::ode::AdjointRungeKutta4(forced, jac_y, jac_p, loss, 0.0,
+                                          2.0, {1.0}, p, 0.01);
+  };
+  vanta::ode::AdjointSolution few = run(3);
+  vanta::ode::AdjointSolution many = run(200);
+  ASSERT_EQ(many.grad_p.size(), 200u);
+  EXPECT_EQ(many.stats.n_rhs_evals, few.stats.n_rhs_evals);
+  EXPECT_EQ(many.stats.n_jacobian_evals, few.stats.n_jacobian_evals);
+
+  // Spot-check a forcing amplitude against forward sensitivities
+  std::vector<double> p(200, 0.01);
+  p[0] = 0.5;
+  vanta::ode::SensitivityOptions opts;
+  opts.jacobian_y = jac_y;
+  opts.jacobian_p = jac_p;
+  vanta::ode::SensitivitySolution forward =
+      vanta::ode::ForwardSensitivityRungeKutta4(forced, 0.0, 2.0, {1.0}, p,
+                                                0.01, opts);
+  const std::size_t last = forward.solution.NumSteps() - 1;
+  for (std::size_t k : {0, 1, 57, 199}) {
+    const double expected =
+        forward.solution.Back()[0] * forward.Sensitivity(last)[k];
+    EXPECT_NEAR(many.grad_p[k], expected, 1e-12);
+  }
+}
+
+TEST_F(AdjointTest, EulerBackwardMatchesDifferencedSolves) {
+  vanta::ode::AdjointSolution result = vanta::ode::AdjointEulerBackward(
+      LotkaVolterra, JacobianY, JacobianP, Loss, 0.0, kT1, kY0, kP, kH);
+
+  // The forward pass agrees with the plain solver to the Newton tolerance
+  vanta::ode::EBOptions eb;
+  eb.jacobian = [](double t, std::span<const double> y,
+                   std::span<double> jac) { JacobianY(t, y, kP, jac); };
+  vanta::ode::Solution plain = vanta::ode::EulerBackward(
+      vanta::ode::InPlaceRhs([](double t, std::span<const double> y,
+                                std::span<double> dydt) {
+        LotkaVolterra(t, y, kP, dydt);
+      }),
+      0.0, kT1, kY0, kH, eb);
+  EXPECT_NEAR(result.y1[0], plain.Back()[0], 1e-7);
+  EXPECT_NEAR(result.y1[1], plain.Back()[1], 1e-7);
+
+  // Central differences of whole backward Euler solves
+  auto loss_at = [](const std::vector<double>& y0,
+                    const std::vector<double>& p) {
+    vanta::ode::AdjointSolution r = vanta::ode::AdjointEulerBackward(
+        LotkaVolterra, JacobianY, JacobianP, Loss, 0.0, kT1, y0, p, kH);
+    return r.y1[0] * r.y1[0] + 3.0 * r.y1[1];
+  };
+  const double eps = 1e-6;
+  for (std::size_t k = 0; k < kP.size(); ++k) {
+    std::vector<double> p_plus = kP;
+    std::vector<double> p_minus = kP;
+    p_plus[k] += eps;
+    p_minus[k] -= eps;
+    const double fd =
+        (loss_at(kY0, p_plus) - loss_at(kY0, p_minus)) / (2.0 * eps);
+    EXPECT_NEAR(result.grad_p[k], fd, 1e-6 * std::max(std::abs(fd), 1.0));
+  }
+  for (std::size_t j = 0; j < 2; ++j) {
+    std::vector<double> y_plus = kY0;
+    std::vector<double> y_minus = kY0;
+    y_plus[j] += eps;
+    y_minus[j] -= eps;
+    const double fd =
+        (loss_at(y_plus, kP) - loss_at(y_minus, kP)) / (2.0 * eps);
+    EXPECT_NEAR(result.grad_y0[j], fd, 1e-6 * std::max(std::abs(fd), 1.0));
+  }
+}
+
+TEST_F(AdjointTest, InvalidArguments) {
+  EXPECT_THROW(vanta::ode::AdjointRungeKutta4(LotkaVolterra, JacobianY,
+                                              JacobianP, Loss, 0.0, kT1, kY0,
+                                              kP, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::AdjointRungeKutta4(LotkaVolterra, JacobianY,
+                                              JacobianP, Loss, kT1, 0.0, kY0,
+                                              kP, kH),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::AdjointRungeKutta4(LotkaVolterra, JacobianY, {},
+                                              Loss, 0.0, kT1, kY0, kP, kH),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::AdjointEulerBackward(LotkaVolterra, {}, JacobianP,
+                                                Loss, 0.0, kT1, kY0, kP, kH),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::AdjointEulerBackward(LotkaVolterra, JacobianY,
+                                                JacobianP, {}, 0.0, kT1, kY0,
+                                                kP, kH),
+               std::invalid_argument);
+}
@@ -0,0 +1,14 @@
+#ifndef TESTS_CORE_ODE_ALLOCATION_COUNTER_HPP_
+#define TESTS_CORE_ODE_ALLOCATION_COUNTER_HPP_
+
+// Allocation counter shared by the tests that check steps do not touch the
+// heap. allocation_counter.cpp replaces every global operator new and
+// delete of the ode_test binary; allocations are counted while
+// g_count_allocations is set.
+
+#include <atomic>
+
+extern std::atomic<bool> g_count_allocations;
+extern std::atomic<int> g_allocations;
+
+#endif  // TESTS_CORE_ODE_ALLOCATION_COUNTER_HPP_
@@ -0,0 +1,124 @@
+#include "ode/auto_switch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/bdf.hpp"
+#include "ode/dormand_prince_45.hpp"
+
+namespace {
+
+// Van der Pol oscillator in scaled time with mu = 1e4, stiff on the slow
+// branches of its limit cycle and non-stiff during the fast jumps between
+// them
+void VanDerPol(double t [[maybe_unused]], std::span<const double> y,
+               std::span<double> dydt) {
+  constexpr double kMu = 1e4;
+  dydt[0] = y[1];
+  dydt[1] = kMu * ((1.0 - y[0] * y[0]) * y[1] - y[0]);
+}
+
+// Harmonic oscillator, never stiff
+void Oscillator(double t [[maybe_unused]], std::span<const double> y,
+                std::span<double> dydt) {
+  dydt[0] = y[1];
+  dydt[1] = -y[0];
+}
+
+}  // namespace
+
+TEST(AutoSwitchTest, SwitchesBothWaysOnVanDerPol) {
+  vanta::ode::SwitchingOptions opts;
+  opts.rtol = 1e-6;
+  opts.atol = 1e-8;
+  vanta::ode::SwitchingSolution result = vanta::ode::AutoSwitch(
+      vanta::ode::InPlaceRhs(VanDerPol), 0.0, 3.0, {2.0, 0.0}, opts);
+  const vanta::ode::Solution& sol = result.solution;
+
+  // The method alternates, starting with the switch to BDF
+  ASSERT_GE(result.switches.size(), 2u);
+  for (std::size_t i = 0; i < result.switches.size(); ++i) {
+    EXPECT_EQ(result.switches[i].stiff, i % 2 == 0);
+    EXPECT_GT(result.switches[i].t, 0.0);
+    EXPECT_LT(result.switches[i].t, 3.0);
+    if (i > 0) {
+      EXPECT_GT(result.switches[i].t, result.switches[i - 1].t);
+    }
+  }
+
+  // Switch points are recorded steps of the combined trajectory
+  for (const vanta::ode::MethodSwitch& change : result.switches) {
+    bool found = false;
+    for (double t_i : sol.t) found = found || t_i == change.t;
+    EXPECT_TRUE(found);
+  }
+
+  // Agrees with a tight BDF reference and needs far fewer steps than
+  // Dormand–Prince alone
+  vanta::ode::BDFOptions reference_opts;
+  reference_opts.rtol = 1e-10;
+  reference_opts.atol = 1e-12;
+  vanta::ode::Solution reference = vanta::ode::BDF(
+      vanta::ode::InPlaceRhs(VanDerPol), 0.0, 3.0, {2.0, 0.0},
+      reference_opts);
+  EXPECT_DOUBLE_EQ(sol.t.back(), 3.0);
+  EXPECT_NEAR(sol.Back()[0], reference.Back()[0], 1e-3);
+
+  vanta::ode::DP45Options dp45_opts;
+  dp45_opts.rtol = opts.rtol;
+  dp45_opts.atol = opts.atol;
+  vanta::ode::Solution explicit_only = vanta::ode::DormandPrince45(
+      vanta::ode::InPlaceRhs(VanDerPol), 0.0, 3.0, {2.0, 0.0}, dp45_opts);
+  EXPECT_LT(sol.stats.n_accepted, explicit_only.stats.n_accepted / 2);
+  EXPECT_GT(sol.stats.n_jacobian_evals, 0u);
+  EXPECT_EQ(sol.stats.n_accepted + 1, sol.NumSteps());
+}
+
+TEST(AutoSwitchTest, NonStiffProblemStaysExplicit) {
+  vanta::ode::SwitchingSolution result = vanta::ode::AutoSwitch(
+      vanta::ode::InPlaceRhs(Oscillator), 0.0, 10.0, {1.0, 0.0});
+  vanta::ode::Solution reference = vanta::ode::DormandPrince45(
+      vanta::ode::InPlaceRhs(Oscillator), 0.0, 10.0, {1.0, 0.0});
+
+  // Without a switch the run is exactly Dormand–Prince
+  EXPECT_TRUE(result.switches.empty());
+  ASSERT_EQ(result.solution.NumSteps(), reference.NumSteps());
+  EXPECT_EQ(result.solution.t, reference.t);
+  EXPECT_EQ(result.solution.y, reference.y);
+  EXPECT_EQ(result.solution.stats.n_rhs_evals, reference.stats.n_rhs_evals);
+  EXPECT_EQ(result.solution.stats.n_jacobian_evals, 0u);
+}
+
+TEST(AutoSwitchTest, OutputAppliesAcrossSwitches) {
+  vanta::ode::OutputOptions out;
+  out.times = {0.1, 1.0, 2.0, 2.9};
+  vanta::ode::SwitchingSolution result = vanta::ode::AutoSwitch(
+      vanta::ode::InPlaceRhs(VanDerPol), 0.0, 3.0, {2.0, 0.0}, {}, out);
+  ASSERT_FALSE(result.switches.empty());
+  EXPECT_EQ(result.solution.t, out.times);
+}
+
+TEST(AutoSwitchTest, InvalidArguments) {
+  const vanta::ode::InPlaceRhs f(Oscillator);
+  EXPECT_THROW(vanta::ode::AutoSwitch(f, 1.0, 0.0, {1.0, 0.0}),
+               std::invalid_argument);
+
+  vanta::ode::SwitchingOptions opts;
+  opts.nonstiff_threshold = opts.stiff_threshold;
+  EXPECT_THROW(vanta::ode::AutoSwitch(f, 0.0, 1.0, {1.0, 0.0}, opts),
+               std::invalid_argument);
+
+  opts = {};
+  opts.switch_steps = 0;
+  EXPECT_THROW(vanta::ode::AutoSwitch(f, 0.0, 1.0, {1.0, 0.0}, opts),
+               std::invalid_argument);
+
+  opts = {};
+  opts.rtol = 0.0;
+  EXPECT_THROW(vanta::ode::AutoSwitch(f, 0.0, 1.0, {1.0, 0.0}, opts),
+               std::invalid_argument);
+}
@@ -0,0 +1,298 @@
+#include "ode/bdf.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/phase_timer.hpp"
+
+namespace {
+
+// Robertson chemical kinetics, a classic stiff test problem
+void Robertson(double t [[maybe_unused]], std::span<const double> y,
+               std::span<double> dydt) {
+  dydt[0] = -0.04 * y[0] + 1e4 * y[1] * y[2];
+  dydt[1] = 0.04 * y[0] - 1e4 * y[1] * y[2] - 3e7 * y[1] * y[1];
+  dydt[2] = 3e7 * y[1] * y[1];
+}
+
+// Analytic Jacobian of the Robertson problem
+void RobertsonJacobian(double t [[maybe_unused]], std::span<const double> y,
+                       std::span<double> jac) {
+  jac[0] = -0.04;
+  jac[1] = 1e4 * y[2];
+  jac[2] = 1e4 * y[1];
+  jac[3] = 0.04;
+  jac[4] = -1e4 * y[2] - 6e7 * y[1];
+  jac[5] = -1e4 * y[1];
+  jac[6] = 0.0;
+  jac[7] = 6e7 * y[1];
+  jac[8] = 0.0;
+}
+
+// Robertson problem for a batch of states in structure-of-arrays layout
+void BatchRobertson(double t [[maybe_unused]], std::span<const double> y,
+                    std::span<double> dydt,
+                    std::size_t first [[maybe_unused]], std::size_t count) {
+  for (std::size_t m = 0; m < count; ++m) {
+    const double y0 = y[m];
+    const double y1 = y[count + m];
+    const double y2 = y[2 * count + m];
+    dydt[m] = -0.04 * y0 + 1e4 * y1 * y2;
+    dydt[count + m] = 0.04 * y0 - 1e4 * y1 * y2 - 3e7 * y1 * y1;
+    dydt[2 * count + m] = 3e7 * y1 * y1;
+  }
+}
+
+}  // namespace
+
+class BDFTest : public ::testing::Test {
+ protected:
+  // Allowed numerical tolerance for solution comparisons
+  const double kTolerance = 1e-6;
+};
+
+TEST_F(BDFTest, InvalidArguments) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  EXPECT_THROW(vanta::ode::BDF(f, 1.0, 0.0, {1.0}), std::invalid_argument);
+
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 0.0;
+  EXPECT_THROW(vanta::ode::BDF(f, 0.0, 1.0, {1.0}, opts),
+               std::invalid_argument);
+
+  opts = {};
+  opts.max_order = 6;
+  EXPECT_THROW(vanta::ode::BDF(f, 0.0, 1.0, {1.0}, opts),
+               std::invalid_argument);
+}
+
+TEST_F(BDFTest, ExponentialDecay) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 1e-8;
+  opts.atol = 1e-10;
+  vanta::ode::Solution sol = vanta::ode::BDF(f, 0.0, 5.0, {1.0}, opts);
+
+  // Lands exactly on the final time
+  EXPECT_EQ(sol.t.back(), 5.0);
+  for (std::size_t i = 0; i < sol.NumSteps(); ++i) {
+    EXPECT_NEAR(sol.Row(i)[0], std::exp(-sol.t[i]), kTolerance);
+  }
+}
+
+TEST_F(BDFTest, HigherOrderTakesFewerSteps) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[1], -y[0]};
+  };
+
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 1e-8;
+  opts.atol = 1e-10;
+  vanta::ode::Solution high = vanta::ode::BDF(f, 0.0, 10.0, {1.0, 0.0}, opts);
+  opts.max_order = 1;
+  vanta::ode::Solution low = vanta::ode::BDF(f, 0.0, 10.0, {1.0, 0.0}, opts);
+
+  EXPECT_NEAR(high.Back()[0], std::cos(10.0), 1e-5);
+  EXPECT_NEAR(high.Back()[1], -std::sin(10.0), 1e-5);
+  EXPECT_LT(5 * high.stats.n_accepted, low.stats.n_accepted);
+}
+
+TEST_F(BDFTest, StiffRobertson) {
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 1e-6;
+  opts.atol = 1e-10;
+  vanta::ode::Solution sol =
+      vanta::ode::BDF(Robertson, 0.0, 40.0, {1.0, 0.0, 0.0}, opts);
+
+  // Reference values from Hairer and Wanner
+  EXPECT_NEAR(sol.Back()[0], 0.7158271, 1e-5);
+  EXPECT_NEAR(sol.Back()[1], 9.185535e-6, 1e-9);
+  EXPECT_NEAR(sol.Back()[2], 0.2841637, 1e-5);
+
+  // Mass is conserved
+  for (std::size_t i = 0; i < sol.NumSteps(); ++i) {
+    const auto y = sol.Row(i);
+    EXPECT_NEAR(y[0] + y[1] + y[2], 1.0, 1e-8);
+  }
+
+  // Stiffness is handled with few steps and Jacobians
+  EXPECT_LT(sol.stats.n_accepted, 500);
+  EXPECT_LT(sol.stats.n_jacobian_evals, sol.stats.n_accepted / 4);
+  EXPECT_LT(sol.stats.n_factorisations, sol.stats.n_accepted);
+}
+
+TEST_F(BDFTest, StatsCountNewtonIterationsAndTimePhases) {
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 1e-6;
+  opts.atol = 1e-10;
+  vanta::ode::Solution sol =
+      vanta::ode::BDF(Robertson, 0.0, 40.0, {1.0, 0.0, 0.0}, opts);
+
+  // Every attempted step takes at least one Newton iteration
+  const vanta::ode::Stats& stats = sol.stats;
+  EXPECT_GE(stats.n_newton_iters, stats.n_accepted);
+
+  // The measured phases fit within the total
+  const vanta::ode::PhaseTimes& time = stats.time;
+  EXPECT_GE(time.rhs, 0.0);
+  EXPECT_GE(time.jacobian, 0.0);
+  EXPECT_GE(time.linear_solve, 0.0);
+  EXPECT_GE(time.Other(), -1e-9);
+#if VANTA_ODE_TIMING
+  EXPECT_GT(time.total, 0.0);
+  EXPECT_GT(time.rhs, 0.0);
+  EXPECT_GT(time.linear_solve, 0.0);
+#else
+  EXPECT_EQ(time.total, 0.0);
+#endif
+}
+
+TEST_F(BDFTest, AnalyticJacobianMatchesFiniteDifferences) {
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 1e-6;
+  opts.atol = 1e-10;
+  vanta::ode::Solution numeric =
+      vanta::ode::BDF(Robertson, 0.0, 40.0, {1.0, 0.0, 0.0}, opts);
+  opts.jacobian = RobertsonJacobian;
+  vanta::ode::Solution analytic =
+      vanta::ode::BDF(Robertson, 0.0, 40.0, {1.0, 0.0, 0.0}, opts);
+
+  EXPECT_NEAR(analytic.Back()[0], numeric.Back()[0], 1e-5);
+  EXPECT_NEAR(analytic.Back()[2], numeric.Back()[2], 1e-5);
+}
+
+TEST_F(BDFTest, OutputTimes) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  vanta::ode::OutputOptions out;
+  out.times = {1.0, 2.0, 3.0};
+  vanta::ode::Solution sol = vanta::ode::BDF(f, 0.0, 3.0, {1.0}, {}, out);
+
+  ASSERT_EQ(sol.NumSteps(), 3);
+  for (std::size_t i = 0; i < sol.NumSteps(); ++i) {
+    EXPECT_EQ(sol.t[i], out.times[i]);
+    EXPECT_NEAR(sol.Row(i)[0], std::exp(-out.times[i]), 1e-3);
+  }
+}
+
+TEST_F(BDFTest, SparseJacobianMatchesDense) {
+  // Method-of-lines heat equation u_t = u_xx on (0, 1), u = 0 at both ends
+  const std::size_t n = 100;
+  const double dx = 1.0 / (n + 1);
+  auto f = [n, dx](double t [[maybe_unused]], std::span<const double> u,
+                   std::span<double> dudt) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const double left = i > 0 ? u[i - 1] : 0.0;
+      const double right = i + 1 < n ? u[i + 1] : 0.0;
+      dudt[i] = (left - 2.0 * u[i] + right) / (dx * dx);
+    }
+  };
+
+  // Lowest sine mode decays as exp(-pi^2 t)
+  std::vector<double> u0(n);
+  for (std::size_t i = 0; i < n; ++i) u0[i] = std::sin(M_PI * (i + 1) * dx);
+
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 1e-6;
+  opts.atol = 1e-9;
+  vanta::ode::Solution dense = vanta::ode::BDF(f, 0.0, 0.1, u0, opts);
+  opts.sparsity = vanta::linear_solvers::BandedPattern(n, 1, 1);
+  vanta::ode::Solution sparse = vanta::ode::BDF(f, 0.0, 0.1, u0, opts);
+
+  const double decay = std::exp(-M_PI * M_PI * 0.1);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_NEAR(sparse.Back()[i], dense.Back()[i], 1e-8);
+    EXPECT_NEAR(sparse.Back()[i], u0[i] * decay, 1e-3);
+  }
+
+  // Three colours per Jacobian instead of one evaluation per state
+  EXPECT_EQ(sparse.stats.n_accepted, dense.stats.n_accepted);
+  EXPECT_EQ(dense.stats.n_rhs_evals - sparse.stats.n_rhs_evals,
+            (n - 3) * dense.stats.n_jacobian_evals);
+}
+
+TEST_F(BDFTest, BatchedJacobianColumnsInOneCall) {
+  // The single-state right-hand side is the batch of one member
+  int batch_calls = 0;
+  const vanta::ode::BatchRhs batch =
+      [&](double t, std::span<const double> y, std::span<double> dydt,
+          std::size_t first, std::size_t count) {
+        if (count > 1) ++batch_calls;
+        BatchRobertson(t, y, dydt, first, count);
+      };
+  const vanta::ode::InPlaceRhs f = vanta::ode::ToInPlaceRhs(batch);
+
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 1e-6;
+  opts.atol = 1e-10;
+  vanta::ode::Solution unbatched =
+      vanta::ode::BDF(f, 0.0, 40.0, {1.0, 0.0, 0.0}, opts);
+  ASSERT_EQ(batch_calls, 0);
+
+  // The same perturbed states evaluated together give the same run
+  opts.batch_rhs = batch;
+  vanta::ode::Solution batched =
+      vanta::ode::BDF(f, 0.0, 40.0, {1.0, 0.0, 0.0}, opts);
+  EXPECT_EQ(batched.t, unbatched.t);
+  EXPECT_EQ(batched.y, unbatched.y);
+  EXPECT_EQ(batched.stats.n_rhs_evals, unbatched.stats.n_rhs_evals);
+  EXPECT_GT(batched.stats.n_jacobian_evals, 0u);
+  EXPECT_EQ(static_cast<std::size_t>(batch_calls),
+            batched.stats.n_jacobian_evals);
+
+  // An analytic Jacobian takes precedence
+  batch_calls = 0;
+  opts.jacobian = RobertsonJacobian;
+  vanta::ode::BDF(f, 0.0, 40.0, {1.0, 0.0, 0.0}, opts);
+  EXPECT_EQ(batch_calls, 0);
+}
+
+TEST_F(BDFTest, BatchedSparseJacobianMatchesUnbatched) {
+  // Heat equation as in SparseJacobianMatchesDense, adapted per member
+  const std::size_t n = 50;
+  const double dx = 1.0 / (n + 1);
+  const vanta::ode::InPlaceRhs f = [n, dx](double t [[maybe_unused]],
+                                           std::span<const double> u,
+                                           std::span<double> dudt) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const double left = i > 0 ? u[i - 1] : 0.0;
+      const double right = i + 1 < n ? u[i + 1] : 0.0;
+      dudt[i] = (left - 2.0 * u[i] + right) / (dx * dx);
+    }
+  };
+  const vanta::ode::BatchRhs per_member = vanta::ode::ToBatchRhs(f, n);
+  std::size_t batch_calls = 0;
+  std::size_t batch_states = 0;
+  const vanta::ode::BatchRhs batch =
+      [&](double t, std::span<const double> y, std::span<double> dydt,
+          std::size_t first, std::size_t count) {
+        ++batch_calls;
+        batch_states += count;
+        per_member(t, y, dydt, first, count);
+      };
+
+  std::vector<double> u0(n);
+  for (std::size_t i = 0; i < n; ++i) u0[i] = std::sin(M_PI * (i + 1) * dx);
+
+  vanta::ode::BDFOptions opts;
+  opts.sparsity = vanta::linear_solvers::BandedPattern(n, 1, 1);
+  vanta::ode::Solution unbatched = vanta::ode::BDF(f, 0.0, 0.1, u0, opts);
+  opts.batch_rhs = batch;
+  vanta::ode::Solution batched = vanta::ode::BDF(f, 0.0, 0.1, u0, opts);
+
+  EXPECT_EQ(batched.y, unbatched.y);
+  EXPECT_EQ(batch_calls, batched.stats.n_jacobian_evals);
+  EXPECT_EQ(batch_states, 3 * batched.stats.n_jacobian_evals);
+}
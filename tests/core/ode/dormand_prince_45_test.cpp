@@ -0,0 +1,196 @@
+#include "ode/dormand_prince_45.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+#include <span>
+#include <vector>
+
+class DormandPrince45Test : public ::testing::Test {
+ protected:
+  // Allowed numerical tolerance for solution comparisons
+  const double kTolerance = 1e-6;
+};
+
+TEST_F(DormandPrince45Test, InvalidTimeInterval) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[0]};
+  };
+
+  EXPECT_THROW(
+      { vanta::ode::DormandPrince45(f, 1.0, 0.0, {1.0}); },
+      std::invalid_argument);
+}
+
+TEST_F(DormandPrince45Test, NonPositiveTolerance) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[0]};
+  };
+
+  vanta::ode::DP45Options opts;
+  opts.rtol = 0.0;
+
+  EXPECT_THROW(
+      { vanta::ode::DormandPrince45(f, 0.0, 1.0, {1.0}, opts); },
+      std::invalid_argument);
+}
+
+TEST_F(DormandPrince45Test, EndsExactlyAtFinalTime) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  vanta::ode::Solution sol = vanta::ode::DormandPrince45(f, 0.0, 3.7, {1.0});
+
+  EXPECT_DOUBLE_EQ(sol.t.front(), 0.0);
+  EXPECT_DOUBLE_EQ(sol.t.back(), 3.7);
+  EXPECT_EQ(sol.NumSteps(), sol.y.size());
+}
+
+TEST_F(DormandPrince45Test, ExponentialDecay) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  vanta::ode::DP45Options opts;
+  opts.rtol = 1e-9;
+  opts.atol = 1e-12;
+  vanta::ode::Solution sol =
+      vanta::ode::DormandPrince45(f, 0.0, 5.0, {1.0}, opts);
+
+  // Every accepted step should match the exact solution y(t) = e^-t
+  for (size_t i = 0; i < sol.NumSteps(); ++i) {
+    EXPECT_NEAR(sol.Row(i)[0], std::exp(-sol.t[i]), kTolerance);
+  }
+}
+
+TEST_F(DormandPrince45Test, HarmonicOscillator) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[1], -y[0]};
+  };
+
+  vanta::ode::DP45Options opts;
+  opts.rtol = 1e-10;
+  opts.atol = 1e-10;
+  vanta::ode::Solution sol =
+      vanta::ode::DormandPrince45(f, 0.0, 10.0, {1.0, 0.0}, opts);
+
+  EXPECT_NEAR(sol.Back()[0], std::cos(10.0), kTolerance);
+  EXPECT_NEAR(sol.Back()[1], -std::sin(10.0), kTolerance);
+}
+
+TEST_F(DormandPrince45Test, TighterToleranceIsMoreAccurate) {
+  auto f = [](const double& t, const std::vector<double>& y) {
+    return std::vector<double>{std::cos(t) * y[0]};
+  };
+  const double exact = std::exp(std::sin(4.0));
+
+  vanta::ode::DP45Options loose;
+  loose.rtol = 1e-3;
+  loose.atol = 1e-6;
+  vanta::ode::DP45Options tight;
+  tight.rtol = 1e-9;
+  tight.atol = 1e-12;
+
+  vanta::ode::Solution sol_loose =
+      vanta::ode::DormandPrince45(f, 0.0, 4.0, {1.0}, loose);
+  vanta::ode::Solution sol_tight =
+      vanta::ode::DormandPrince45(f, 0.0, 4.0, {1.0}, tight);
+
+  EXPECT_LT(std::abs(sol_tight.Back()[0] - exact),
+            std::abs(sol_loose.Back()[0] - exact));
+  EXPECT_GT(sol_tight.NumSteps(), sol_loose.NumSteps());
+}
+
+TEST_F(DormandPrince45Test, SmoothProblemTakesFewSteps) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-0.1 * y[0]};
+  };
+
+  vanta::ode::Solution sol = vanta::ode::DormandPrince45(f, 0.0, 100.0, {1.0});
+
+  EXPECT_LT(sol.NumSteps(), 100);
+  EXPECT_NEAR(sol.Back()[0], std::exp(-10.0), 1e-6);
+}
+
+TEST_F(DormandPrince45Test, FirstSameAsLastReusesFinalStage) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[1], -y[0]};
+  };
+
+  vanta::ode::DP45Options opts;
+  opts.h0 = 0.1;
+  vanta::ode::Solution sol =
+      vanta::ode::DormandPrince45(f, 0.0, 10.0, {1.0, 0.0}, opts);
+
+  // One initial evaluation plus six per attempted step
+  const vanta::ode::Stats& stats = sol.stats;
+  EXPECT_EQ(stats.n_accepted, sol.NumSteps() - 1);
+  EXPECT_EQ(stats.n_rhs_evals,
+            1 + 6 * (stats.n_accepted + stats.n_rejected));
+}
+
+TEST_F(DormandPrince45Test, OversizedInitialStepIsRejected) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-50.0 * y[0]};
+  };
+
+  vanta::ode::DP45Options opts;
+  opts.h0 = 1.0;
+  vanta::ode::Solution sol =
+      vanta::ode::DormandPrince45(f, 0.0, 1.0, {1.0}, opts);
+
+  EXPECT_GT(sol.stats.n_rejected, 0);
+  EXPECT_NEAR(sol.Back()[0], std::exp(-50.0), 1e-6);
+}
+
+TEST_F(DormandPrince45Test, MaxStepsExceeded) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[1], -y[0]};
+  };
+
+  vanta::ode::DP45Options opts;
+  opts.max_steps = 5;
+
+  EXPECT_THROW(
+      { vanta::ode::DormandPrince45(f, 0.0, 100.0, {1.0, 0.0}, opts); },
+      std::runtime_error);
+}
+
+TEST_F(DormandPrince45Test, InPlaceMatchesVectorOverload) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[1], -y[0]};
+  };
+  auto f_in_place = [](double t [[maybe_unused]], std::span<const double> y,
+                       std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0];
+  };
+
+  vanta::ode::Solution sol =
+      vanta::ode::DormandPrince45(f, 0.0, 5.0, {1.0, 0.0});
+  vanta::ode::Solution sol_in_place =
+      vanta::ode::DormandPrince45(f_in_place, 0.0, 5.0, {1.0, 0.0});
+
+  ASSERT_EQ(sol.NumSteps(), sol_in_place.NumSteps());
+  for (size_t i = 0; i < sol.y.size(); ++i) {
+    EXPECT_DOUBLE_EQ(sol.y[i], sol_in_place.y[i]);
+  }
+}
+
+TEST_F(DormandPrince45Test, FinalStateOnlyKeepsStats) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  vanta::ode::OutputOptions out;
+  out.stride = 0;
+  vanta::ode::Solution sol =
+      vanta::ode::DormandPrince45(f, 0.0, 2.0, {1.0}, {}, out);
+
+  ASSERT_EQ(sol.NumSteps(), 1);
+  EXPECT_DOUBLE_EQ(sol.t[0], 2.0);
+  EXPECT_NEAR(sol.Row(0)[0], std::exp(-2.0), kTolerance);
+  EXPECT_GT(sol.stats.n_accepted, 1);
+}
@@ -0,0 +1,281 @@
+#include "ode/ensemble.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/runge_kutta_4.hpp"
+
+namespace {
+
+// Damped oscillators with a per-member stiffness k_m = 0.1 + 0.01 * m
+void BatchOscillator(double t [[maybe_unused]], std::span<const double> y,
+                     std::span<double> dydt, std::size_t first,
+                     std::size_t count) {
+  const double* x = y.data();
+  const double* v = y.data() + count;
+  for (std::size_t m = 0; m < count; ++m) {
+    const double k = 0.1 + 0.01 * static_cast<double>(first + m);
+    dydt[m] = v[m];
+    dydt[count + m] = -0.2 * v[m] - k * x[m];
+  }
+}
+
+// Initial states (x, v) = (1 + 0.1 m, 0) for each member
+std::vector<double> InitialStates(std::size_t n_members) {
+  std::vector<double> y0(2 * n_members, 0.0);
+  for (std::size_t m = 0; m < n_members; ++m) {
+    y0[2 * m] = 1.0 + 0.1 * static_cast<double>(m);
+  }
+  return y0;
+}
+
+}  // namespace
+
+class EnsembleTest : public ::testing::Test {
+ protected:
+  // Allowed numerical tolerance for solution comparisons
+  const double kTolerance = 1e-12;
+};
+
+// Every member matches an individual RK4 integration of the same system
+TEST_F(EnsembleTest, MembersMatchSingleTrajectories) {
+  const std::size_t n_members = 37;
+  const std::vector<double> y0 = InitialStates(n_members);
+  vanta::ode::EnsembleOptions opts;
+  opts.block_size = 8;
+  opts.stride = 5;
+
+  vanta::ode::EnsembleSolution ens = vanta::ode::EnsembleRungeKutta4(
+      BatchOscillator, 0.0, 2.0, y0, 2, 0.05, opts);
+  ASSERT_EQ(ens.members.size(), n_members);
+
+  for (std::size_t m = 0; m < n_members; ++m) {
+    const double k = 0.1 + 0.01 * static_cast<double>(m);
+    auto f = [k](const double& t [[maybe_unused]],
+                 const std::vector<double>& y) -> std::vector<double> {
+      return {y[1], -0.2 * y[1] - k * y[0]};
+    };
+    vanta::ode::OutputOptions out;
+    out.stride = 5;
+    vanta::ode::Solution ref = vanta::ode::RungeKutta4(
+        f, 0.0, 2.0, {y0[2 * m], y0[2 * m + 1]}, 0.05, out);
+
+    const vanta::ode::Solution& sol = ens.members[m];
+    ASSERT_EQ(sol.NumSteps(), ref.NumSteps());
+    for (std::size_t i = 0; i < ref.NumSteps(); ++i) {
+      EXPECT_NEAR(sol.t[i], ref.t[i], kTolerance);
+      EXPECT_NEAR(sol.Row(i)[0], ref.Row(i)[0], kTolerance);
+      EXPECT_NEAR(sol.Row(i)[1], ref.Row(i)[1], kTolerance);
+    }
+  }
+}
+
+// Mean and variance agree with a direct computation over the members
+TEST_F(EnsembleTest, StatisticsMatchMembers) {
+  const std::size_t n_members = 50;
+  vanta::ode::EnsembleOptions opts;
+  opts.block_size = 7;
+  opts.stride = 10;
+
+  vanta::ode::EnsembleSolution ens = vanta::ode::EnsembleRungeKutta4(
+      BatchOscillator, 0.0, 1.0, InitialStates(n_members), 2, 0.01, opts);
+  ASSERT_EQ(ens.mean.NumSteps(), ens.t.size());
+  ASSERT_EQ(ens.variance.NumSteps(), ens.t.size());
+
+  for (std::size_t i = 0; i < ens.t.size(); ++i) {
+    for (std::size_t j = 0; j < 2; ++j) {
+      double mean = 0.0;
+      for (const auto& member : ens.members) mean += member.Row(i)[j];
+      mean /= static_cast<double>(n_members);
+      double var = 0.0;
+      for (const auto& member : ens.members) {
+        var += (member.Row(i)[j] - mean) * (member.Row(i)[j] - mean);
+      }
+      var /= static_cast<double>(n_members);
+
+      EXPECT_NEAR(ens.mean.Row(i)[j], mean, kTolerance);
+      EXPECT_NEAR(ens.variance.Row(i)[j], var, kTolerance);
+    }
+  }
+}
+
+// Results do not depend on the number of threads
+TEST_F(EnsembleTest, ThreadCountDoesNotChangeResults) {
+  const std::vector<double> y0 = InitialStates(100);
+  vanta::ode::EnsembleOptions serial;
+  serial.n_threads = 1;
+  serial.block_size = 16;
+  vanta::ode::EnsembleOptions parallel = serial;
+  parallel.n_threads = 4;
+
+  vanta::ode::EnsembleSolution a = vanta::ode::EnsembleRungeKutta4(
+      BatchOscillator, 0.0, 1.0, y0, 2, 0.01, serial);
+  vanta::ode::EnsembleSolution b = vanta::ode::EnsembleRungeKutta4(
+      BatchOscillator, 0.0, 1.0, y0, 2, 0.01, parallel);
+
+  EXPECT_EQ(a.mean.y, b.mean.y);
+  EXPECT_EQ(a.variance.y, b.variance.y);
+  for (std::size_t m = 0; m < a.members.size(); ++m) {
+    EXPECT_EQ(a.members[m].y, b.members[m].y);
+  }
+}
+
+// Only the final state is kept by default and members can be dropped
+TEST_F(EnsembleTest, FinalStateOnlyWithoutMembers) {
+  vanta::ode::EnsembleOptions opts;
+  opts.store_members = false;
+
+  vanta::ode::EnsembleSolution ens = vanta::ode::EnsembleRungeKutta4(
+      BatchOscillator, 0.0, 1.0, InitialStates(10), 2, 0.1, opts);
+
+  EXPECT_TRUE(ens.members.empty());
+  ASSERT_EQ(ens.t.size(), 1u);
+  EXPECT_NEAR(ens.t[0], 1.0, 1e-9);
+  EXPECT_EQ(ens.mean.NumStates(), 2u);
+}
+
+// A float ensemble follows the double one to single precision
+TEST_F(EnsembleTest, FloatMatchesDouble) {
+  auto batch_float = [](double t, std::span<const float> y,
+                        std::span<float> dydt, std::size_t first,
+                        std::size_t count) {
+    std::vector<double> y_d(y.begin(), y.end()), dydt_d(dydt.size());
+    BatchOscillator(t, y_d, dydt_d, first, count);
+    std::copy(dydt_d.begin(), dydt_d.end(), dydt.begin());
+  };
+  const std::vector<double> y0 = InitialStates(20);
+  const std::vector<float> y0_float(y0.begin(), y0.end());
+  vanta::ode::EnsembleOptions opts;
+  opts.block_size = 8;
+  opts.stride = 10;
+
+  vanta::ode::EnsembleSolution ref = vanta::ode::EnsembleRungeKutta4(
+      BatchOscillator, 0.0, 1.0, y0, 2, 0.01, opts);
+  vanta::ode::BasicEnsembleSolution<float> ens =
+      vanta::ode::EnsembleRungeKutta4(batch_float, 0.0, 1.0, y0_float, 2,
+                                      0.01, opts);
+
+  EXPECT_EQ(ens.t, ref.t);
+  ASSERT_EQ(ens.members.size(), ref.members.size());
+  for (std::size_t m = 0; m < ref.members.size(); ++m) {
+    for (std::size_t i = 0; i < ref.members[m].y.size(); ++i) {
+      EXPECT_NEAR(ens.members[m].y[i], ref.members[m].y[i], 1e-5);
+    }
+  }
+  for (std::size_t i = 0; i < ref.mean.y.size(); ++i) {
+    EXPECT_NEAR(ens.mean.y[i], ref.mean.y[i], 1e-5);
+    EXPECT_NEAR(ens.variance.y[i], ref.variance.y[i], 1e-5);
+  }
+}
+
+// Double ensembles accept a braced list of initial states
+TEST_F(EnsembleTest, BracedInitialStates) {
+  vanta::ode::EnsembleSolution braced = vanta::ode::EnsembleRungeKutta4(
+      BatchOscillator, 0.0, 1.0, {1.0, 0.0, 1.1, 0.0}, 2, 0.1);
+  vanta::ode::EnsembleSolution ref = vanta::ode::EnsembleRungeKutta4<double>(
+      BatchOscillator, 0.0, 1.0, InitialStates(2), 2, 0.1);
+
+  ASSERT_EQ(braced.members.size(), 2u);
+  EXPECT_EQ(braced.t, ref.t);
+  EXPECT_EQ(braced.members[0].y, ref.members[0].y);
+  EXPECT_EQ(braced.members[1].y, ref.members[1].y);
+}
+
+// Invalid arguments are rejected
+TEST_F(EnsembleTest, InvalidArguments) {
+  const std::vector<double> y0 = InitialStates(4);
+  EXPECT_THROW(vanta::ode::EnsembleRungeKutta4(BatchOscillator, 0.0, 1.0, y0,
+                                               2, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::EnsembleRungeKutta4(BatchOscillator, 1.0, 0.0, y0,
+                                               2, 0.1),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::EnsembleRungeKutta4(BatchOscillator, 0.0, 1.0, y0,
+                                               3, 0.1),
+               std::invalid_argument);
+  vanta::ode::EnsembleOptions opts;
+  opts.block_size = 0;
+  EXPECT_THROW(vanta::ode::EnsembleRungeKutta4(BatchOscillator, 0.0, 1.0, y0,
+                                               2, 0.1, opts),
+               std::invalid_argument);
+}
+
+// The generic variant with the RK4 tableau takes the same steps as the
+// hand-written RK4 ensemble
+TEST_F(EnsembleTest, ExplicitRungeKuttaMatchesRungeKutta4) {
+  const std::size_t n_members = 21;
+  const std::vector<double> y0 = InitialStates(n_members);
+  vanta::ode::EnsembleOptions opts;
+  opts.block_size = 8;
+  opts.stride = 4;
+
+  vanta::ode::EnsembleSolution rk4 = vanta::ode::EnsembleRungeKutta4(
+      BatchOscillator, 0.0, 2.0, y0, 2, 0.05, opts);
+  vanta::ode::EnsembleSolution generic =
+      vanta::ode::EnsembleExplicitRungeKutta<vanta::ode::kRungeKutta4Tableau>(
+          BatchOscillator, 0.0, 2.0, y0, 2, 0.05, opts);
+
+  EXPECT_EQ(generic.t, rk4.t);
+  EXPECT_EQ(generic.stats.n_rhs_evals, rk4.stats.n_rhs_evals);
+  ASSERT_EQ(generic.members.size(), n_members);
+  for (std::size_t m = 0; m < n_members; ++m) {
+    for (std::size_t i = 0; i < rk4.t.size(); ++i) {
+      EXPECT_NEAR(generic.members[m].Row(i)[0], rk4.members[m].Row(i)[0],
+                  kTolerance);
+      EXPECT_NEAR(generic.members[m].Row(i)[1], rk4.members[m].Row(i)[1],
+                  kTolerance);
+    }
+  }
+}
+
+// Each member of a higher-order ensemble matches the single-trajectory
+// solver with the same tableau, with one batched call per used stage
+TEST_F(EnsembleTest, ExplicitRungeKuttaMatchesSingleTrajectories) {
+  const std::size_t n_members = 13;
+  const std::vector<double> y0 = InitialStates(n_members);
+  vanta::ode::EnsembleOptions opts;
+  opts.block_size = 5;
+  opts.n_threads = 2;
+
+  std::size_t calls = 0;
+  std::size_t evaluated = 0;
+  std::mutex mutex;
+  auto counted = [&](double t, std::span<const double> y,
+                     std::span<double> dydt, std::size_t first,
+                     std::size_t count) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++calls;
+      evaluated += count;
+    }
+    BatchOscillator(t, y, dydt, first, count);
+  };
+  vanta::ode::EnsembleSolution ens = vanta::ode::EnsembleExplicitRungeKutta<
+      vanta::ode::kDormandPrince5Tableau>(counted, 0.0, 1.0, y0, 2, 0.1,
+                                          opts);
+
+  // Three blocks, ten steps, and the unused seventh stage skipped
+  EXPECT_EQ(calls, 3u * 10u * 6u);
+  EXPECT_EQ(evaluated, n_members * 10u * 6u);
+  EXPECT_EQ(ens.stats.n_rhs_evals, calls);
+
+  for (std::size_t m = 0; m < n_members; ++m) {
+    const double k = 0.1 + 0.01 * static_cast<double>(m);
+    auto f = [k](double t [[maybe_unused]], const std::vector<double>& y,
+                 std::vector<double>& dydt) {
+      dydt[0] = y[1];
+      dydt[1] = -0.2 * y[1] - k * y[0];
+    };
+    vanta::ode::Solution ref =
+        vanta::ode::ExplicitRungeKutta<vanta::ode::kDormandPrince5Tableau>(
+            f, 0.0, 1.0, std::vector<double>{y0[2 * m], y0[2 * m + 1]}, 0.1);
+    EXPECT_NEAR(ens.members[m].Back()[0], ref.Back()[0], kTolerance);
+    EXPECT_NEAR(ens.members[m].Back()[1], ref.Back()[1], kTolerance);
+  }
+}
@@ -2,8 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <span>
 #include <vector>
 
 class EulerBackwardTest : public ::testing::Test {
@@ -59,8 +61,8 @@ TEST_F(EulerBackwardTest, ConstantFunction) {
   vanta::ode::Solution sol = vanta::ode::EulerBackward(f, 0.0, 1.0, {5.0}, 0.1);
 
   // Verify solution remains constant
-  for (const auto& y_val : sol.y) {
-    EXPECT_NEAR(y_val[0], 5.0, kTolerance);
+  for (double y_val : sol.Col(0)) {
+    EXPECT_NEAR(y_val, 5.0, kTolerance);
   }
 }
 
@@ -74,7 +76,7 @@ TEST_F(EulerBackwardTest, LinearFunction) {
   vanta::ode::Solution sol = vanta::ode::EulerBackward(f, t0, t1, {0.0}, h);
 
   // y(t) = t, so y(1.0) should be approximately 1.0
-  EXPECT_NEAR(sol.y.back()[0], 1.0, kTolerance);
+  EXPECT_NEAR(sol.Back()[0], 1.0, kTolerance);
 }
 
 TEST_F(EulerBackwardTest, ExponentialGrowth) {
@@ -89,7 +91,7 @@ TEST_F(EulerBackwardTest, ExponentialGrowth) {
 
   // Exact solution: y(t) = e^t, so y(1) = e ≈ 2.71828
   double exact = std::exp(1.0);
-  EXPECT_NEAR(sol.y.back()[0], exact, 0.02);  // Euler approximation error
+  EXPECT_NEAR(sol.Back()[0], exact, 0.02);  // Euler approximation error
 }
 
 TEST_F(EulerBackwardTest, MultiDimensionalSystem) {
@@ -106,15 +108,15 @@ TEST_F(EulerBackwardTest, MultiDimensionalSystem) {
   vanta::ode::Solution sol = vanta::ode::EulerBackward(f, t0, t1, y0, h);
 
   // Check solution dimensions
-  EXPECT_EQ(sol.y[0].size(), 2);
-  EXPECT_EQ(sol.y.back().size(), 2);
+  EXPECT_EQ(sol.Row(0).size(), 2);
+  EXPECT_EQ(sol.Back().size(), 2);
 
   // Exact solution: x(t) = cos(t), y(t) = -sin(t)
   double exact_x = std::cos(1.0);
   double exact_y = -std::sin(1.0);
 
-  EXPECT_NEAR(sol.y.back()[0], exact_x, 0.05);
-  EXPECT_NEAR(sol.y.back()[1], exact_y, 0.05);
+  EXPECT_NEAR(sol.Back()[0], exact_x, 0.05);
+  EXPECT_NEAR(sol.Back()[1], exact_y, 0.05);
 }
 
 TEST_F(EulerBackwardTest, CorrectNumberOfSteps) {
@@ -128,7 +130,7 @@ TEST_F(EulerBackwardTest, CorrectNumberOfSteps) {
 
   auto expected_steps = static_cast<int>(std::ceil((t1 - t0) / h));
   EXPECT_EQ(sol.t.size(), expected_steps + 1);
-  EXPECT_EQ(sol.y.size(), expected_steps + 1);
+  EXPECT_EQ(sol.NumSteps(), expected_steps + 1);
 }
 
 TEST_F(EulerBackwardTest, TimeArrayCorrectness) {
@@ -170,8 +172,9 @@ TEST_F(EulerBackwardTest, TimeDependentFunction) {
   double h = 0.01;
   vanta::ode::Solution sol = vanta::ode::EulerBackward(f, t0, t1, {0.0}, h);
 
-  // Exact solution: y(t) = t^2/2, so y(2) = 2
-  EXPECT_NEAR(sol.y.back()[0], 2.0, 0.01);
+  // Exact solution: y(t) = t^2/2, so y(2) = 2. Backward Euler sums h * t(i)
+  // over the 200 steps, giving y(2) = h^2 * 200 * 201 / 2 = 2.01
+  EXPECT_NEAR(sol.Back()[0], h * h * 200.0 * 201.0 / 2.0, 1e-9);
 }
 
 TEST_F(EulerBackwardTest, LargeStepSize) {
@@ -185,3 +188,144 @@ TEST_F(EulerBackwardTest, LargeStepSize) {
 
   EXPECT_EQ(sol.t.size(), 2);  // One step plus initial
 }
+
+TEST_F(EulerBackwardTest, OutputTimes) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y
+              [[maybe_unused]]) { return std::vector<double>{1.0}; };
+
+  vanta::ode::OutputOptions out;
+  out.times = {0.25, 0.5, 0.75};
+  vanta::ode::Solution sol =
+      vanta::ode::EulerBackward(f, 0.0, 1.0, {0.0}, 0.1, {}, out);
+
+  // y(t) = t is reproduced exactly and linear interpolation is exact
+  ASSERT_EQ(sol.NumSteps(), 3);
+  for (size_t i = 0; i < sol.NumSteps(); ++i) {
+    EXPECT_NEAR(sol.t[i], out.times[i], kTolerance);
+    EXPECT_NEAR(sol.Row(i)[0], out.times[i], kTolerance);
+  }
+}
+
+TEST_F(EulerBackwardTest, LinearStiffSystemFactorisesOnce) {
+  // Stiff linear system with eigenvalues -1 and -1000
+  auto f = [](double t [[maybe_unused]], std::span<const double> y,
+              std::span<double> dydt) {
+    dydt[0] = -y[0];
+    dydt[1] = -1000.0 * (y[1] - y[0]);
+  };
+
+  vanta::ode::Solution sol =
+      vanta::ode::EulerBackward(f, 0.0, 1.0, {1.0, 0.0}, 0.01);
+
+  // The Jacobian is constant, so one evaluation and factorisation suffice
+  EXPECT_EQ(sol.stats.n_jacobian_evals, 1);
+  EXPECT_EQ(sol.stats.n_factorisations, 1);
+  EXPECT_EQ(sol.stats.n_accepted, 100);
+
+  // The stiff component relaxes onto the slow one, y(1) ≈ e^-1
+  EXPECT_NEAR(sol.Back()[0], std::exp(-1.0), 0.01);
+  EXPECT_NEAR(sol.Back()[1], sol.Back()[0], 0.01);
+}
+
+TEST_F(EulerBackwardTest, NonlinearMatchesExactNewtonSolve) {
+  // dy/dt = -y^2 has backward Euler update y+ = (-1 + sqrt(1 + 4hy)) / 2h
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0] * y[0]};
+  };
+
+  const double h = 0.1;
+  vanta::ode::Solution sol = vanta::ode::EulerBackward(f, 0.0, 2.0, {5.0}, h);
+
+  double y = 5.0;
+  for (std::size_t i = 1; i < sol.NumSteps(); ++i) {
+    y = (-1.0 + std::sqrt(1.0 + 4.0 * h * y)) / (2.0 * h);
+    EXPECT_NEAR(sol.Row(i)[0], y, 1e-9);
+  }
+
+  // The Jacobian is reused across steps
+  EXPECT_LT(sol.stats.n_jacobian_evals, sol.stats.n_accepted);
+}
+
+TEST_F(EulerBackwardTest, AnalyticJacobian) {
+  // Van der Pol oscillator with mu = 100
+  const double mu = 100.0;
+  auto f = [mu](double t [[maybe_unused]], std::span<const double> y,
+                std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = mu * (1.0 - y[0] * y[0]) * y[1] - y[0];
+  };
+
+  vanta::ode::EBOptions opts;
+  opts.jacobian = [mu](double t [[maybe_unused]], std::span<const double> y,
+                       std::span<double> jac) {
+    jac[0] = 0.0;
+    jac[1] = 1.0;
+    jac[2] = -2.0 * mu * y[0] * y[1] - 1.0;
+    jac[3] = mu * (1.0 - y[0] * y[0]);
+  };
+
+  vanta::ode::Solution analytic =
+      vanta::ode::EulerBackward(f, 0.0, 1.0, {2.0, 0.0}, 0.001, opts);
+  vanta::ode::Solution numeric =
+      vanta::ode::EulerBackward(f, 0.0, 1.0, {2.0, 0.0}, 0.001);
+
+  EXPECT_NEAR(analytic.Back()[0], numeric.Back()[0], 1e-8);
+  EXPECT_NEAR(analytic.Back()[1], numeric.Back()[1], 1e-8);
+
+  // Finite differences spend extra right-hand side evaluations
+  EXPECT_LT(analytic.stats.n_rhs_evals, numeric.stats.n_rhs_evals);
+}
+
+TEST_F(EulerBackwardTest, SparseAnalyticJacobian) {
+  // Nonlinear reaction-diffusion u_t = u_xx - u^3 on a periodic grid
+  const std::size_t n = 64;
+  const double dx = 1.0 / n;
+  auto f = [n, dx](double t [[maybe_unused]], std::span<const double> u,
+                   std::span<double> dudt) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const double left = u[(i + n - 1) % n];
+      const double right = u[(i + 1) % n];
+      dudt[i] = (left - 2.0 * u[i] + right) / (dx * dx) - u[i] * u[i] * u[i];
+    }
+  };
+
+  // Periodic tridiagonal pattern with corner entries
+  vanta::linear_solvers::SparsityPattern pattern;
+  pattern.n = n;
+  pattern.row_ptr.push_back(0);
+  for (std::size_t i = 0; i < n; ++i) {
+    std::vector<std::size_t> cols = {(i + n - 1) % n, i, (i + 1) % n};
+    std::sort(cols.begin(), cols.end());
+    pattern.col_idx.insert(pattern.col_idx.end(), cols.begin(), cols.end());
+    pattern.row_ptr.push_back(pattern.col_idx.size());
+  }
+
+  vanta::ode::EBOptions opts;
+  opts.sparsity = pattern;
+  opts.jacobian = [&pattern, dx](double t [[maybe_unused]],
+                                 std::span<const double> u,
+                                 std::span<double> values) {
+    for (std::size_t i = 0; i < pattern.n; ++i) {
+      for (std::size_t p = pattern.row_ptr[i]; p < pattern.row_ptr[i + 1];
+           ++p) {
+        values[p] = pattern.col_idx[p] == i
+                        ? -2.0 / (dx * dx) - 3.0 * u[i] * u[i]
+                        : 1.0 / (dx * dx);
+      }
+    }
+  };
+
+  std::vector<double> u0(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    u0[i] = 1.0 + std::cos(2.0 * M_PI * i * dx);
+  }
+
+  vanta::ode::Solution sparse =
+      vanta::ode::EulerBackward(f, 0.0, 0.05, u0, 0.001, opts);
+  vanta::ode::Solution dense =
+      vanta::ode::EulerBackward(f, 0.0, 0.05, u0, 0.001);
+
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_NEAR(sparse.Back()[i], dense.Back()[i], 1e-8);
+  }
+}
@@ -59,8 +59,8 @@ TEST_F(EulerForwardTest, ConstantFunction) {
   vanta::ode::Solution sol = vanta::ode::EulerForward(f, 0.0, 1.0, {5.0}, 0.1);
 
   // Verify solution remains constant
-  for (const auto& y_val : sol.y) {
-    EXPECT_NEAR(y_val[0], 5.0, kTolerance);
+  for (double y_val : sol.Col(0)) {
+    EXPECT_NEAR(y_val, 5.0, kTolerance);
   }
 }
 
@@ -74,7 +74,7 @@ TEST_F(EulerForwardTest, LinearFunction) {
   vanta::ode::Solution sol = vanta::ode::EulerForward(f, t0, t1, {0.0}, h);
 
   // y(t) = t, so y(1.0) should be approximately 1.0
-  EXPECT_NEAR(sol.y.back()[0], 1.0, kTolerance);
+  EXPECT_NEAR(sol.Back()[0], 1.0, kTolerance);
 }
 
 TEST_F(EulerForwardTest, ExponentialGrowth) {
@@ -89,7 +89,7 @@ TEST_F(EulerForwardTest, ExponentialGrowth) {
 
   // Exact solution: y(t) = e^t, so y(1) = e ≈ 2.71828
   double exact = std::exp(1.0);
-  EXPECT_NEAR(sol.y.back()[0], exact, 0.02);  // Euler approximation error
+  EXPECT_NEAR(sol.Back()[0], exact, 0.02);  // Euler approximation error
 }
 
 TEST_F(EulerForwardTest, MultiDimensionalSystem) {
@@ -106,15 +106,15 @@ TEST_F(EulerForwardTest, MultiDimensionalSystem) {
   vanta::ode::Solution sol = vanta::ode::EulerForward(f, t0, t1, y0, h);
 
   // Check solution dimensions
-  EXPECT_EQ(sol.y[0].size(), 2);
-  EXPECT_EQ(sol.y.back().size(), 2);
+  EXPECT_EQ(sol.Row(0).size(), 2);
+  EXPECT_EQ(sol.Back().size(), 2);
 
   // Exact solution: x(t) = cos(t), y(t) = -sin(t)
   double exact_x = std::cos(1.0);
   double exact_y = -std::sin(1.0);
 
-  EXPECT_NEAR(sol.y.back()[0], exact_x, 0.05);
-  EXPECT_NEAR(sol.y.back()[1], exact_y, 0.05);
+  EXPECT_NEAR(sol.Back()[0], exact_x, 0.05);
+  EXPECT_NEAR(sol.Back()[1], exact_y, 0.05);
 }
 
 TEST_F(EulerForwardTest, CorrectNumberOfSteps) {
@@ -128,7 +128,7 @@ TEST_F(EulerForwardTest, CorrectNumberOfSteps) {
 
   auto expected_steps = static_cast<int>(std::ceil((t1 - t0) / h));
   EXPECT_EQ(sol.t.size(), expected_steps + 1);
-  EXPECT_EQ(sol.y.size(), expected_steps + 1);
+  EXPECT_EQ(sol.NumSteps(), expected_steps + 1);
 }
 
 TEST_F(EulerForwardTest, TimeArrayCorrectness) {
@@ -171,7 +171,7 @@ TEST_F(EulerForwardTest, TimeDependentFunction) {
   vanta::ode::Solution sol = vanta::ode::EulerForward(f, t0, t1, {0.0}, h);
 
   // Exact solution: y(t) = t^2/2, so y(2) = 2
-  EXPECT_NEAR(sol.y.back()[0], 2.0, 0.01);
+  EXPECT_NEAR(sol.Back()[0], 2.0, 0.01);
 }
 
 TEST_F(EulerForwardTest, LargeStepSize) {
@@ -185,3 +185,17 @@ TEST_F(EulerForwardTest, LargeStepSize) {
 
   EXPECT_EQ(sol.t.size(), 2);  // One step plus initial
 }
+
+TEST_F(EulerForwardTest, FinalStateOnlyOutput) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y
+              [[maybe_unused]]) { return std::vector<double>{1.0}; };
+
+  vanta::ode::OutputOptions out;
+  out.stride = 0;
+  vanta::ode::Solution sol =
+      vanta::ode::EulerForward(f, 0.0, 1.0, {0.0}, 0.1, out);
+
+  ASSERT_EQ(sol.NumSteps(), 1);
+  EXPECT_NEAR(sol.t[0], 1.0, kTolerance);
+  EXPECT_NEAR(sol.Row(0)[0], 1.0, kTolerance);
+}
@@ -0,0 +1,209 @@
+#include "ode/events.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/bdf.hpp"
+#include "ode/dormand_prince_45.hpp"
+#include "ode/functor_solvers.hpp"
+#include "ode/interpolation.hpp"
+#include "ode/output.hpp"
+#include "ode/runge_kutta_4.hpp"
+
+class EventsTest : public ::testing::Test {
+ protected:
+  // Ball dropped from rest at height 10 under constant gravity
+  static void FallingBall(double t [[maybe_unused]], std::span<const double> y,
+                          std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -9.81;
+  }
+
+  // Harmonic oscillator with y(t) = (sin t, cos t) from t = 0
+  static void Oscillator(double t [[maybe_unused]], std::span<const double> y,
+                         std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0];
+  }
+
+  // Height above the ground
+  static double Height(double t [[maybe_unused]], std::span<const double> y) {
+    return y[0];
+  }
+};
+
+TEST_F(EventsTest, HermiteInterpolationIsExactForCubics) {
+  auto y = [](double t) { return t * t * t - 2.0 * t + 1.0; };
+  auto dy = [](double t) { return 3.0 * t * t - 2.0; };
+
+  std::vector<double> out(1);
+  vanta::ode::HermiteInterpolate(0.5, std::vector<double>{y(0.5)},
+                                 std::vector<double>{dy(0.5)}, 2.0,
+                                 std::vector<double>{y(2.0)},
+                                 std::vector<double>{dy(2.0)}, 1.3, out);
+  EXPECT_NEAR(out[0], y(1.3), 1e-14);
+}
+
+TEST_F(EventsTest, TerminalEventStopsIntegration) {
+  vanta::ode::OutputOptions out;
+  out.events.push_back({Height, true, -1});
+
+  vanta::ode::Solution sol = vanta::ode::RungeKutta4(
+      FallingBall, 0.0, 100.0, {10.0, 0.0}, 0.01, out);
+
+  // The interpolant is exact for the quadratic trajectory
+  const double t_hit = std::sqrt(2.0 * 10.0 / 9.81);
+  ASSERT_EQ(sol.events.size(), 1);
+  EXPECT_TRUE(sol.terminated);
+  EXPECT_EQ(sol.events[0].index, 0);
+  EXPECT_NEAR(sol.events[0].t, t_hit, 1e-12);
+  EXPECT_NEAR(sol.events[0].y[0], 0.0, 1e-12);
+  EXPECT_NEAR(sol.events[0].y[1], -9.81 * t_hit, 1e-10);
+
+  // Output ends at the event instead of at t1
+  EXPECT_EQ(sol.NumSteps(), 144);
+  EXPECT_DOUBLE_EQ(sol.t.back(), sol.events[0].t);
+  EXPECT_DOUBLE_EQ(sol.Back()[1], sol.events[0].y[1]);
+}
+
+TEST_F(EventsTest, NonTerminalEventsAreRecordedInOrder) {
+  vanta::ode::OutputOptions out;
+  out.events.push_back({Height});
+
+  vanta::ode::DP45Options opts;
+  opts.rtol = 1e-10;
+  opts.atol = 1e-12;
+  vanta::ode::Solution sol = vanta::ode::DormandPrince45(
+      Oscillator, 0.5, 10.0, {std::sin(0.5), std::cos(0.5)}, opts, out);
+
+  EXPECT_FALSE(sol.terminated);
+  EXPECT_DOUBLE_EQ(sol.t.back(), 10.0);
+  ASSERT_EQ(sol.events.size(), 3);
+  for (std::size_t i = 0; i < 3; ++i) {
+    EXPECT_NEAR(sol.events[i].t, (i + 1) * M_PI, 1e-6);
+  }
+
+  // The derivative is reused from the solver, so detection is free
+  EXPECT_EQ(sol.stats.n_rhs_evals, 6 * (sol.stats.n_accepted +
+                                        sol.stats.n_rejected) + 2);
+}
+
+TEST_F(EventsTest, DirectionFiltersCrossings) {
+  vanta::ode::OutputOptions out;
+  out.events.push_back({Height, false, 1});
+  out.events.push_back({Height, false, -1});
+
+  vanta::ode::Solution sol = vanta::ode::RungeKutta4(
+      Oscillator, 0.0, 7.0, {0.0, 1.0}, 0.01, out);
+
+  // The start at g = 0 is not a crossing
+  ASSERT_EQ(sol.events.size(), 2);
+  EXPECT_EQ(sol.events[0].index, 1);
+  EXPECT_NEAR(sol.events[0].t, M_PI, 1e-8);
+  EXPECT_EQ(sol.events[1].index, 0);
+  EXPECT_NEAR(sol.events[1].t, 2.0 * M_PI, 1e-8);
+}
+
+TEST_F(EventsTest, EarliestTerminalEventWins) {
+  // Non-terminal crossing at t = 1.5 and terminal crossings at t = 2.5 and
+  // t = 2.75, all inside one step
+  vanta::ode::OutputOptions out;
+  out.events.push_back(
+      {[](double t, std::span<const double>) { return t - 2.75; }, true});
+  out.events.push_back(
+      {[](double t, std::span<const double>) { return t - 1.5; }});
+  out.events.push_back(
+      {[](double t, std::span<const double>) { return t - 2.5; }, true});
+
+  auto f = [](double t [[maybe_unused]], std::span<const double> y,
+              std::span<double> dydt) { dydt[0] = y[0]; };
+  vanta::ode::Solution sol =
+      vanta::ode::RungeKutta4(f, 0.0, 10.0, {1.0}, 3.0, out);
+
+  ASSERT_EQ(sol.events.size(), 2);
+  EXPECT_EQ(sol.events[0].index, 1);
+  EXPECT_DOUBLE_EQ(sol.events[0].t, 1.5);
+  EXPECT_EQ(sol.events[1].index, 2);
+  EXPECT_DOUBLE_EQ(sol.events[1].t, 2.5);
+  EXPECT_TRUE(sol.terminated);
+  EXPECT_EQ(sol.t, (std::vector<double>{0.0, 2.5}));
+}
+
+TEST_F(EventsTest, EventOnStepEndIsReportedOnce) {
+  vanta::ode::OutputOptions out;
+  out.events.push_back(
+      {[](double t, std::span<const double>) { return t - 0.5; }});
+
+  auto f = [](double t [[maybe_unused]],
+              std::span<const double> y [[maybe_unused]],
+              std::span<double> dydt) { dydt[0] = 1.0; };
+  vanta::ode::Solution sol =
+      vanta::ode::RungeKutta4(f, 0.0, 1.0, {0.0}, 0.25, out);
+
+  ASSERT_EQ(sol.events.size(), 1);
+  EXPECT_DOUBLE_EQ(sol.events[0].t, 0.5);
+}
+
+TEST_F(EventsTest, TerminalEventInImplicitSolver) {
+  // Decay y' = -y reaches one half at t = ln 2
+  vanta::ode::OutputOptions out;
+  out.events.push_back(
+      {[](double t [[maybe_unused]], std::span<const double> y) {
+         return y[0] - 0.5;
+       },
+       true});
+  out.times = {0.5, 1.0};
+
+  auto f = [](double t [[maybe_unused]], std::span<const double> y,
+              std::span<double> dydt) { dydt[0] = -y[0]; };
+  vanta::ode::Solution sol = vanta::ode::BDF(f, 0.0, 10.0, {1.0}, {}, out);
+
+  ASSERT_EQ(sol.events.size(), 1);
+  EXPECT_TRUE(sol.terminated);
+  EXPECT_NEAR(sol.events[0].t, std::log(2.0), 1e-4);
+  EXPECT_NEAR(sol.events[0].y[0], 0.5, 1e-12);
+
+  // Requested times after the event are not recorded
+  EXPECT_EQ(sol.t, (std::vector<double>{0.5}));
+}
+
+TEST_F(EventsTest, FunctorSolverWithFixedSizeState) {
+  vanta::ode::OutputOptions out;
+  out.events.push_back(
+      {[](double t [[maybe_unused]], std::span<const double> y) {
+         return y[0];
+       },
+       true});
+
+  auto f = [](double t [[maybe_unused]], const std::array<double, 2>& y,
+              std::array<double, 2>& dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -9.81;
+  };
+  vanta::ode::Solution sol = vanta::ode::RungeKutta4(
+      f, 0.0, 100.0, std::array<double, 2>{10.0, 0.0}, 0.01, out);
+
+  ASSERT_EQ(sol.events.size(), 1);
+  EXPECT_NEAR(sol.events[0].t, std::sqrt(2.0 * 10.0 / 9.81), 1e-12);
+}
+
+TEST_F(EventsTest, EventsRequireRightHandSide) {
+  vanta::ode::OutputOptions out;
+  out.events.push_back({Height});
+
+  EXPECT_THROW(vanta::ode::OutputRecorder(out, 2), std::invalid_argument);
+}
+
+TEST_F(EventsTest, EventWithoutFunctionThrows) {
+  vanta::ode::OutputOptions out;
+  out.events.emplace_back();
+
+  EXPECT_THROW(vanta::ode::RungeKutta4(FallingBall, 0.0, 1.0, {10.0, 0.0},
+                                       0.1, out),
+               std::invalid_argument);
+}
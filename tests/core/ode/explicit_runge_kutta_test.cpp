@@ -0,0 +1,160 @@
+#include "ode/explicit_runge_kutta.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/runge_kutta_4.hpp"
+
+class ExplicitRungeKuttaTest : public ::testing::Test {
+ protected:
+  // y' = y cos t, with y(t) = exp(sin t) from y(0) = 1
+  static void Periodic(double t, std::span<const double> y,
+                       std::span<double> dydt) {
+    dydt[0] = y[0] * std::cos(t);
+  }
+
+  // Observed convergence order at t = 1 from step sizes h and h / 2
+  template <const auto& Tableau>
+  static double Order(double h) {
+    auto error = [](double step) {
+      vanta::ode::Solution sol = vanta::ode::ExplicitRungeKutta<Tableau>(
+          Periodic, 0.0, 1.0, std::vector<double>{1.0}, step);
+      return std::abs(sol.Back()[0] - std::exp(std::sin(1.0)));
+    };
+    return std::log2(error(h) / error(0.5 * h));
+  }
+};
+
+TEST_F(ExplicitRungeKuttaTest, TableauTraits) {
+  using RK4 = vanta::ode::TableauTraits<vanta::ode::kRungeKutta4Tableau>;
+  static_assert(RK4::kStages == 4);
+  static_assert(RK4::NumNonZeroA(2) == 1);
+  static_assert(RK4::NonZeroA<2>()[0] == 1);
+  static_assert(RK4::NumNonZeroB() == 4);
+
+  using DP5 = vanta::ode::TableauTraits<vanta::ode::kDormandPrince5Tableau>;
+  static_assert(DP5::NumNonZeroB() == 5);
+  static_assert(DP5::StageUsed(1));
+  static_assert(!DP5::StageUsed(6));
+
+  for (const auto& consistent :
+       {vanta::ode::TableauTraits<vanta::ode::kEulerTableau>::IsConsistent(),
+        vanta::ode::TableauTraits<vanta::ode::kHeunTableau>::IsConsistent(),
+        vanta::ode::TableauTraits<vanta::ode::kSSPRK3Tableau>::IsConsistent(),
+        RK4::IsConsistent(),
+        vanta::ode::TableauTraits<
+            vanta::ode::kRungeKutta38Tableau>::IsConsistent(),
+        DP5::IsConsistent()}) {
+    EXPECT_TRUE(consistent);
+  }
+}
+
+TEST_F(ExplicitRungeKuttaTest, ConvergenceOrders) {
+  EXPECT_NEAR(Order<vanta::ode::kEulerTableau>(0.001), 1.0, 0.05);
+  EXPECT_NEAR(Order<vanta::ode::kHeunTableau>(0.01), 2.0, 0.05);
+  EXPECT_NEAR(Order<vanta::ode::kSSPRK3Tableau>(0.01), 3.0, 0.05);
+  EXPECT_NEAR(Order<vanta::ode::kRungeKutta4Tableau>(0.05), 4.0, 0.1);
+  EXPECT_NEAR(Order<vanta::ode::kRungeKutta38Tableau>(0.02), 4.0, 0.1);
+  EXPECT_NEAR(Order<vanta::ode::kDormandPrince5Tableau>(0.1), 5.0, 0.2);
+}
+
+TEST_F(ExplicitRungeKuttaTest, MatchesHandWrittenRK4Step) {
+  std::vector<double> y_engine = {1.0};
+  std::vector<double> y_reference = {1.0};
+  vanta::ode::ExplicitRKWorkspace<std::vector<double>, 4> ws(y_engine);
+  vanta::ode::RK4Workspace rk4_ws(1);
+  vanta::ode::InPlaceRhs f = Periodic;
+
+  double t = 0.0;
+  for (int i = 0; i < 100; ++i, t += 0.1) {
+    vanta::ode::ExplicitRungeKuttaStep<vanta::ode::kRungeKutta4Tableau>(
+        f, t, y_engine, 0.1, y_engine, ws);
+    vanta::ode::RungeKutta4Step(f, t, y_reference, 0.1, y_reference, rk4_ws);
+  }
+  EXPECT_NEAR(y_engine[0], y_reference[0], 1e-13);
+}
+
+TEST_F(ExplicitRungeKuttaTest, UnusedStagesAreSkipped) {
+  int evals = 0;
+  auto f = [&evals](double t, const std::array<double, 1>& y,
+                    std::array<double, 1>& dydt) {
+    ++evals;
+    dydt[0] = y[0] * std::cos(t);
+  };
+
+  vanta::ode::ExplicitRungeKutta<vanta::ode::kDormandPrince5Tableau>(
+      f, 0.0, 1.0, std::array<double, 1>{1.0}, 0.1);
+
+  // Six of the seven stages per step
+  EXPECT_EQ(evals, 60);
+}
+
+TEST_F(ExplicitRungeKuttaTest, FixedSizeStateMatchesVector) {
+  auto f = [](double t [[maybe_unused]], const std::array<double, 2>& y,
+              std::array<double, 2>& dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0];
+  };
+
+  vanta::ode::Solution fixed =
+      vanta::ode::ExplicitRungeKutta<vanta::ode::kSSPRK3Tableau>(
+          f, 0.0, 2.0, std::array<double, 2>{1.0, 0.0}, 0.01);
+  vanta::ode::Solution dynamic =
+      vanta::ode::ExplicitRungeKutta<vanta::ode::kSSPRK3Tableau>(
+          [](double t [[maybe_unused]], std::span<const double> y,
+             std::span<double> dydt) {
+            dydt[0] = y[1];
+            dydt[1] = -y[0];
+          },
+          0.0, 2.0, std::vector<double>{1.0, 0.0}, 0.01);
+
+  ASSERT_EQ(fixed.NumSteps(), dynamic.NumSteps());
+  for (std::size_t i = 0; i < fixed.y.size(); ++i) {
+    EXPECT_DOUBLE_EQ(fixed.y[i], dynamic.y[i]);
+  }
+  EXPECT_NEAR(fixed.Back()[0], std::cos(2.0), 1e-6);
+}
+
+TEST_F(ExplicitRungeKuttaTest, FloatStateKeepsDoubleTimeGrid) {
+  auto periodic = [](double t, std::span<const float> y,
+                     std::span<float> dydt) {
+    dydt[0] = y[0] * static_cast<float>(std::cos(t));
+  };
+  vanta::ode::BasicSolution<float> single =
+      vanta::ode::ExplicitRungeKutta<vanta::ode::kRungeKutta4Tableau>(
+          periodic, 0.0, 1.0, std::vector<float>{1.0f}, 1e-4);
+  vanta::ode::Solution reference =
+      vanta::ode::ExplicitRungeKutta<vanta::ode::kRungeKutta4Tableau>(
+          Periodic, 0.0, 1.0, std::vector<double>{1.0}, 1e-4);
+
+  // Time is accumulated in double whatever the state precision
+  EXPECT_EQ(single.t, reference.t);
+  EXPECT_NEAR(single.Back()[0], std::exp(std::sin(1.0)), 1e-4);
+
+  // A fixed-size float state gives the same stages as a vector one
+  auto oscillator = [](double t [[maybe_unused]],
+                       const std::array<float, 2>& y,
+                       std::array<float, 2>& dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0];
+  };
+  vanta::ode::BasicSolution<float> fixed =
+      vanta::ode::ExplicitRungeKutta<vanta::ode::kRungeKutta4Tableau>(
+          oscillator, 0.0, 2.0, std::array<float, 2>{1.0f, 0.0f}, 0.01);
+  EXPECT_NEAR(fixed.Back()[0], std::cos(2.0), 1e-5);
+  EXPECT_NEAR(fixed.Back()[1], -std::sin(2.0), 1e-5);
+}
+
+TEST_F(ExplicitRungeKuttaTest, InvalidArguments) {
+  EXPECT_THROW(vanta::ode::ExplicitRungeKutta<vanta::ode::kHeunTableau>(
+                   Periodic, 0.0, 1.0, std::vector<double>{1.0}, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::ExplicitRungeKutta<vanta::ode::kHeunTableau>(
+                   Periodic, 1.0, 0.0, std::vector<double>{1.0}, 0.1),
+               std::invalid_argument);
+}
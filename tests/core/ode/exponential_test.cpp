@@ -0,0 +1,204 @@
+#include "ode/exponential.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/bdf.hpp"
+#include "ode/dormand_prince_45.hpp"
+
+namespace {
+
+// Rotation with damping, L = [[-1, 2], [-2, -1]]
+const std::vector<double> kRotation = {-1.0, 2.0, -2.0, -1.0};
+
+// Smooth nonlinear forcing for the rotation
+void Forcing(double t, std::span<const double> y, std::span<double> ny) {
+  ny[0] = std::sin(t) - y[1] * y[1];
+  ny[1] = y[0] * y[1];
+}
+
+// Allen–Cahn equation u_t = 0.01 u_xx + u - u^3 on (0, 1) with zero
+// boundary values, discretised on n interior points. The diffusion goes
+// into the linear part, whose stiffness grows as n^2
+std::vector<double> Laplacian(std::size_t n) {
+  const double dx = 1.0 / static_cast<double>(n + 1);
+  const double c = 0.01 / (dx * dx);
+  std::vector<double> l(n * n, 0.0);
+  for (std::size_t i = 0; i < n; ++i) {
+    l[i * n + i] = -2.0 * c;
+    if (i > 0) l[i * n + i - 1] = c;
+    if (i + 1 < n) l[i * n + i + 1] = c;
+  }
+  return l;
+}
+
+void Reaction(double t [[maybe_unused]], std::span<const double> y,
+              std::span<double> ny) {
+  for (std::size_t i = 0; i < y.size(); ++i) ny[i] = y[i] - y[i] * y[i] * y[i];
+}
+
+// Full right-hand side of the forced rotation
+void FullRotation(double t, std::span<const double> y, std::span<double> dydt) {
+  Forcing(t, y, dydt);
+  dydt[0] += -y[0] + 2.0 * y[1];
+  dydt[1] += -2.0 * y[0] - y[1];
+}
+
+// Tight Dormand–Prince reference of the forced rotation at t1
+std::vector<double> RotationReference(double t1) {
+  vanta::ode::DP45Options opts;
+  opts.rtol = 1e-13;
+  opts.atol = 1e-13;
+  vanta::ode::Solution sol = vanta::ode::DormandPrince45(
+      vanta::ode::InPlaceRhs(FullRotation), 0.0, t1, {0.5, 0.2}, opts);
+  return {sol.Back().begin(), sol.Back().end()};
+}
+
+// Error at t = 1 of the forced rotation against a tight reference
+template <typename Method>
+double RotationError(Method method, double h) {
+  const std::vector<double> reference = RotationReference(1.0);
+  vanta::ode::Solution sol =
+      method(kRotation, vanta::ode::InPlaceRhs(Forcing), 0.0, 1.0,
+             std::vector<double>{0.5, 0.2}, h, vanta::ode::OutputOptions{});
+  return std::hypot(sol.Back()[0] - reference[0],
+                    sol.Back()[1] - reference[1]);
+}
+
+}  // namespace
+
+TEST(ExponentialTest, LinearProblemIsExact) {
+  // Without a nonlinear part both methods propagate with e^{hL}, which for
+  // the rotation is e^{-t} times a rotation by 2t
+  auto zero = [](double t [[maybe_unused]],
+                 std::span<const double> y [[maybe_unused]],
+                 std::span<double> ny) { ny[0] = ny[1] = 0.0; };
+  const double t1 = 3.0;
+  const double x = std::exp(-t1) * std::cos(2.0 * t1);
+  const double z = -std::exp(-t1) * std::sin(2.0 * t1);
+  for (auto method : {vanta::ode::ExponentialEuler, vanta::ode::ETDRK4}) {
+    vanta::ode::Solution sol = method(
+        kRotation, vanta::ode::InPlaceRhs(zero), 0.0, t1, {1.0, 0.0}, 1.5, {});
+    ASSERT_EQ(sol.NumSteps(), 3u);
+    EXPECT_NEAR(sol.Back()[0], x, 1e-14);
+    EXPECT_NEAR(sol.Back()[1], z, 1e-14);
+  }
+}
+
+TEST(ExponentialTest, ConvergenceOrders) {
+  // Halving h divides the error by 2^p
+  const double euler_ratio = RotationError(vanta::ode::ExponentialEuler,
+                                           0.02) /
+                             RotationError(vanta::ode::ExponentialEuler, 0.01);
+  EXPECT_NEAR(euler_ratio, 2.0, 0.1);
+
+  const double etd_ratio = RotationError(vanta::ode::ETDRK4, 0.1) /
+                           RotationError(vanta::ode::ETDRK4, 0.05);
+  EXPECT_GT(etd_ratio, 12.0);
+  EXPECT_LT(RotationError(vanta::ode::ETDRK4, 0.05), 1e-7);
+}
+
+TEST(ExponentialTest, StiffAllenCahnWithLargeSteps) {
+  const std::size_t n = 63;
+  const std::vector<double> l = Laplacian(n);
+  std::vector<double> y0(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double x = static_cast<double>(i + 1) / static_cast<double>(n + 1);
+    y0[i] = 0.5 * std::sin(3.0 * M_PI * x) + 0.2 * std::sin(M_PI * x);
+  }
+
+  vanta::ode::BDFOptions opts;
+  opts.rtol = 1e-10;
+  opts.atol = 1e-12;
+  vanta::ode::Solution reference = vanta::ode::BDF(
+      vanta::ode::InPlaceRhs([&l, n](double t, std::span<const double> y,
+                                     std::span<double> dydt) {
+        Reaction(t, y, dydt);
+        for (std::size_t i = 0; i < n; ++i) {
+          for (std::size_t j = 0; j < n; ++j) dydt[i] += l[i * n + j] * y[j];
+        }
+      }),
+      0.0, 2.0, y0, opts);
+
+  // h |lambda_max| is about 80, far beyond any explicit stability region
+  vanta::ode::Solution sol = vanta::ode::ETDRK4(
+      l, vanta::ode::InPlaceRhs(Reaction), 0.0, 2.0, y0, 0.05);
+  EXPECT_EQ(sol.stats.n_accepted, 40u);
+  EXPECT_EQ(sol.stats.n_rhs_evals, 160u);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_NEAR(sol.Back()[i], reference.Back()[i], 1e-5);
+  }
+
+  vanta::ode::Solution euler = vanta::ode::ExponentialEuler(
+      l, vanta::ode::InPlaceRhs(Reaction), 0.0, 2.0, y0, 0.05);
+  EXPECT_EQ(euler.stats.n_rhs_evals, 40u);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_TRUE(std::isfinite(euler.Back()[i]));
+    EXPECT_NEAR(euler.Back()[i], reference.Back()[i], 5e-2);
+  }
+}
+
+TEST(ExponentialTest, DiagonalLinearPart) {
+  // Decoupled decay rates from 1 to 1e6 with forcing cos(t), whose exact
+  // solution is y_i = (lambda_i cos t + sin t) / (1 + lambda_i^2) plus a
+  // decaying transient
+  const std::vector<double> rates = {1.0, 1e2, 1e4, 1e6};
+  const std::size_t n = rates.size();
+  std::vector<double> l(n * n, 0.0);
+  for (std::size_t i = 0; i < n; ++i) l[i * n + i] = -rates[i];
+  auto forcing = [](double t, std::span<const double> y,
+                    std::span<double> ny) {
+    for (std::size_t i = 0; i < y.size(); ++i) ny[i] = std::cos(t);
+  };
+
+  const std::vector<double> y0(n, 0.0);
+  vanta::ode::Solution sol = vanta::ode::ETDRK4(
+      l, vanta::ode::InPlaceRhs(forcing), 0.0, 2.0, y0, 0.01);
+  const double t = 2.0;
+  for (std::size_t i = 0; i < n; ++i) {
+    const double lambda = rates[i];
+    const double exact =
+        (lambda * std::cos(t) + std::sin(t) - lambda * std::exp(-lambda * t)) /
+        (1.0 + lambda * lambda);
+    EXPECT_NEAR(sol.Back()[i], exact, 1e-10 * std::max(1.0, std::abs(exact)));
+  }
+
+  // The same system with a coupling of zero strength takes the dense path
+  // and agrees to rounding
+  l[n - 1] = -0.0;
+  l[1] = 1e-300;
+  vanta::ode::Solution dense = vanta::ode::ETDRK4(
+      l, vanta::ode::InPlaceRhs(forcing), 0.0, 2.0, y0, 0.01);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_NEAR(dense.Back()[i], sol.Back()[i], 1e-12);
+  }
+}
+
+TEST(ExponentialTest, DenseOutputUsesFullRightHandSide) {
+  // Dense output interpolates with derivatives of L y + N(t, y)
+  vanta::ode::OutputOptions out;
+  out.dense = true;
+  vanta::ode::Solution sol = vanta::ode::ETDRK4(
+      kRotation, vanta::ode::InPlaceRhs(Forcing), 0.0, 1.0, {0.5, 0.2}, 0.01,
+      out);
+  EXPECT_GT(sol.stats.n_rhs_evals, 4 * sol.stats.n_accepted);
+  const std::vector<double> reference = RotationReference(0.7525);
+  const std::vector<double> y = sol.At(0.7525);
+  EXPECT_NEAR(y[0], reference[0], 1e-8);
+  EXPECT_NEAR(y[1], reference[1], 1e-8);
+}
+
+TEST(ExponentialTest, InvalidArguments) {
+  const vanta::ode::InPlaceRhs f(Forcing);
+  EXPECT_THROW(
+      vanta::ode::ExponentialEuler(kRotation, f, 0.0, 1.0, {1.0, 0.0}, 0.0),
+      std::invalid_argument);
+  EXPECT_THROW(vanta::ode::ETDRK4(kRotation, f, 1.0, 0.0, {1.0, 0.0}, 0.1),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::ETDRK4({-1.0}, f, 0.0, 1.0, {1.0, 0.0}, 0.1),
+               std::invalid_argument);
+}
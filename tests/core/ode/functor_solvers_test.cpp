@@ -0,0 +1,101 @@
+#include "ode/functor_solvers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include "ode/euler_forward.hpp"
+#include "ode/runge_kutta_4.hpp"
+
+namespace {
+
+// Mass-spring-damper right-hand side with a fixed-size state
+struct MassSpringDamper {
+  double k = 0.2;
+  double c = 0.2;
+
+  void operator()(double t [[maybe_unused]], const std::array<double, 2>& y,
+                  std::array<double, 2>& dydt) const {
+    dydt[0] = y[1];
+    dydt[1] = -c * y[1] - k * y[0];
+  }
+};
+
+// Same system in the vector-returning form used by the std::function solvers
+std::vector<double> MassSpringDamperVec(const double& t [[maybe_unused]],
+                                        const std::vector<double>& y) {
+  return {y[1], -0.2 * y[1] - 0.2 * y[0]};
+}
+
+}  // namespace
+
+class FunctorSolversTest : public ::testing::Test {
+ protected:
+  // Allowed numerical tolerance for solution comparisons
+  const double kTolerance = 1e-12;
+};
+
+TEST_F(FunctorSolversTest, InvalidArguments) {
+  std::array<double, 2> y0 = {1.0, 0.0};
+
+  EXPECT_THROW(
+      { vanta::ode::RungeKutta4(MassSpringDamper{}, 0.0, 1.0, y0, 0.0); },
+      std::invalid_argument);
+  EXPECT_THROW(
+      { vanta::ode::EulerForward(MassSpringDamper{}, 1.0, 0.0, y0, 0.1); },
+      std::invalid_argument);
+}
+
+TEST_F(FunctorSolversTest, FixedSizeRungeKutta4MatchesStdFunction) {
+  std::array<double, 2> y0 = {1.0, 0.0};
+
+  vanta::ode::Solution sol =
+      vanta::ode::RungeKutta4(MassSpringDamper{}, 0.0, 20.0, y0, 0.1);
+  vanta::ode::Solution reference =
+      vanta::ode::RungeKutta4(MassSpringDamperVec, 0.0, 20.0, {1.0, 0.0}, 0.1);
+
+  ASSERT_EQ(sol.NumSteps(), reference.NumSteps());
+  EXPECT_EQ(sol.NumStates(), 2);
+  for (size_t i = 0; i < sol.y.size(); ++i) {
+    EXPECT_NEAR(sol.y[i], reference.y[i], kTolerance);
+  }
+}
+
+TEST_F(FunctorSolversTest, FixedSizeEulerForwardMatchesStdFunction) {
+  std::array<double, 2> y0 = {1.0, 0.0};
+
+  vanta::ode::Solution sol =
+      vanta::ode::EulerForward(MassSpringDamper{}, 0.0, 20.0, y0, 0.1);
+  vanta::ode::Solution reference =
+      vanta::ode::EulerForward(MassSpringDamperVec, 0.0, 20.0, {1.0, 0.0}, 0.1);
+
+  ASSERT_EQ(sol.NumSteps(), reference.NumSteps());
+  for (size_t i = 0; i < sol.y.size(); ++i) {
+    EXPECT_NEAR(sol.y[i], reference.y[i], kTolerance);
+  }
+}
+
+TEST_F(FunctorSolversTest, LambdaWithVectorState) {
+  auto f = [](double t [[maybe_unused]], const std::vector<double>& y,
+              std::vector<double>& dydt) { dydt[0] = -y[0]; };
+  std::vector<double> y0 = {1.0};
+
+  vanta::ode::Solution sol = vanta::ode::RungeKutta4(f, 0.0, 1.0, y0, 0.01);
+
+  EXPECT_NEAR(sol.Back()[0], std::exp(-1.0), 1e-9);
+}
+
+TEST_F(FunctorSolversTest, OutputOptionsAreApplied) {
+  std::array<double, 2> y0 = {1.0, 0.0};
+
+  vanta::ode::OutputOptions out;
+  out.stride = 0;
+  vanta::ode::Solution sol =
+      vanta::ode::RungeKutta4(MassSpringDamper{}, 0.0, 20.0, y0, 0.1, out);
+
+  EXPECT_EQ(sol.NumSteps(), 1);
+  EXPECT_NEAR(sol.t[0], 20.0, 1e-9);
+}
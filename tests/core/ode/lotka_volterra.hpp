@@ -0,0 +1,47 @@
+#ifndef TESTS_CORE_ODE_LOTKA_VOLTERRA_HPP_
+#define TESTS_CORE_ODE_LOTKA_VOLTERRA_HPP_
+
+// Lotka–Volterra model shared by the forward and adjoint sensitivity tests
+
+#include <gtest/gtest.h>
+
+#include <span>
+#include <vector>
+
+class LotkaVolterraTest : public ::testing::Test {
+ protected:
+  // Lotka–Volterra predator–prey model with parameters (a, b, c, d)
+  static void LotkaVolterra(double t [[maybe_unused]],
+                            std::span<const double> y,
+                            std::span<const double> p,
+                            std::span<double> dydt) {
+    dydt[0] = p[0] * y[0] - p[1] * y[0] * y[1];
+    dydt[1] = p[3] * y[0] * y[1] - p[2] * y[1];
+  }
+  static void JacobianY(double t [[maybe_unused]], std::span<const double> y,
+                        std::span<const double> p, std::span<double> jac) {
+    jac[0] = p[0] - p[1] * y[1];
+    jac[1] = -p[1] * y[0];
+    jac[2] = p[3] * y[1];
+    jac[3] = p[3] * y[0] - p[2];
+  }
+  static void JacobianP(double t [[maybe_unused]], std::span<const double> y,
+                        std::span<const double> p [[maybe_unused]],
+                        std::span<double> jac) {
+    jac[0] = y[0];
+    jac[1] = -y[0] * y[1];
+    jac[2] = 0.0;
+    jac[3] = 0.0;
+    jac[4] = 0.0;
+    jac[5] = 0.0;
+    jac[6] = -y[1];
+    jac[7] = y[0] * y[1];
+  }
+
+  static constexpr double kT1 = 5.0;
+  static constexpr double kH = 0.05;
+  inline static const std::vector<double> kY0 = {1.0, 0.5};
+  inline static const std::vector<double> kP = {1.1, 0.4, 0.4, 0.1};
+};
+
+#endif  // TESTS_CORE_ODE_LOTKA_VOLTERRA_HPP_
@@ -0,0 +1,118 @@
+#include "ode/mapped_trajectory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ode/runge_kutta_4.hpp"
+
+class MappedTrajectoryTest : public ::testing::Test {
+ protected:
+  // Harmonic oscillator x'' = -x
+  static void Oscillator(double t [[maybe_unused]], std::span<const double> y,
+                         std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0];
+  }
+
+  // Temporary file used for testing trajectory storage
+  const std::string test_file_ = "test_trajectory.traj";
+
+  // Remove the test file after each test
+  void TearDown() override { std::filesystem::remove(test_file_); }
+};
+
+TEST_F(MappedTrajectoryTest, WriterMatchesInMemorySolution) {
+  // A small capacity makes the file grow several times during the run
+  vanta::ode::Solution reference;
+  {
+    vanta::ode::MappedTrajectory traj =
+        vanta::ode::MappedTrajectory::Create(test_file_, 2, 3);
+    vanta::ode::OutputOptions out;
+    out.observer = traj.Writer();
+    out.store = false;
+    vanta::ode::RungeKutta4(vanta::ode::InPlaceRhs(Oscillator), 0.0, 5.0,
+                            {1.0, 0.0}, 0.01, out);
+    reference = vanta::ode::RungeKutta4(vanta::ode::InPlaceRhs(Oscillator),
+                                        0.0, 5.0, {1.0, 0.0}, 0.01);
+
+    ASSERT_TRUE(traj.IsWritable());
+    ASSERT_EQ(traj.NumSteps(), reference.NumSteps());
+    EXPECT_EQ(traj.NumStates(), 2u);
+    EXPECT_DOUBLE_EQ(traj.Back()[0], reference.Back()[0]);
+  }
+
+  // Reopened read-only, the samples are read in place
+  vanta::ode::MappedTrajectory traj =
+      vanta::ode::MappedTrajectory::Open(test_file_);
+  EXPECT_FALSE(traj.IsWritable());
+  ASSERT_EQ(traj.NumSteps(), reference.NumSteps());
+  for (std::size_t i = 0; i < traj.NumSteps(); ++i) {
+    EXPECT_EQ(traj.Times()[i], reference.t[i]);
+    EXPECT_EQ(traj.Row(i)[0], reference.Row(i)[0]);
+    EXPECT_EQ(traj.Row(i)[1], reference.Row(i)[1]);
+  }
+  std::size_t i = 0;
+  for (double v : traj.Col(1)) EXPECT_EQ(v, reference.Row(i++)[1]);
+  EXPECT_EQ(i, reference.NumSteps());
+}
+
+TEST_F(MappedTrajectoryTest, InterpolatesLikeSolution) {
+  vanta::ode::Solution reference = vanta::ode::RungeKutta4(
+      vanta::ode::InPlaceRhs(Oscillator), 0.0, 2.0, {1.0, 0.0}, 0.1);
+  {
+    vanta::ode::MappedTrajectory traj =
+        vanta::ode::MappedTrajectory::Create(test_file_, 2);
+    for (std::size_t i = 0; i < reference.NumSteps(); ++i) {
+      traj.Append(reference.t[i], reference.Row(i));
+    }
+  }
+
+  vanta::ode::MappedTrajectory traj =
+      vanta::ode::MappedTrajectory::Open(test_file_);
+  for (double s : {0.0, 0.05, 0.73, 1.999, 2.0}) {
+    const std::vector<double> expected = reference.At(s);
+    const std::vector<double> y = traj.At(s);
+    EXPECT_DOUBLE_EQ(y[0], expected[0]);
+    EXPECT_DOUBLE_EQ(y[1], expected[1]);
+    EXPECT_NEAR(y[0], std::cos(s), 1e-4);
+  }
+  const std::vector<double> times = {1.5, 0.25};
+  vanta::ode::Solution samples = traj.Sample(times);
+  EXPECT_EQ(samples.t, times);
+  EXPECT_DOUBLE_EQ(samples.Row(0)[0], reference.At(1.5)[0]);
+  EXPECT_THROW(traj.At(2.5), std::invalid_argument);
+}
+
+TEST_F(MappedTrajectoryTest, InvalidUse) {
+  EXPECT_THROW(vanta::ode::MappedTrajectory::Create(test_file_, 0),
+               std::invalid_argument);
+  {
+    vanta::ode::MappedTrajectory traj =
+        vanta::ode::MappedTrajectory::Create(test_file_, 2);
+    EXPECT_THROW(traj.Append(0.0, std::vector<double>{1.0}),
+                 std::invalid_argument);
+    traj.Append(0.0, std::vector<double>{1.0, 2.0});
+  }
+
+  vanta::ode::MappedTrajectory traj =
+      vanta::ode::MappedTrajectory::Open(test_file_);
+  EXPECT_THROW(traj.Append(1.0, std::vector<double>{1.0, 2.0}),
+               std::runtime_error);
+
+  // Missing and foreign files are rejected
+  EXPECT_THROW(vanta::ode::MappedTrajectory::Open("missing.traj"),
+               std::runtime_error);
+  {
+    std::ofstream file(test_file_, std::ios::binary | std::ios::trunc);
+    file << std::string(256, 'x');
+  }
+  EXPECT_THROW(vanta::ode::MappedTrajectory::Open(test_file_),
+               std::runtime_error);
+}
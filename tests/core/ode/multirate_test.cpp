@@ -0,0 +1,107 @@
+#include "ode/multirate.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/runge_kutta_4.hpp"
+
+class MultirateTest : public ::testing::Test {
+ protected:
+  // Fast state y[1] relaxing quickly towards the slow state y[0], which
+  // oscillates slowly with a weak pull from the fast state
+  static void Fast(double t [[maybe_unused]], std::span<const double> y,
+                   std::span<double> dydt) {
+    dydt[0] = -50.0 * (y[1] - std::sin(y[0]));
+  }
+  static void Slow(double t, std::span<const double> y,
+                   std::span<double> dydt) {
+    dydt[0] = std::cos(t) - 0.1 * y[0] + 0.2 * y[1];
+  }
+
+  // Full system, for single-rate reference solutions
+  static void Full(double t, std::span<const double> y,
+                   std::span<double> dydt) {
+    Slow(t, y, dydt.subspan(0, 1));
+    Fast(t, y, dydt.subspan(1, 1));
+  }
+
+  // Final-state error against a fine single-rate reference
+  static double Error(double h) {
+    vanta::ode::Solution sol = vanta::ode::MultirateRungeKutta4(
+        Fast, Slow, {1}, 0.0, 2.0, {0.5, 0.0}, h);
+    vanta::ode::Solution reference =
+        vanta::ode::RungeKutta4(Full, 0.0, 2.0, {0.5, 0.0}, 1e-4);
+    return std::max(std::abs(sol.Back()[0] - reference.Back()[0]),
+                    std::abs(sol.Back()[1] - reference.Back()[1]));
+  }
+};
+
+TEST_F(MultirateTest, InvalidArguments) {
+  vanta::ode::MultirateOptions odd;
+  odd.substeps = 3;
+
+  EXPECT_THROW(vanta::ode::MultirateRungeKutta4(Fast, Slow, {1}, 0.0, 1.0,
+                                                {0.5, 0.0}, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::MultirateRungeKutta4(Fast, Slow, {1}, 0.0, 1.0,
+                                                {0.5, 0.0}, 0.1, odd),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::MultirateRungeKutta4(Fast, Slow, {2}, 0.0, 1.0,
+                                                {0.5, 0.0}, 0.1),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::MultirateRungeKutta4(Fast, Slow, {1, 1}, 0.0, 1.0,
+                                                {0.5, 0.0}, 0.1),
+               std::invalid_argument);
+}
+
+TEST_F(MultirateTest, SlowRhsEvaluatedFourTimesPerMacroStep) {
+  vanta::ode::MultirateOptions opts;
+  opts.substeps = 20;
+  vanta::ode::Solution sol = vanta::ode::MultirateRungeKutta4(
+      Fast, Slow, {1}, 0.0, 1.0, {0.5, 0.0}, 0.1, opts);
+
+  ASSERT_EQ(sol.NumSteps(), 11);
+  EXPECT_EQ(sol.NumStates(), 2);
+  EXPECT_EQ(sol.stats.n_accepted, 10);
+  EXPECT_EQ(sol.stats.n_rhs_evals, 40);
+  EXPECT_EQ(sol.stats.n_fast_rhs_evals, 800);
+}
+
+TEST_F(MultirateTest, AccurateWhereSingleRateStepIsUnstable) {
+  // The fast rate 50 makes single-rate RK4 unstable at h = 0.1
+  vanta::ode::Solution single =
+      vanta::ode::RungeKutta4(Full, 0.0, 2.0, {0.5, 0.0}, 0.1);
+  EXPECT_FALSE(std::abs(single.Back()[1]) < 10.0);
+
+  EXPECT_LT(Error(0.1), 1e-3);
+}
+
+TEST_F(MultirateTest, ThirdOrderCoupling) {
+  EXPECT_GT(std::log2(Error(0.1) / Error(0.05)), 2.8);
+}
+
+TEST_F(MultirateTest, UncoupledPartitionsMatchSingleRateRK4) {
+  // With no coupling each partition is plain RK4 at its own step size
+  auto fast = [](double t, std::span<const double> y [[maybe_unused]],
+                 std::span<double> dydt) { dydt[0] = std::cos(10.0 * t); };
+  auto slow = [](double t [[maybe_unused]], std::span<const double> y,
+                 std::span<double> dydt) { dydt[0] = -y[1]; };
+
+  vanta::ode::MultirateOptions opts;
+  opts.substeps = 4;
+  vanta::ode::Solution sol = vanta::ode::MultirateRungeKutta4(
+      fast, slow, {0}, 0.0, 1.0, {0.0, 1.0}, 0.1, opts);
+
+  vanta::ode::Solution fast_ref =
+      vanta::ode::RungeKutta4(fast, 0.0, 1.0, {0.0}, 0.025);
+  vanta::ode::Solution slow_ref = vanta::ode::RungeKutta4(
+      [](double t [[maybe_unused]], std::span<const double> y,
+         std::span<double> dydt) { dydt[0] = -y[0]; },
+      0.0, 1.0, {1.0}, 0.1);
+  EXPECT_NEAR(sol.Back()[0], fast_ref.Back()[0], 1e-14);
+  EXPECT_NEAR(sol.Back()[1], slow_ref.Back()[0], 1e-14);
+}
@@ -0,0 +1,167 @@
+#include "ode/output.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/runge_kutta_4.hpp"
+
+class OutputRecorderTest : public ::testing::Test {
+ protected:
+  // Feed the recorder ten unit steps of y = (t, -t) starting from t = 0
+  vanta::ode::Solution Run(const vanta::ode::OutputOptions& opts) {
+    vanta::ode::OutputRecorder recorder(opts, 2, 10);
+    recorder.Start(0.0, std::vector<double>{0.0, 0.0});
+    for (int i = 1; i <= 10; ++i) {
+      const double t = static_cast<double>(i);
+      recorder.Step(t, std::vector<double>{t, -t});
+    }
+    return recorder.Finish();
+  }
+};
+
+TEST_F(OutputRecorderTest, DefaultStoresEveryStep) {
+  vanta::ode::Solution sol = Run({});
+
+  ASSERT_EQ(sol.NumSteps(), 11);
+  EXPECT_EQ(sol.NumStates(), 2);
+  for (size_t i = 0; i < sol.NumSteps(); ++i) {
+    EXPECT_DOUBLE_EQ(sol.t[i], static_cast<double>(i));
+    EXPECT_DOUBLE_EQ(sol.Row(i)[1], -static_cast<double>(i));
+  }
+}
+
+TEST_F(OutputRecorderTest, StrideKeepsEveryNthStepAndFinalStep) {
+  vanta::ode::OutputOptions opts;
+  opts.stride = 4;
+  vanta::ode::Solution sol = Run(opts);
+
+  EXPECT_EQ(sol.t, (std::vector<double>{0.0, 4.0, 8.0, 10.0}));
+  EXPECT_DOUBLE_EQ(sol.Back()[0], 10.0);
+}
+
+TEST_F(OutputRecorderTest, StrideDividingStepCountDoesNotDuplicateFinal) {
+  vanta::ode::OutputOptions opts;
+  opts.stride = 5;
+  vanta::ode::Solution sol = Run(opts);
+
+  EXPECT_EQ(sol.t, (std::vector<double>{0.0, 5.0, 10.0}));
+}
+
+TEST_F(OutputRecorderTest, ZeroStrideKeepsOnlyFinalState) {
+  vanta::ode::OutputOptions opts;
+  opts.stride = 0;
+  vanta::ode::Solution sol = Run(opts);
+
+  ASSERT_EQ(sol.NumSteps(), 1);
+  EXPECT_DOUBLE_EQ(sol.t[0], 10.0);
+  EXPECT_DOUBLE_EQ(sol.Row(0)[0], 10.0);
+  EXPECT_DOUBLE_EQ(sol.Row(0)[1], -10.0);
+}
+
+TEST_F(OutputRecorderTest, OutputTimesAreInterpolated) {
+  vanta::ode::OutputOptions opts;
+  opts.times = {-1.0, 0.0, 2.5, 3.0, 9.75, 12.0};
+  vanta::ode::Solution sol = Run(opts);
+
+  // Times outside [0, 10] are dropped
+  ASSERT_EQ(sol.t, (std::vector<double>{0.0, 2.5, 3.0, 9.75}));
+  EXPECT_DOUBLE_EQ(sol.Row(1)[0], 2.5);
+  EXPECT_DOUBLE_EQ(sol.Row(1)[1], -2.5);
+  EXPECT_DOUBLE_EQ(sol.Row(3)[0], 9.75);
+}
+
+TEST_F(OutputRecorderTest, UnsortedOutputTimesThrow) {
+  vanta::ode::OutputOptions opts;
+  opts.times = {1.0, 0.5};
+
+  EXPECT_THROW({ vanta::ode::OutputRecorder recorder(opts, 1); },
+               std::invalid_argument);
+}
+
+TEST_F(OutputRecorderTest, ObserverReceivesSamplesWithoutStoring) {
+  std::vector<double> seen_t;
+  std::vector<double> seen_y;
+
+  vanta::ode::OutputOptions opts;
+  opts.stride = 5;
+  opts.store = false;
+  opts.observer = [&](double t, std::span<const double> y) {
+    seen_t.push_back(t);
+    seen_y.push_back(y[1]);
+  };
+  vanta::ode::Solution sol = Run(opts);
+
+  EXPECT_EQ(sol.NumSteps(), 0);
+  EXPECT_EQ(seen_t, (std::vector<double>{0.0, 5.0, 10.0}));
+  EXPECT_EQ(seen_y, (std::vector<double>{0.0, -5.0, -10.0}));
+}
+
+TEST_F(OutputRecorderTest, DenseOutputStoresDerivatives) {
+  vanta::ode::OutputOptions opts;
+  opts.stride = 4;
+  opts.dense = true;
+  int n_calls = 0;
+  vanta::ode::OutputRecorder recorder(
+      opts, 2, 10,
+      [&n_calls](double t [[maybe_unused]],
+                 std::span<const double> y [[maybe_unused]],
+                 std::span<double> dydt) {
+        ++n_calls;
+        dydt[0] = 1.0;
+        dydt[1] = -1.0;
+      });
+  recorder.Start(0.0, std::vector<double>{0.0, 0.0});
+  for (int i = 1; i <= 10; ++i) {
+    const double t = static_cast<double>(i);
+    recorder.Step(t, std::vector<double>{t, -t});
+  }
+  vanta::ode::Solution sol = recorder.Finish();
+
+  // Only stored samples cost an evaluation
+  ASSERT_TRUE(sol.HasDerivatives());
+  EXPECT_EQ(sol.t, (std::vector<double>{0.0, 4.0, 8.0, 10.0}));
+  EXPECT_EQ(n_calls, 4);
+  EXPECT_EQ(recorder.NumRhsEvals(), 4);
+  for (size_t i = 0; i < sol.NumSteps(); ++i) {
+    EXPECT_EQ(sol.Derivative(i)[0], 1.0);
+    EXPECT_EQ(sol.Derivative(i)[1], -1.0);
+  }
+}
+
+TEST_F(OutputRecorderTest, DenseOutputRequiresRhs) {
+  vanta::ode::OutputOptions opts;
+  opts.dense = true;
+
+  EXPECT_THROW({ vanta::ode::OutputRecorder recorder(opts, 1); },
+               std::invalid_argument);
+}
+
+TEST_F(OutputRecorderTest, DenseOutputInterpolatesCoarseSamples) {
+  // Keep every tenth RK4 step of y' = -y and evaluate in between
+  auto decay = [](double t [[maybe_unused]], std::span<const double> y,
+                  std::span<double> dydt) { dydt[0] = -y[0]; };
+  vanta::ode::OutputOptions opts;
+  opts.stride = 10;
+  vanta::ode::Solution linear =
+      vanta::ode::RungeKutta4(decay, 0.0, 2.0, {1.0}, 0.01, opts);
+  opts.dense = true;
+  vanta::ode::Solution dense =
+      vanta::ode::RungeKutta4(decay, 0.0, 2.0, {1.0}, 0.01, opts);
+  ASSERT_EQ(dense.NumSteps(), 21);
+  ASSERT_FALSE(linear.HasDerivatives());
+
+  double err_dense = 0.0;
+  double err_estimated = 0.0;
+  for (double t = 0.0; t <= 2.0; t += 0.013) {
+    err_dense = std::max(err_dense, std::abs(dense.At(t)[0] - std::exp(-t)));
+    err_estimated =
+        std::max(err_estimated, std::abs(linear.At(t)[0] - std::exp(-t)));
+  }
+  EXPECT_LT(err_dense, 1e-6);
+  EXPECT_LT(err_estimated, 1e-4);
+}
@@ -0,0 +1,169 @@
+#include "ode/parareal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+class PararealTest : public ::testing::Test {
+ protected:
+  // Damped oscillator with forcing
+  static void Forced(double t, std::span<const double> y,
+                     std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0] - 0.1 * y[1] + std::sin(t);
+  }
+
+  // Serial fine solution at the slice boundaries of sol
+  static std::vector<double> SerialFine(const vanta::ode::Propagator& fine,
+                                        const vanta::ode::Solution& sol) {
+    std::vector<double> y(sol.Row(0).begin(), sol.Row(0).end());
+    std::vector<double> boundaries(y);
+    for (std::size_t s = 0; s + 1 < sol.NumSteps(); ++s) {
+      fine(sol.t[s], sol.t[s + 1], y);
+      boundaries.insert(boundaries.end(), y.begin(), y.end());
+    }
+    return boundaries;
+  }
+};
+
+TEST_F(PararealTest, InvalidArguments) {
+  auto coarse = vanta::ode::EulerForwardPropagator(Forced, 0.1);
+  auto fine = vanta::ode::RungeKutta4Propagator(Forced, 0.01);
+
+  EXPECT_THROW(vanta::ode::Parareal(coarse, fine, 1.0, 0.0, {1.0, 0.0}),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::Parareal({}, fine, 0.0, 1.0, {1.0, 0.0}),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::RungeKutta4Propagator(Forced, 0.0),
+               std::invalid_argument);
+}
+
+TEST_F(PararealTest, PropagatorsLandOnEndTime) {
+  auto f = [](double t [[maybe_unused]],
+              std::span<const double> y [[maybe_unused]],
+              std::span<double> dydt) { dydt[0] = 1.0; };
+
+  // 0.35 / 0.1 rounds up to four equal steps
+  std::vector<double> y = {0.0};
+  vanta::ode::EulerForwardPropagator(f, 0.1)(0.0, 0.35, y);
+  EXPECT_NEAR(y[0], 0.35, 1e-15);
+}
+
+TEST_F(PararealTest, ConvergesToSerialFineSolution) {
+  auto coarse = vanta::ode::RungeKutta4Propagator(Forced, 0.5);
+  auto fine = vanta::ode::RungeKutta4Propagator(Forced, 0.001);
+
+  vanta::ode::PararealOptions opts;
+  opts.n_slices = 16;
+  opts.n_threads = 4;
+  opts.tol = 1e-10;
+  vanta::ode::PararealSolution result =
+      vanta::ode::Parareal(coarse, fine, 0.0, 20.0, {1.0, 0.0}, opts);
+
+  ASSERT_EQ(result.solution.NumSteps(), 17);
+  EXPECT_DOUBLE_EQ(result.solution.t.back(), 20.0);
+  EXPECT_TRUE(result.converged);
+  EXPECT_LE(result.update, 1e-10);
+  EXPECT_LT(result.iterations, 16);
+
+  const std::vector<double> serial = SerialFine(fine, result.solution);
+  for (std::size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_NEAR(result.solution.y[i], serial[i], 1e-8);
+  }
+}
+
+TEST_F(PararealTest, ExactAfterOneIterationPerSlice) {
+  // A poor coarse propagator still reaches the fine solution
+  auto coarse = vanta::ode::EulerForwardPropagator(Forced, 1.0);
+  auto fine = vanta::ode::RungeKutta4Propagator(Forced, 0.01);
+
+  vanta::ode::PararealOptions opts;
+  opts.n_slices = 6;
+  opts.tol = 0.0;
+  vanta::ode::PararealSolution result =
+      vanta::ode::Parareal(coarse, fine, 0.0, 6.0, {1.0, 0.0}, opts);
+
+  EXPECT_EQ(result.iterations, 6);
+  EXPECT_TRUE(result.converged);
+  const std::vector<double> serial = SerialFine(fine, result.solution);
+  for (std::size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_NEAR(result.solution.y[i], serial[i], 1e-12);
+  }
+}
+
+TEST_F(PararealTest, MaxIterationsWithoutConvergence) {
+  auto coarse = vanta::ode::EulerForwardPropagator(Forced, 1.0);
+  auto fine = vanta::ode::RungeKutta4Propagator(Forced, 0.01);
+
+  vanta::ode::PararealOptions opts;
+  opts.n_slices = 8;
+  opts.max_iters = 2;
+  opts.tol = 1e-14;
+  vanta::ode::PararealSolution result =
+      vanta::ode::Parareal(coarse, fine, 0.0, 8.0, {1.0, 0.0}, opts);
+
+  EXPECT_EQ(result.iterations, 2);
+  EXPECT_FALSE(result.converged);
+  EXPECT_GT(result.update, 1e-14);
+}
+
+TEST_F(PararealTest, ConvergedSlicesAreNotRepropagated) {
+  std::atomic<int> fine_calls = 0;
+  auto rk4 = vanta::ode::RungeKutta4Propagator(Forced, 0.01);
+  vanta::ode::Propagator fine = [&](double t_start, double t_end,
+                                    std::span<double> y) {
+    ++fine_calls;
+    rk4(t_start, t_end, y);
+  };
+  auto coarse = vanta::ode::EulerForwardPropagator(Forced, 1.0);
+
+  vanta::ode::PararealOptions opts;
+  opts.n_slices = 5;
+  opts.tol = 0.0;
+  vanta::ode::PararealSolution result =
+      vanta::ode::Parareal(coarse, fine, 0.0, 5.0, {1.0, 0.0}, opts);
+
+  // Iteration k propagates slices k to 4
+  EXPECT_EQ(result.iterations, 5);
+  EXPECT_EQ(fine_calls, 5 + 4 + 3 + 2 + 1);
+  EXPECT_GT(result.serial_time, 0.0);
+  EXPECT_GT(result.wall_time, 0.0);
+  EXPECT_GT(result.speedup, 0.0);
+}
+
+TEST_F(PararealTest, PropagatorExceptionsPropagate) {
+  auto coarse = vanta::ode::EulerForwardPropagator(Forced, 1.0);
+  vanta::ode::Propagator fine = [](double, double, std::span<double>) {
+    throw std::runtime_error("fine failed");
+  };
+
+  EXPECT_THROW(vanta::ode::Parareal(coarse, fine, 0.0, 1.0, {1.0, 0.0}),
+               std::runtime_error);
+}
+
+TEST_F(PararealTest, ThrowingSliceWaitsForQueuedSlices) {
+  auto coarse = vanta::ode::EulerForwardPropagator(Forced, 1.0);
+  auto rk4 = vanta::ode::RungeKutta4Propagator(Forced, 0.01);
+
+  // The first slice throws while the others are still queued on the single
+  // worker, and they must all run before Parareal unwinds
+  std::atomic<int> fine_calls{0};
+  vanta::ode::Propagator fine = [&](double t_start, double t_end,
+                                    std::span<double> y) {
+    ++fine_calls;
+    if (t_start == 0.0) throw std::runtime_error("fine failed");
+    rk4(t_start, t_end, y);
+  };
+  vanta::ode::PararealOptions opts;
+  opts.n_slices = 8;
+  opts.n_threads = 1;
+
+  EXPECT_THROW(
+      vanta::ode::Parareal(coarse, fine, 0.0, 8.0, {1.0, 0.0}, opts),
+      std::runtime_error);
+  EXPECT_EQ(fine_calls, 8);
+}
@@ -0,0 +1,137 @@
+#include "ode/rosenbrock.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Stiff forced decay with exact solution y(t) = cos(t) for y(0) = 1
+void StiffCosine(double t, std::span<const double> y,
+                 std::span<double> dydt) {
+  dydt[0] = -1000.0 * (y[0] - std::cos(t)) - std::sin(t);
+}
+
+// Robertson chemical kinetics, a classic stiff test problem
+void Robertson(double t [[maybe_unused]], std::span<const double> y,
+               std::span<double> dydt) {
+  dydt[0] = -0.04 * y[0] + 1e4 * y[1] * y[2];
+  dydt[1] = 0.04 * y[0] - 1e4 * y[1] * y[2] - 3e7 * y[1] * y[1];
+  dydt[2] = 3e7 * y[1] * y[1];
+}
+
+}  // namespace
+
+class RosenbrockTest : public ::testing::Test {
+ protected:
+  // Allowed numerical tolerance for solution comparisons
+  const double kTolerance = 1e-6;
+};
+
+TEST_F(RosenbrockTest, InvalidArguments) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  EXPECT_THROW(vanta::ode::Rosenbrock(f, 1.0, 0.0, {1.0}),
+               std::invalid_argument);
+
+  vanta::ode::RosenbrockOptions opts;
+  opts.atol = -1.0;
+  EXPECT_THROW(vanta::ode::Rosenbrock(f, 0.0, 1.0, {1.0}, opts),
+               std::invalid_argument);
+}
+
+TEST_F(RosenbrockTest, ExponentialDecay) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  vanta::ode::RosenbrockOptions opts;
+  opts.rtol = 1e-8;
+  opts.atol = 1e-10;
+  vanta::ode::Solution sol = vanta::ode::Rosenbrock(f, 0.0, 5.0, {1.0}, opts);
+
+  // Lands exactly on the final time
+  EXPECT_EQ(sol.t.back(), 5.0);
+  for (std::size_t i = 0; i < sol.NumSteps(); ++i) {
+    EXPECT_NEAR(sol.Row(i)[0], std::exp(-sol.t[i]), kTolerance);
+  }
+}
+
+TEST_F(RosenbrockTest, ThirdOrderConvergence) {
+  // Non-autonomous problem y' = -2y + e^t with y(t) = 2/3 e^-2t + e^t / 3
+  auto f = [](double t, std::span<const double> y, std::span<double> dydt) {
+    dydt[0] = -2.0 * y[0] + std::exp(t);
+  };
+  const double exact = 2.0 / 3.0 * std::exp(-2.0) + std::exp(1.0) / 3.0;
+
+  // Loose tolerances and a capped step give a fixed step size
+  auto error = [&](double h) {
+    vanta::ode::RosenbrockOptions opts;
+    opts.rtol = 1e6;
+    opts.atol = 1e6;
+    opts.h0 = h;
+    opts.h_max = h;
+    vanta::ode::Solution sol = vanta::ode::Rosenbrock(f, 0.0, 1.0, {1.0}, opts);
+    return std::abs(sol.Back()[0] - exact);
+  };
+
+  const double order = std::log2(error(0.05) / error(0.025));
+  EXPECT_NEAR(order, 3.0, 0.2);
+}
+
+TEST_F(RosenbrockTest, StiffProblemOneJacobianPerStep) {
+  vanta::ode::RosenbrockOptions opts;
+  opts.rtol = 1e-4;
+  opts.atol = 1e-6;
+  vanta::ode::Solution sol =
+      vanta::ode::Rosenbrock(StiffCosine, 0.0, 10.0, {1.0}, opts);
+
+  for (std::size_t i = 0; i < sol.NumSteps(); ++i) {
+    EXPECT_NEAR(sol.Row(i)[0], std::cos(sol.t[i]), 1e-4);
+  }
+
+  // Steps are not limited by the fast time scale 1e-3
+  EXPECT_LT(sol.stats.n_accepted, 1000);
+
+  // One Jacobian per accepted step and one factorisation per attempt
+  EXPECT_EQ(sol.stats.n_jacobian_evals, sol.stats.n_accepted);
+  EXPECT_LE(sol.stats.n_factorisations,
+            sol.stats.n_accepted + sol.stats.n_rejected);
+}
+
+TEST_F(RosenbrockTest, StiffRobertsonWithAnalyticJacobian) {
+  vanta::ode::RosenbrockOptions opts;
+  opts.rtol = 1e-6;
+  opts.atol = 1e-10;
+  opts.autonomous = true;
+  opts.jacobian = [](double t [[maybe_unused]], std::span<const double> y,
+                     std::span<double> jac) {
+    jac[0] = -0.04;
+    jac[1] = 1e4 * y[2];
+    jac[2] = 1e4 * y[1];
+    jac[3] = 0.04;
+    jac[4] = -1e4 * y[2] - 6e7 * y[1];
+    jac[5] = -1e4 * y[1];
+    jac[6] = 0.0;
+    jac[7] = 6e7 * y[1];
+    jac[8] = 0.0;
+  };
+
+  vanta::ode::Solution sol =
+      vanta::ode::Rosenbrock(Robertson, 0.0, 40.0, {1.0, 0.0, 0.0}, opts);
+
+  // Reference values from Hairer and Wanner
+  EXPECT_NEAR(sol.Back()[0], 0.7158271, 1e-5);
+  EXPECT_NEAR(sol.Back()[1], 9.185535e-6, 1e-9);
+  EXPECT_NEAR(sol.Back()[2], 0.2841637, 1e-5);
+
+  // One evaluation per attempt plus one per accepted step
+  EXPECT_EQ(sol.stats.n_rhs_evals,
+            sol.stats.n_accepted + sol.stats.n_rejected +
+                sol.stats.n_accepted);
+}
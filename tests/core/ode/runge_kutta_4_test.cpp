@@ -4,8 +4,12 @@
 
 #include <cmath>
 #include <functional>
+#include <span>
 #include <vector>
 
+#include "allocation_counter.hpp"
+#include "ode/phase_timer.hpp"
+
 class RungeKutta4Test : public ::testing::Test {
  protected:
   // Allowed numerical tolerance for solution comparisons
@@ -59,8 +63,8 @@ TEST_F(RungeKutta4Test, ConstantFunction) {
   vanta::ode::Solution sol = vanta::ode::RungeKutta4(f, 0.0, 1.0, {5.0}, 0.1);
 
   // Check that y remains constant
-  for (const auto& y_val : sol.y) {
-    EXPECT_NEAR(y_val[0], 5.0, kTolerance);
+  for (double y_val : sol.Col(0)) {
+    EXPECT_NEAR(y_val, 5.0, kTolerance);
   }
 }
 
@@ -74,7 +78,7 @@ TEST_F(RungeKutta4Test, LinearFunction) {
   vanta::ode::Solution sol = vanta::ode::RungeKutta4(f, t0, t1, {0.0}, h);
 
   // y(t) = t, so y(1.0) should be approximately 1.0
-  EXPECT_NEAR(sol.y.back()[0], 1.0, kTolerance);
+  EXPECT_NEAR(sol.Back()[0], 1.0, kTolerance);
 }
 
 TEST_F(RungeKutta4Test, ExponentialGrowth) {
@@ -89,7 +93,7 @@ TEST_F(RungeKutta4Test, ExponentialGrowth) {
 
   // Exact solution: y(t) = e^t, so y(1) = e ≈ 2.71828
   double exact = std::exp(1.0);
-  EXPECT_NEAR(sol.y.back()[0], exact, 0.01);  // RK4 approximation error
+  EXPECT_NEAR(sol.Back()[0], exact, 0.01);  // RK4 approximation error
 }
 
 TEST_F(RungeKutta4Test, MultiDimensionalSystem) {
@@ -106,15 +110,15 @@ TEST_F(RungeKutta4Test, MultiDimensionalSystem) {
   vanta::ode::Solution sol = vanta::ode::RungeKutta4(f, t0, t1, y0, h);
 
   // Check dimensions
-  EXPECT_EQ(sol.y[0].size(), 2);
-  EXPECT_EQ(sol.y.back().size(), 2);
+  EXPECT_EQ(sol.Row(0).size(), 2);
+  EXPECT_EQ(sol.Back().size(), 2);
 
   // Exact solution: x(t) = cos(t), y(t) = -sin(t)
   double exact_x = std::cos(1.0);
   double exact_y = -std::sin(1.0);
 
-  EXPECT_NEAR(sol.y.back()[0], exact_x, 0.05);
-  EXPECT_NEAR(sol.y.back()[1], exact_y, 0.05);
+  EXPECT_NEAR(sol.Back()[0], exact_x, 0.05);
+  EXPECT_NEAR(sol.Back()[1], exact_y, 0.05);
 }
 
 TEST_F(RungeKutta4Test, CorrectNumberOfSteps) {
@@ -128,7 +132,24 @@ TEST_F(RungeKutta4Test, CorrectNumberOfSteps) {
 
   auto expected_steps = static_cast<int>(std::ceil((t1 - t0) / h));
   EXPECT_EQ(sol.t.size(), expected_steps + 1);
-  EXPECT_EQ(sol.y.size(), expected_steps + 1);
+  EXPECT_EQ(sol.NumSteps(), expected_steps + 1);
+}
+
+TEST_F(RungeKutta4Test, StatsCountStages) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+  vanta::ode::Solution sol = vanta::ode::RungeKutta4(f, 0.0, 1.0, {1.0}, 0.1);
+
+  EXPECT_EQ(sol.stats.n_accepted, 10u);
+  EXPECT_EQ(sol.stats.n_rhs_evals, 40u);
+  EXPECT_EQ(sol.stats.n_rejected, 0u);
+  EXPECT_LE(sol.stats.time.rhs, sol.stats.time.total);
+#if VANTA_ODE_TIMING
+  EXPECT_GT(sol.stats.time.total, 0.0);
+#else
+  EXPECT_EQ(sol.stats.time.total, 0.0);
+#endif
 }
 
 TEST_F(RungeKutta4Test, TimeArrayCorrectness) {
@@ -171,7 +192,7 @@ TEST_F(RungeKutta4Test, TimeDependentFunction) {
   vanta::ode::Solution sol = vanta::ode::RungeKutta4(f, t0, t1, {0.0}, h);
 
   // Exact solution: y(t) = t^2/2, so y(2) = 2
-  EXPECT_NEAR(sol.y.back()[0], 2.0, 0.01);
+  EXPECT_NEAR(sol.Back()[0], 2.0, 0.01);
 }
 
 TEST_F(RungeKutta4Test, LargeStepSize) {
@@ -186,3 +207,119 @@ TEST_F(RungeKutta4Test, LargeStepSize) {
   // Should have exactly 1 step
   EXPECT_EQ(sol.t.size(), 2);
 }
+
+TEST_F(RungeKutta4Test, InPlaceMatchesVectorOverload) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[1], -y[0]};
+  };
+  auto f_in_place = [](double t [[maybe_unused]], std::span<const double> y,
+                       std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0];
+  };
+
+  vanta::ode::Solution sol =
+      vanta::ode::RungeKutta4(f, 0.0, 1.0, {1.0, 0.0}, 0.1);
+  vanta::ode::Solution sol_in_place =
+      vanta::ode::RungeKutta4(f_in_place, 0.0, 1.0, {1.0, 0.0}, 0.1);
+
+  ASSERT_EQ(sol.NumSteps(), sol_in_place.NumSteps());
+  for (size_t i = 0; i < sol.y.size(); ++i) {
+    EXPECT_DOUBLE_EQ(sol.y[i], sol_in_place.y[i]);
+  }
+}
+
+TEST_F(RungeKutta4Test, SingleStepMatchesExactExponential) {
+  vanta::ode::InPlaceRhs f = [](double t [[maybe_unused]],
+                                std::span<const double> y,
+                                std::span<double> dydt) { dydt[0] = y[0]; };
+
+  vanta::ode::RK4Workspace ws(1);
+  std::vector<double> y = {1.0};
+  vanta::ode::RungeKutta4Step(f, 0.0, y, 0.1, y, ws);
+
+  // RK4 reproduces the Taylor series of e^h up to h^4
+  const double h = 0.1;
+  EXPECT_NEAR(y[0], 1.0 + h + h * h / 2 + h * h * h / 6 + h * h * h * h / 24,
+              1e-15);
+}
+
+TEST_F(RungeKutta4Test, SteadyStateStepDoesNotAllocate) {
+  vanta::ode::InPlaceRhs f = [](double t [[maybe_unused]],
+                                std::span<const double> y,
+                                std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0];
+  };
+
+  vanta::ode::RK4Workspace ws(2);
+  std::vector<double> y = {1.0, 0.0};
+
+  g_allocations = 0;
+  g_count_allocations = true;
+  double t = 0.0;
+  for (int i = 0; i < 100; ++i, t += 0.01) {
+    vanta::ode::RungeKutta4Step(f, t, y, 0.01, y, ws);
+  }
+  g_count_allocations = false;
+
+  EXPECT_EQ(g_allocations, 0);
+  EXPECT_NEAR(y[0], std::cos(1.0), 1e-8);
+}
+
+TEST_F(RungeKutta4Test, FinalStateOnlyOutput) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{y[1], -y[0]};
+  };
+
+  vanta::ode::OutputOptions out;
+  out.stride = 0;
+  vanta::ode::Solution full =
+      vanta::ode::RungeKutta4(f, 0.0, 10.0, {1.0, 0.0}, 0.01);
+  vanta::ode::Solution final_only =
+      vanta::ode::RungeKutta4(f, 0.0, 10.0, {1.0, 0.0}, 0.01, out);
+
+  ASSERT_EQ(final_only.NumSteps(), 1);
+  EXPECT_DOUBLE_EQ(final_only.t[0], full.t.back());
+  EXPECT_DOUBLE_EQ(final_only.Row(0)[0], full.Back()[0]);
+  EXPECT_DOUBLE_EQ(final_only.Row(0)[1], full.Back()[1]);
+}
+
+TEST_F(RungeKutta4Test, DecimatedOutput) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  vanta::ode::OutputOptions out;
+  out.stride = 10;
+  vanta::ode::Solution full = vanta::ode::RungeKutta4(f, 0.0, 1.0, {1.0}, 0.01);
+  vanta::ode::Solution decimated =
+      vanta::ode::RungeKutta4(f, 0.0, 1.0, {1.0}, 0.01, out);
+
+  ASSERT_EQ(decimated.NumSteps(), 11);
+  for (size_t i = 0; i < decimated.NumSteps(); ++i) {
+    EXPECT_DOUBLE_EQ(decimated.t[i], full.t[10 * i]);
+    EXPECT_DOUBLE_EQ(decimated.Row(i)[0], full.Row(10 * i)[0]);
+  }
+}
+
+TEST_F(RungeKutta4Test, ObserverStreamsEveryStep) {
+  auto f = [](const double& t [[maybe_unused]], const std::vector<double>& y) {
+    return std::vector<double>{-y[0]};
+  };
+
+  size_t n_samples = 0;
+  double last_y = 0.0;
+  vanta::ode::OutputOptions out;
+  out.store = false;
+  out.observer = [&](double t [[maybe_unused]], std::span<const double> y) {
+    ++n_samples;
+    last_y = y[0];
+  };
+  vanta::ode::Solution sol =
+      vanta::ode::RungeKutta4(f, 0.0, 1.0, {1.0}, 0.01, out);
+
+  EXPECT_EQ(sol.NumSteps(), 0);
+  EXPECT_EQ(n_samples, 101);
+  EXPECT_NEAR(last_y, std::exp(-1.0), kTolerance);
+}
@@ -0,0 +1,150 @@
+#include "ode/sensitivity.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "lotka_volterra.hpp"
+#include "ode/runge_kutta_4.hpp"
+
+class SensitivityTest : public LotkaVolterraTest {
+ protected:
+  static vanta::ode::SensitivityOptions Analytic() {
+    vanta::ode::SensitivityOptions opts;
+    opts.jacobian_y = JacobianY;
+    opts.jacobian_p = JacobianP;
+    return opts;
+  }
+
+  // Final state of a plain RK4 run with parameters p
+  static std::vector<double> FinalState(const std::vector<double>& p) {
+    vanta::ode::Solution sol = vanta::ode::RungeKutta4(
+        [&p](double t, std::span<const double> y, std::span<double> dydt) {
+          LotkaVolterra(t, y, p, dydt);
+        },
+        0.0, kT1, kY0, kH);
+    return {sol.Back().begin(), sol.Back().end()};
+  }
+};
+
+TEST_F(SensitivityTest, AnalyticJacobiansMatchDifferencedSolves) {
+  vanta::ode::SensitivitySolution result =
+      vanta::ode::ForwardSensitivityRungeKutta4(LotkaVolterra, 0.0, kT1, kY0,
+                                                kP, kH, Analytic());
+  const std::size_t last = result.solution.NumSteps() - 1;
+  std::span<const double> s = result.Sensitivity(last);
+
+  // The state matches the plain solver exactly
+  const std::vector<double> y = FinalState(kP);
+  EXPECT_EQ(result.solution.Back()[0], y[0]);
+  EXPECT_EQ(result.solution.Back()[1], y[1]);
+
+  // Central differences of whole solves, one pair per parameter
+  const double eps = 1e-6;
+  for (std::size_t k = 0; k < kP.size(); ++k) {
+    std::vector<double> p_plus = kP;
+    std::vector<double> p_minus = kP;
+    p_plus[k] += eps;
+    p_minus[k] -= eps;
+    const std::vector<double> y_plus = FinalState(p_plus);
+    const std::vector<double> y_minus = FinalState(p_minus);
+    for (std::size_t j = 0; j < 2; ++j) {
+      const double expected = (y_plus[j] - y_minus[j]) / (2.0 * eps);
+      EXPECT_NEAR(s[j * kP.size() + k], expected,
+                  1e-6 * std::max(std::abs(expected), 1.0));
+    }
+  }
+
+  // Stages are shared, so f is evaluated only four times per step
+  EXPECT_EQ(result.solution.stats.n_rhs_evals, 4u * 100u);
+  EXPECT_EQ(result.solution.stats.n_jacobian_evals, 2u * 4u * 100u);
+}
+
+TEST_F(SensitivityTest, DifferencedJacobiansMatchAnalytic) {
+  vanta::ode::SensitivitySolution analytic =
+      vanta::ode::ForwardSensitivityRungeKutta4(LotkaVolterra, 0.0, kT1, kY0,
+                                                kP, kH, Analytic());
+  vanta::ode::SensitivitySolution differenced =
+      vanta::ode::ForwardSensitivityRungeKutta4(LotkaVolterra, 0.0, kT1, kY0,
+                                                kP, kH);
+  vanta::ode::SensitivityOptions mixed;
+  mixed.jacobian_y = JacobianY;
+  vanta::ode::SensitivitySolution half =
+      vanta::ode::ForwardSensitivityRungeKutta4(LotkaVolterra, 0.0, kT1, kY0,
+                                                kP, kH, mixed);
+
+  ASSERT_EQ(differenced.s.size(), analytic.s.size());
+  ASSERT_EQ(half.s.size(), analytic.s.size());
+  for (std::size_t i = 0; i < analytic.s.size(); ++i) {
+    const double tol = 1e-5 * std::max(std::abs(analytic.s[i]), 1.0);
+    EXPECT_NEAR(differenced.s[i], analytic.s[i], tol);
+    EXPECT_NEAR(half.s[i], analytic.s[i], tol);
+  }
+
+  // One extra evaluation per parameter and stage
+  EXPECT_EQ(differenced.solution.stats.n_rhs_evals, 4u * 100u * 5u);
+  EXPECT_EQ(differenced.solution.stats.n_jacobian_evals, 0u);
+  EXPECT_EQ(half.solution.stats.n_rhs_evals, 4u * 100u * 5u);
+  EXPECT_EQ(half.solution.stats.n_jacobian_evals, 4u * 100u);
+}
+
+TEST_F(SensitivityTest, InitialConditionSensitivity) {
+  // y' = -p0 y with y(0) = p1, so y = p1 exp(-p0 t)
+  auto decay = [](double t [[maybe_unused]], std::span<const double> y,
+                  std::span<const double> p, std::span<double> dydt) {
+    dydt[0] = -p[0] * y[0];
+  };
+  const std::vector<double> p = {0.5, 2.0};
+  vanta::ode::SensitivityOptions opts;
+  opts.s0 = {0.0, 1.0};
+
+  vanta::ode::SensitivitySolution result =
+      vanta::ode::ForwardSensitivityRungeKutta4(decay, 0.0, 2.0, {p[1]}, p,
+                                                0.01, opts);
+  const std::size_t last = result.solution.NumSteps() - 1;
+  const double decayed = std::exp(-p[0] * 2.0);
+  EXPECT_NEAR(result.solution.Back()[0], p[1] * decayed, 1e-9);
+  EXPECT_NEAR(result.Sensitivity(last)[0], -2.0 * p[1] * decayed, 1e-6);
+  EXPECT_NEAR(result.Sensitivity(last)[1], decayed, 1e-6);
+}
+
+TEST_F(SensitivityTest, OutputOptionsApplyToSensitivities) {
+  vanta::ode::OutputOptions out;
+  out.stride = 20;
+  vanta::ode::SensitivitySolution full =
+      vanta::ode::ForwardSensitivityRungeKutta4(LotkaVolterra, 0.0, kT1, kY0,
+                                                kP, kH, Analytic());
+  vanta::ode::SensitivitySolution strided =
+      vanta::ode::ForwardSensitivityRungeKutta4(LotkaVolterra, 0.0, kT1, kY0,
+                                                kP, kH, Analytic(), out);
+
+  ASSERT_EQ(strided.solution.NumSteps(), 6u);
+  EXPECT_EQ(strided.solution.NumStates(), 2u);
+  EXPECT_EQ(strided.s.size(), 6u * 2u * 4u);
+  for (std::size_t i = 0; i < 6; ++i) {
+    EXPECT_EQ(strided.solution.t[i], full.solution.t[20 * i]);
+    for (std::size_t e = 0; e < 8; ++e) {
+      EXPECT_EQ(strided.Sensitivity(i)[e], full.Sensitivity(20 * i)[e]);
+    }
+  }
+}
+
+TEST_F(SensitivityTest, InvalidArguments) {
+  EXPECT_THROW(vanta::ode::ForwardSensitivityRungeKutta4(
+                   LotkaVolterra, 0.0, kT1, kY0, {}, kH),
+               std::invalid_argument);
+  vanta::ode::SensitivityOptions opts;
+  opts.s0 = {1.0, 0.0};
+  EXPECT_THROW(vanta::ode::ForwardSensitivityRungeKutta4(
+                   LotkaVolterra, 0.0, kT1, kY0, kP, kH, opts),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::ForwardSensitivityRungeKutta4(
+                   LotkaVolterra, 0.0, kT1, kY0, kP, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::ForwardSensitivityRungeKutta4(
+                   LotkaVolterra, kT1, 0.0, kY0, kP, kH),
+               std::invalid_argument);
+}
@@ -0,0 +1,167 @@
+#include "ode/solution.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+class SolutionTest : public ::testing::Test {
+ protected:
+  // Build a 3 step, 2 state solution with y[i][j] = 10 * i + j
+  vanta::ode::Solution MakeSolution() {
+    vanta::ode::Solution sol(3, 2);
+    for (size_t i = 0; i < sol.NumSteps(); ++i) {
+      sol.t[i] = static_cast<double>(i);
+      for (size_t j = 0; j < sol.NumStates(); ++j) {
+        sol.Row(i)[j] = 10.0 * i + j;
+      }
+    }
+    return sol;
+  }
+};
+
+TEST_F(SolutionTest, DefaultConstructedIsEmpty) {
+  vanta::ode::Solution sol;
+
+  EXPECT_EQ(sol.NumSteps(), 0);
+  EXPECT_EQ(sol.NumStates(), 0);
+  EXPECT_TRUE(sol.y.empty());
+}
+
+TEST_F(SolutionTest, SizedConstructorAllocatesContiguousBuffer) {
+  vanta::ode::Solution sol(4, 3);
+
+  EXPECT_EQ(sol.NumSteps(), 4);
+  EXPECT_EQ(sol.NumStates(), 3);
+  EXPECT_EQ(sol.y.size(), 12);
+}
+
+TEST_F(SolutionTest, RowsAreContiguousInBuffer) {
+  vanta::ode::Solution sol = MakeSolution();
+
+  EXPECT_EQ(sol.Row(1).data(), sol.y.data() + 2);
+  EXPECT_EQ(sol.Row(1).size(), 2);
+  EXPECT_DOUBLE_EQ(sol.Row(1)[0], 10.0);
+  EXPECT_DOUBLE_EQ(sol.Row(1)[1], 11.0);
+}
+
+TEST_F(SolutionTest, ColumnIndexing) {
+  vanta::ode::Solution sol = MakeSolution();
+
+  auto col = sol.Col(1);
+  ASSERT_EQ(col.size(), 3);
+  EXPECT_DOUBLE_EQ(col[0], 1.0);
+  EXPECT_DOUBLE_EQ(col[1], 11.0);
+  EXPECT_DOUBLE_EQ(col[2], 21.0);
+  EXPECT_DOUBLE_EQ(col.front(), 1.0);
+  EXPECT_DOUBLE_EQ(col.back(), 21.0);
+}
+
+TEST_F(SolutionTest, ColumnIteration) {
+  vanta::ode::Solution sol = MakeSolution();
+
+  std::vector<double> values;
+  for (double v : sol.Col(0)) values.push_back(v);
+
+  EXPECT_EQ(values, (std::vector<double>{0.0, 10.0, 20.0}));
+}
+
+TEST_F(SolutionTest, ColumnWritesThroughToBuffer) {
+  vanta::ode::Solution sol = MakeSolution();
+
+  sol.Col(0)[2] = -1.0;
+
+  EXPECT_DOUBLE_EQ(sol.Row(2)[0], -1.0);
+}
+
+TEST_F(SolutionTest, BackIsFinalRow) {
+  vanta::ode::Solution sol = MakeSolution();
+
+  EXPECT_EQ(sol.Back().data(), sol.Row(2).data());
+}
+
+TEST_F(SolutionTest, AtReproducesStoredPoints) {
+  vanta::ode::Solution sol = MakeSolution();
+
+  for (size_t i = 0; i < sol.NumSteps(); ++i) {
+    const std::vector<double> y = sol.At(sol.t[i]);
+    EXPECT_DOUBLE_EQ(y[0], sol.Row(i)[0]);
+    EXPECT_DOUBLE_EQ(y[1], sol.Row(i)[1]);
+  }
+}
+
+TEST_F(SolutionTest, AtIsExactForQuadraticsOnNonUniformGrid) {
+  // y = t^2 on a geometric grid; the estimated derivatives are exact for
+  // quadratics, so the Hermite interpolant reproduces them
+  vanta::ode::Solution sol(8, 1);
+  double t = 0.1;
+  for (size_t i = 0; i < sol.NumSteps(); ++i, t *= 1.7) {
+    sol.t[i] = t;
+    sol.Row(i)[0] = t * t;
+  }
+
+  for (double s : {0.1, 0.13, 0.5, 1.0, 2.2, 3.9, sol.t.back()}) {
+    EXPECT_NEAR(sol.At(s)[0], s * s, 1e-12 * std::max(s * s, 1.0));
+  }
+}
+
+TEST_F(SolutionTest, AtUsesStoredDerivatives) {
+  // y = t^3 on a uniform grid with exact derivatives is reproduced by the
+  // cubic Hermite interpolant
+  vanta::ode::Solution sol(5, 1);
+  for (size_t i = 0; i < sol.NumSteps(); ++i) {
+    const double t = 0.5 * static_cast<double>(i);
+    sol.t[i] = t;
+    sol.Row(i)[0] = t * t * t;
+    sol.dydt.push_back(3.0 * t * t);
+  }
+  ASSERT_TRUE(sol.HasDerivatives());
+
+  for (double s : {0.0, 0.2, 0.75, 1.3, 1.999}) {
+    EXPECT_NEAR(sol.At(s)[0], s * s * s, 1e-12);
+  }
+}
+
+TEST_F(SolutionTest, SampleEvaluatesEveryTime) {
+  vanta::ode::Solution sol = MakeSolution();
+  const std::vector<double> times = {1.5, 0.25, 2.0};
+  vanta::ode::Solution samples = sol.Sample(times);
+
+  // The stored data is linear in t, so interpolation is exact
+  ASSERT_EQ(samples.NumSteps(), 3);
+  EXPECT_EQ(samples.NumStates(), 2);
+  EXPECT_EQ(samples.t, times);
+  for (size_t k = 0; k < times.size(); ++k) {
+    EXPECT_DOUBLE_EQ(samples.Row(k)[0], 10.0 * times[k]);
+    EXPECT_DOUBLE_EQ(samples.Row(k)[1], 10.0 * times[k] + 1.0);
+  }
+}
+
+TEST_F(SolutionTest, FloatSolutionInterpolates) {
+  // Single precision states on a double time grid
+  vanta::ode::BasicSolution<float> sol(5, 1);
+  for (size_t i = 0; i < sol.NumSteps(); ++i) {
+    const double t = 0.5 * static_cast<double>(i);
+    sol.t[i] = t;
+    sol.Row(i)[0] = static_cast<float>(t * t);
+  }
+
+  const std::vector<float> y = sol.At(1.25);
+  EXPECT_NEAR(y[0], 1.5625f, 1e-6f);
+  vanta::ode::BasicSolution<float> samples =
+      sol.Sample(std::vector<double>{0.0, 2.0});
+  EXPECT_FLOAT_EQ(samples.Row(0)[0], 0.0f);
+  EXPECT_FLOAT_EQ(samples.Row(1)[0], 4.0f);
+}
+
+TEST_F(SolutionTest, AtOutsideIntervalThrows) {
+  vanta::ode::Solution sol = MakeSolution();
+  vanta::ode::Solution empty;
+
+  EXPECT_THROW(sol.At(-0.1), std::invalid_argument);
+  EXPECT_THROW(sol.At(2.1), std::invalid_argument);
+  EXPECT_THROW(empty.At(0.0), std::invalid_argument);
+  EXPECT_THROW(sol.Sample(std::vector<double>{0.5, 3.0}),
+               std::invalid_argument);
+}
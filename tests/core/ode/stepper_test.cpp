@@ -0,0 +1,172 @@
+#include "ode/stepper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "allocation_counter.hpp"
+#include "linear_solvers/sparsity_pattern.hpp"
+#include "ode/euler_backward.hpp"
+#include "ode/runge_kutta_4.hpp"
+
+namespace {
+
+// Damped oscillator x'' = -x - 0.1 x'
+void Oscillator(double t [[maybe_unused]], std::span<const double> y,
+                std::span<double> dydt) {
+  dydt[0] = y[1];
+  dydt[1] = -y[0] - 0.1 * y[1];
+}
+
+// Stiff linear decay towards cos(t), with the tridiagonal coupling of a
+// discretised heat equation
+void StiffChain(double t, std::span<const double> y, std::span<double> dydt) {
+  const std::size_t n = y.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    const double left = i > 0 ? y[i - 1] : std::cos(t);
+    const double right = i + 1 < n ? y[i + 1] : 0.0;
+    dydt[i] = 1000.0 * (left - 2.0 * y[i] + right);
+  }
+}
+
+}  // namespace
+
+TEST(StepperTest, RungeKutta4StepsMatchSolver) {
+  const vanta::ode::InPlaceRhs f(Oscillator);
+  vanta::ode::Solution sol =
+      vanta::ode::RungeKutta4(f, 0.0, 1.0, {1.0, 0.0}, 0.1);
+
+  vanta::ode::RungeKutta4Stepper stepper(f, 0.0, {1.0, 0.0}, 0.1);
+  for (std::size_t i = 1; i < sol.NumSteps(); ++i) {
+    stepper.Step();
+    EXPECT_EQ(stepper.Time(), sol.t[i]);
+    EXPECT_EQ(stepper.State()[0], sol.Row(i)[0]);
+    EXPECT_EQ(stepper.State()[1], sol.Row(i)[1]);
+  }
+  EXPECT_EQ(stepper.NumSteps(), sol.NumSteps() - 1);
+  EXPECT_EQ(stepper.NumRhsEvals(), 4 * stepper.NumSteps());
+}
+
+TEST(StepperTest, EulerBackwardStepsMatchSolver) {
+  const vanta::ode::InPlaceRhs f(StiffChain);
+  const std::vector<double> y0(8, 0.0);
+  vanta::ode::Solution sol = vanta::ode::EulerBackward(f, 0.0, 0.5, y0, 0.01);
+
+  vanta::ode::EulerBackwardStepper stepper(f, 0.0, y0, 0.01);
+  for (std::size_t i = 1; i < sol.NumSteps(); ++i) {
+    stepper.Step();
+    EXPECT_EQ(stepper.Time(), sol.t[i]);
+    for (std::size_t j = 0; j < y0.size(); ++j) {
+      EXPECT_EQ(stepper.State()[j], sol.Row(i)[j]);
+    }
+  }
+  EXPECT_EQ(stepper.Statistics().n_accepted, sol.stats.n_accepted);
+  EXPECT_EQ(stepper.Statistics().n_rhs_evals, sol.stats.n_rhs_evals);
+  EXPECT_EQ(stepper.Statistics().n_jacobian_evals,
+            sol.stats.n_jacobian_evals);
+}
+
+TEST(StepperTest, AdvanceToLandsOnTargets) {
+  const vanta::ode::InPlaceRhs f(Oscillator);
+  vanta::ode::EulerForwardStepper stepper(f, 0.0, {1.0, 0.0}, 1e-3);
+
+  // Ticks on the step grid take one full step each and do not drift
+  for (int tick = 1; tick <= 1000; ++tick) {
+    stepper.AdvanceTo(tick * 1e-3);
+    EXPECT_EQ(stepper.Time(), tick * 1e-3);
+  }
+  EXPECT_EQ(stepper.NumSteps(), 1000u);
+  vanta::ode::Solution sol =
+      vanta::ode::ExplicitRungeKutta<vanta::ode::kEulerTableau>(
+          f, 0.0, 1.0, std::vector<double>{1.0, 0.0}, 1e-3);
+  EXPECT_NEAR(stepper.State()[0], sol.Back()[0], 1e-12);
+
+  // Off-grid targets end with a shortened step
+  stepper.AdvanceTo(1.0025);
+  EXPECT_EQ(stepper.Time(), 1.0025);
+  EXPECT_EQ(stepper.NumSteps(), 1003u);
+  stepper.AdvanceTo(1.0025);
+  EXPECT_EQ(stepper.NumSteps(), 1003u);
+  EXPECT_THROW(stepper.AdvanceTo(1.0), std::invalid_argument);
+
+  // Init restarts without changing the step size
+  stepper.Init(0.0, {1.0, 0.0});
+  stepper.AdvanceTo(1.0);
+  EXPECT_EQ(stepper.NumSteps(), 1000u);
+  EXPECT_NEAR(stepper.State()[0], sol.Back()[0], 1e-12);
+  EXPECT_THROW(stepper.Init(0.0, {1.0}), std::invalid_argument);
+}
+
+TEST(StepperTest, FixedSizeStateStepper) {
+  using State = std::array<double, 2>;
+  auto f = [](double t [[maybe_unused]], const State& y, State& dydt) {
+    dydt = {y[1], -y[0] - 0.1 * y[1]};
+  };
+  vanta::ode::ExplicitRungeKuttaStepper<vanta::ode::kRungeKutta4Tableau,
+                                        decltype(f), State>
+      stepper(f, 0.0, {1.0, 0.0}, 0.1);
+  stepper.AdvanceTo(1.0);
+
+  vanta::ode::Solution sol = vanta::ode::RungeKutta4(
+      vanta::ode::InPlaceRhs(Oscillator), 0.0, 1.0, {1.0, 0.0}, 0.1);
+  EXPECT_NEAR(stepper.State()[0], sol.Back()[0], 1e-14);
+  EXPECT_NEAR(stepper.State()[1], sol.Back()[1], 1e-14);
+}
+
+TEST(StepperTest, InvalidArguments) {
+  const vanta::ode::InPlaceRhs f(Oscillator);
+  EXPECT_THROW(vanta::ode::RungeKutta4Stepper(f, 0.0, {1.0, 0.0}, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::EulerBackwardStepper(f, 0.0, {1.0, 0.0}, -1.0),
+               std::invalid_argument);
+
+  vanta::ode::EulerBackwardStepper stepper(f, 0.0, {1.0, 0.0}, 0.1);
+  stepper.AdvanceTo(0.35);
+  EXPECT_DOUBLE_EQ(stepper.Time(), 0.35);
+  EXPECT_EQ(stepper.NumSteps(), 4u);
+  EXPECT_THROW(stepper.AdvanceTo(0.3), std::invalid_argument);
+  EXPECT_THROW(stepper.Init(0.0, std::vector<double>{1.0}),
+               std::invalid_argument);
+}
+
+TEST(StepperTest, SteppersDoNotAllocateAfterConstruction) {
+  const vanta::ode::InPlaceRhs oscillator(Oscillator);
+  const vanta::ode::InPlaceRhs chain(StiffChain);
+  const std::vector<double> x0 = {1.0, 0.0};
+  const std::vector<double> y0(16, 0.0);
+  vanta::ode::EBOptions sparse_opts;
+  sparse_opts.sparsity = vanta::linear_solvers::BandedPattern(16, 1, 1);
+
+  vanta::ode::EulerForwardStepper euler(oscillator, 0.0, x0, 1e-3);
+  vanta::ode::RungeKutta4Stepper rk4(oscillator, 0.0, x0, 1e-3);
+  vanta::ode::EulerBackwardStepper dense(chain, 0.0, y0, 1e-3);
+  vanta::ode::EulerBackwardStepper sparse(chain, 0.0, y0, 1e-3, sparse_opts);
+
+  // Run every stepper through restarts, Jacobian updates, refactorisations
+  // and shortened steps
+  g_allocations = 0;
+  g_count_allocations = true;
+  for (int run = 0; run < 2; ++run) {
+    euler.Init(0.0, x0);
+    rk4.Init(0.0, x0);
+    dense.Init(0.0, y0);
+    sparse.Init(0.0, y0);
+    for (int tick = 1; tick <= 100; ++tick) {
+      const double t = tick * 1e-3 + (tick % 10 == 0 ? 5e-4 : 0.0);
+      euler.AdvanceTo(t);
+      rk4.AdvanceTo(t);
+      dense.AdvanceTo(t);
+      sparse.AdvanceTo(t);
+    }
+  }
+  g_count_allocations = false;
+
+  EXPECT_EQ(g_allocations, 0);
+  EXPECT_GT(dense.Statistics().n_jacobian_evals, 0u);
+  EXPECT_GT(sparse.Statistics().n_factorisations, 1u);
+  EXPECT_NEAR(dense.State()[0], sparse.State()[0], 1e-8);
+}
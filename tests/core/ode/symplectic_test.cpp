@@ -0,0 +1,155 @@
+#include "ode/symplectic.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ode/runge_kutta_4.hpp"
+
+class SymplecticTest : public ::testing::Test {
+ protected:
+  // Unit harmonic oscillator q'' = -q, with q(t) = cos t from q = 1, v = 0
+  static void Spring(double t [[maybe_unused]], std::span<const double> q,
+                     std::span<double> acc) {
+    acc[0] = -q[0];
+  }
+
+  // Energy of the unit oscillator for a row [q, v]
+  static double Energy(std::span<const double> y) {
+    return 0.5 * (y[0] * y[0] + y[1] * y[1]);
+  }
+
+  // Error at t = 1 for the unit oscillator with step h
+  template <typename Solver>
+  static double Error(Solver solver, double h) {
+    vanta::ode::Solution sol = solver(Spring, 0.0, 1.0, {1.0}, {0.0}, h, {});
+    return std::abs(sol.Back()[0] - std::cos(1.0));
+  }
+};
+
+TEST_F(SymplecticTest, InvalidArguments) {
+  EXPECT_THROW(vanta::ode::VelocityVerlet(Spring, 0.0, 1.0, {1.0}, {0.0}, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::Leapfrog(Spring, 1.0, 0.0, {1.0}, {0.0}, 0.1),
+               std::invalid_argument);
+  EXPECT_THROW(vanta::ode::Yoshida4(Spring, 0.0, 1.0, {1.0}, {0.0, 0.0}, 0.1),
+               std::invalid_argument);
+}
+
+TEST_F(SymplecticTest, RowsHoldPositionsThenVelocities) {
+  auto a = [](double t [[maybe_unused]],
+              std::span<const double> q [[maybe_unused]],
+              std::span<double> acc) {
+    acc[0] = 0.0;
+    acc[1] = -1.0;
+  };
+
+  // Projectile under constant acceleration, integrated exactly
+  vanta::ode::Solution sol =
+      vanta::ode::VelocityVerlet(a, 0.0, 2.0, {0.0, 0.0}, {1.0, 2.0}, 0.5);
+
+  ASSERT_EQ(sol.NumStates(), 4);
+  ASSERT_EQ(sol.NumSteps(), 5);
+  EXPECT_NEAR(sol.Back()[0], 2.0, 1e-14);
+  EXPECT_NEAR(sol.Back()[1], 2.0 * 2.0 - 0.5 * 2.0 * 2.0, 1e-14);
+  EXPECT_NEAR(sol.Back()[2], 1.0, 1e-14);
+  EXPECT_NEAR(sol.Back()[3], 2.0 - 2.0, 1e-14);
+}
+
+TEST_F(SymplecticTest, ConvergenceOrders) {
+  const double verlet = Error(vanta::ode::VelocityVerlet, 0.02) /
+                        Error(vanta::ode::VelocityVerlet, 0.01);
+  const double leapfrog =
+      Error(vanta::ode::Leapfrog, 0.02) / Error(vanta::ode::Leapfrog, 0.01);
+  const double yoshida =
+      Error(vanta::ode::Yoshida4, 0.1) / Error(vanta::ode::Yoshida4, 0.05);
+
+  EXPECT_NEAR(std::log2(verlet), 2.0, 0.1);
+  EXPECT_NEAR(std::log2(leapfrog), 2.0, 0.1);
+  EXPECT_NEAR(std::log2(yoshida), 4.0, 0.1);
+}
+
+TEST_F(SymplecticTest, AccelerationEvaluationsPerStep) {
+  vanta::ode::Solution verlet =
+      vanta::ode::VelocityVerlet(Spring, 0.0, 1.0, {1.0}, {0.0}, 0.1);
+  vanta::ode::Solution leapfrog =
+      vanta::ode::Leapfrog(Spring, 0.0, 1.0, {1.0}, {0.0}, 0.1);
+  vanta::ode::Solution yoshida =
+      vanta::ode::Yoshida4(Spring, 0.0, 1.0, {1.0}, {0.0}, 0.1);
+
+  EXPECT_EQ(verlet.stats.n_accepted, 10);
+  EXPECT_EQ(verlet.stats.n_rhs_evals, 11);
+  EXPECT_EQ(leapfrog.stats.n_rhs_evals, 10);
+  EXPECT_EQ(yoshida.stats.n_rhs_evals, 30);
+}
+
+TEST_F(SymplecticTest, EnergyStaysBoundedOverLongHorizon) {
+  // 2000 steps of h = 0.5, about 160 periods
+  const double h = 0.5;
+  const double t1 = 1000.0;
+  const double e0 = 0.5;
+
+  auto max_energy_error = [&](const vanta::ode::Solution& sol,
+                              std::size_t first, std::size_t last) {
+    double err = 0.0;
+    for (std::size_t i = first; i < last; ++i) {
+      err = std::max(err, std::abs(Energy(sol.Row(i)) - e0));
+    }
+    return err;
+  };
+
+  for (auto solver : {vanta::ode::VelocityVerlet, vanta::ode::Leapfrog,
+                      vanta::ode::Yoshida4}) {
+    vanta::ode::Solution sol = solver(Spring, 0.0, t1, {1.0}, {0.0}, h, {});
+    const std::size_t m = sol.NumSteps();
+
+    // The error oscillates with the same amplitude at the start and the end
+    const double early = max_energy_error(sol, 0, m / 10);
+    const double late = max_energy_error(sol, m - m / 10, m);
+    EXPECT_LT(early, 0.1);
+    EXPECT_NEAR(late, early, 0.1 * early);
+  }
+
+  // RK4 at the same step steadily loses about a third of the energy
+  auto f = [](double t [[maybe_unused]], std::span<const double> y,
+              std::span<double> dydt) {
+    dydt[0] = y[1];
+    dydt[1] = -y[0];
+  };
+  vanta::ode::Solution rk4 =
+      vanta::ode::RungeKutta4(f, 0.0, t1, {1.0, 0.0}, h);
+  EXPECT_LT(Energy(rk4.Back()), 0.75 * e0);
+}
+
+TEST_F(SymplecticTest, TimeDependentForceSampledAtMidpoint) {
+  // q'' = cos t from rest has q(t) = 1 - cos t
+  auto a = [](double t, std::span<const double> q [[maybe_unused]],
+              std::span<double> acc) { acc[0] = std::cos(t); };
+
+  for (auto solver : {vanta::ode::VelocityVerlet, vanta::ode::Leapfrog,
+                      vanta::ode::Yoshida4}) {
+    vanta::ode::Solution sol = solver(a, 0.0, 2.0, {0.0}, {0.0}, 0.01, {});
+    EXPECT_NEAR(sol.Back()[0], 1.0 - std::cos(2.0), 1e-4);
+    EXPECT_NEAR(sol.Back()[1], std::sin(2.0), 1e-4);
+  }
+}
+
+TEST_F(SymplecticTest, TerminalEvent) {
+  // Stop when the spring first passes through its rest position
+  vanta::ode::OutputOptions out;
+  out.events.push_back(
+      {[](double t [[maybe_unused]], std::span<const double> y) {
+         return y[0];
+       },
+       true});
+
+  vanta::ode::Solution sol =
+      vanta::ode::Yoshida4(Spring, 0.0, 10.0, {1.0}, {0.0}, 0.01, out);
+
+  ASSERT_TRUE(sol.terminated);
+  EXPECT_NEAR(sol.events[0].t, 0.5 * M_PI, 1e-8);
+}
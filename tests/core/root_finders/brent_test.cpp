@@ -0,0 +1,47 @@
+#include "root_finders/brent.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+TEST(BrentTest, FindsSquareRoot) {
+  auto f = [](double x) { return x * x - 2.0; };
+
+  EXPECT_NEAR(vanta::root_finders::Brent(f, 0.0, 2.0), std::sqrt(2.0),
+              1e-12);
+}
+
+TEST(BrentTest, BracketOrderDoesNotMatter) {
+  auto f = [](double x) { return std::cos(x) - x; };
+
+  const double root = 0.7390851332151607;
+  EXPECT_NEAR(vanta::root_finders::Brent(f, 0.0, 1.0), root, 1e-12);
+  EXPECT_NEAR(vanta::root_finders::Brent(f, 1.0, 0.0), root, 1e-12);
+}
+
+TEST(BrentTest, ConvergesFasterThanBisection) {
+  int evals = 0;
+  auto f = [&evals](double x) {
+    ++evals;
+    return std::exp(x) - 3.0;
+  };
+
+  // Bisection would need about 40 halvings of the unit bracket
+  EXPECT_NEAR(vanta::root_finders::Brent(f, 1.0, 2.0), std::log(3.0),
+              1e-12);
+  EXPECT_LT(evals, 15);
+}
+
+TEST(BrentTest, ReturnsExactRootAtBracketEnd) {
+  auto f = [](double x) { return x - 1.0; };
+
+  EXPECT_DOUBLE_EQ(vanta::root_finders::Brent(f, 1.0, 3.0), 1.0);
+}
+
+TEST(BrentTest, ThrowsWithoutSignChange) {
+  auto f = [](double x) { return x * x + 1.0; };
+
+  EXPECT_THROW(vanta::root_finders::Brent(f, -1.0, 1.0),
+               std::invalid_argument);
+}
@@ -109,3 +109,20 @@ TEST_F(ToCsvTest, ReturnsOneForInvalidPath) {
   // Writing to a non-existent directory should fail
   EXPECT_EQ(vanta::utils::ToCSV("/nonexistent_dir/output.csv", t, y), 1);
 }
+
+TEST_F(ToCsvTest, FlatBufferMatchesNestedOutput) {
+  std::vector<double> t = {0.0, 1.0, 2.0};
+  std::vector<double> y = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+
+  ASSERT_EQ(vanta::utils::ToCSV(test_file_, t, y, 3), 0);
+
+  std::string contents = read_file(test_file_);
+  EXPECT_EQ(contents, "t,y0,y1,y2\n0,1,2,3\n1,4,5,6\n2,7,8,9\n");
+}
+
+TEST_F(ToCsvTest, FlatBufferReturnsOneForInvalidPath) {
+  std::vector<double> t = {0.0};
+  std::vector<double> y = {1.0};
+
+  EXPECT_EQ(vanta::utils::ToCSV("/nonexistent_dir/output.csv", t, y, 1), 1);
+}
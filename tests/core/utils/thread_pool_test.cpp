@@ -0,0 +1,63 @@
+#include "utils/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTest, DefaultSizeIsPositive) {
+  vanta::utils::ThreadPool pool;
+
+  EXPECT_GT(pool.Size(), 0);
+}
+
+TEST(ThreadPoolTest, ExplicitSize) {
+  vanta::utils::ThreadPool pool(3);
+
+  EXPECT_EQ(pool.Size(), 3);
+}
+
+TEST(ThreadPoolTest, SubmitReturnsResult) {
+  vanta::utils::ThreadPool pool(2);
+
+  std::future<int> result = pool.Submit([]() { return 6 * 7; });
+
+  EXPECT_EQ(result.get(), 42);
+}
+
+TEST(ThreadPoolTest, RunsAllTasks) {
+  std::atomic<int> counter{0};
+  {
+    vanta::utils::ThreadPool pool(4);
+    std::vector<std::future<void>> results;
+    for (int i = 0; i < 100; ++i) {
+      results.push_back(pool.Submit([&counter]() { ++counter; }));
+    }
+    for (auto& result : results) result.get();
+  }
+
+  EXPECT_EQ(counter, 100);
+}
+
+TEST(ThreadPoolTest, DestructorFinishesQueuedTasks) {
+  std::atomic<int> counter{0};
+  {
+    vanta::utils::ThreadPool pool(1);
+    for (int i = 0; i < 20; ++i) {
+      pool.Submit([&counter]() { ++counter; });
+    }
+  }
+
+  EXPECT_EQ(counter, 20);
+}
+
+TEST(ThreadPoolTest, ExceptionPropagatesThroughFuture) {
+  vanta::utils::ThreadPool pool(1);
+
+  std::future<void> result =
+      pool.Submit([]() { throw std::runtime_error("task failed"); });
+
+  EXPECT_THROW(result.get(), std::runtime_error);
+}